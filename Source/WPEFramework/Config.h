@@ -159,7 +159,10 @@ namespace PluginHost {
                     , OOMAdjust(0)
                     , Policy()
                     , StackSize(0)
+                    , QueueSize(16)
                     , Umask(1)
+                    , Reactors(1)
+                    , Affinity(false)
                 {
                     Add(_T("user"), &User);
                     Add(_T("group"), &Group);
@@ -167,7 +170,10 @@ namespace PluginHost {
                     Add(_T("policy"), &Policy);
                     Add(_T("oomadjust"), &OOMAdjust);
                     Add(_T("stacksize"), &StackSize);
+                    Add(_T("queuesize"), &QueueSize);
                     Add(_T("umask"), &Umask);
+                    Add(_T("reactors"), &Reactors);
+                    Add(_T("affinity"), &Affinity);
                 }
                 ProcessSet(const ProcessSet& copy)
                     : Core::JSON::Container()
@@ -177,7 +183,10 @@ namespace PluginHost {
                     , OOMAdjust(copy.OOMAdjust)
                     , Policy(copy.Policy)
                     , StackSize(copy.StackSize)
+                    , QueueSize(copy.QueueSize)
                     , Umask(copy.Umask)
+                    , Reactors(copy.Reactors)
+                    , Affinity(copy.Affinity)
                 {
                     Add(_T("user"), &User);
                     Add(_T("group"), &Group);
@@ -185,7 +194,10 @@ namespace PluginHost {
                     Add(_T("policy"), &Policy);
                     Add(_T("oomadjust"), &OOMAdjust);
                     Add(_T("stacksize"), &StackSize);
+                    Add(_T("queuesize"), &QueueSize);
                     Add(_T("umask"), &Umask);
+                    Add(_T("reactors"), &Reactors);
+                    Add(_T("affinity"), &Affinity);
                 }
                 ~ProcessSet() override = default;
 
@@ -197,7 +209,10 @@ namespace PluginHost {
                     Policy = RHS.Policy;
                     OOMAdjust = RHS.OOMAdjust;
                     StackSize = RHS.StackSize;
+                    QueueSize = RHS.QueueSize;
                     Umask = RHS.Umask;
+                    Reactors = RHS.Reactors;
+                    Affinity = RHS.Affinity;
 
                     return (*this);
                 }
@@ -208,7 +223,10 @@ namespace PluginHost {
                 Core::JSON::DecSInt8 OOMAdjust;
                 Core::JSON::EnumType<Core::ProcessInfo::scheduler> Policy;
                 Core::JSON::DecUInt32 StackSize;
+                Core::JSON::DecUInt16 QueueSize;
                 Core::JSON::DecUInt16 Umask;
+                Core::JSON::DecUInt8 Reactors;
+                Core::JSON::Boolean Affinity;
             };
 
             class InputConfig : public Core::JSON::Container {
@@ -315,6 +333,7 @@ namespace PluginHost {
                 , SoftKillCheckWaitTime(10)
                 , HardKillCheckWaitTime(4)
                 , IPV6(false)
+                , Compression(false)
                 , DefaultMessagingCategories(false)
                 , DefaultWarningReportingCategories(false)
                 , Process()
@@ -349,6 +368,7 @@ namespace PluginHost {
                 Add(_T("softkillcheckwaittime"), &SoftKillCheckWaitTime);
                 Add(_T("hardkillcheckwaittime"), &HardKillCheckWaitTime);
                 Add(_T("ipv6"), &IPV6);
+                Add(_T("compression"), &Compression);
 #ifdef __CORE_MESSAGING__
                 Add(_T("messaging"), &DefaultMessagingCategories);
 #else
@@ -393,6 +413,7 @@ namespace PluginHost {
             Core::JSON::DecUInt8 SoftKillCheckWaitTime;
             Core::JSON::DecUInt8 HardKillCheckWaitTime;
             Core::JSON::Boolean IPV6;
+            Core::JSON::Boolean Compression;
             Core::JSON::String DefaultMessagingCategories; 
             Core::JSON::String DefaultWarningReportingCategories; 
             ProcessSet Process;
@@ -459,7 +480,10 @@ namespace PluginHost {
                 , _priority(0)
                 , _OOMAdjust(0)
                 , _policy()
-                , _umask() {
+                , _umask()
+                , _queueSize(16)
+                , _reactors(1)
+                , _affinity(false) {
             } 
             void Set(const JSONConfig::ProcessSet& input) {
                 _isSet = true;
@@ -469,6 +493,9 @@ namespace PluginHost {
                 _OOMAdjust = input.OOMAdjust.Value();
                 _policy = input.Policy.Value();
                 _umask = input.Umask.Value();
+                _queueSize = (input.QueueSize.Value() != 0 ? input.QueueSize.Value() : 16);
+                _reactors = input.Reactors.Value();
+                _affinity = input.Affinity.Value();
             } 
 
         public:
@@ -499,6 +526,15 @@ namespace PluginHost {
             inline uint16_t UMask() const {
                 return(_umask);
             }
+            inline uint16_t QueueSize() const {
+                return(_queueSize);
+            }
+            inline uint8_t Reactors() const {
+                return(_reactors);
+            }
+            inline bool Affinity() const {
+                return(_affinity);
+            }
  
         private:
             bool _isSet;
@@ -508,6 +544,9 @@ namespace PluginHost {
             int8_t _OOMAdjust;
             Core::ProcessInfo::scheduler _policy;
             uint16_t _umask;
+            uint16_t _queueSize;
+            uint8_t _reactors;
+            bool _affinity;
         };
 
     public:
@@ -553,6 +592,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 _softKillCheckWaitTime = config.SoftKillCheckWaitTime.Value();
                 _hardKillCheckWaitTime = config.HardKillCheckWaitTime.Value();
                 _IPV6 = config.IPV6.Value();
+                _compression = config.Compression.Value();
                 _binding = config.Binding.Value();
                 _interface = config.Interface.Value();
                 _portNumber = config.Port.Value();
@@ -786,6 +826,9 @@ POP_WARNING()
         inline bool IPv6() const {
             return (_IPV6);
         }
+        inline bool Compression() const {
+            return (_compression);
+        }
         const Plugin::Config* Plugin(const string& name) const {
             Core::JSON::ArrayType<Plugin::Config>::ConstIterator index(_plugins.Elements());
 
@@ -938,6 +981,7 @@ POP_WARNING()
         string _ethernetCard;
         uint16_t _portNumber;
         bool _IPV6;
+        bool _compression;
         uint16_t _idleTime;
         uint8_t _softKillCheckWaitTime;
         uint8_t _hardKillCheckWaitTime;
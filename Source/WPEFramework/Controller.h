@@ -328,6 +328,10 @@ POP_WARNING()
         uint32_t set_latitude(const Core::JSON::DecSInt32& params);
         uint32_t get_longitude(Core::JSON::DecSInt32& response) const;
         uint32_t set_longitude(const Core::JSON::DecSInt32& params);
+#if THUNDER_PERFORMANCE
+        uint32_t get_performance(const string& index, Core::JSON::ArrayType<PluginHost::MetaData::Performance>& response) const;
+        static void Fill(PluginHost::MetaData::Histogram& entry, const PluginHost::PerformanceAdministrator::Histogram& histogram);
+#endif
         void event_all(const string& callsign, const Core::JSON::String& data);
         void event_statechange(const string& callsign, const PluginHost::IShell::state& state, const PluginHost::IShell::reason& reason);
 
@@ -56,6 +56,9 @@ namespace Plugin {
         Property<Core::JSON::DecUInt16>(_T("idletime"), &Controller::get_idletime, &Controller::set_idletime, this);
         Property<Core::JSON::DecSInt32>(_T("latitude"), &Controller::get_latitude, &Controller::set_latitude, this);
         Property<Core::JSON::DecSInt32>(_T("longitude"), &Controller::get_longitude, &Controller::set_longitude, this);
+#if THUNDER_PERFORMANCE
+        Property<Core::JSON::ArrayType<PluginHost::MetaData::Performance>>(_T("performance"), &Controller::get_performance, nullptr, this);
+#endif
     }
 
     void Controller::UnregisterAll()
@@ -83,6 +86,9 @@ namespace Plugin {
         Unregister(_T("idletime"));
         Unregister(_T("latitude"));
         Unregister(_T("longitude"));
+#if THUNDER_PERFORMANCE
+        Unregister(_T("performance"));
+#endif
 
     }
 
@@ -706,6 +712,47 @@ namespace Plugin {
         return  result ;
     }
 
+#if THUNDER_PERFORMANCE
+    // Property: performance - Latency of the JSON-RPC requests handled, per method
+    // Return codes:
+    //  - ERROR_NONE: Success
+    //  - ERROR_UNKNOWN_KEY: The method has not been called
+    uint32_t Controller::get_performance(const string& index, Core::JSON::ArrayType<PluginHost::MetaData::Performance>& response) const
+    {
+        uint32_t result = (index.empty() == true ? Core::ERROR_NONE : Core::ERROR_UNKNOWN_KEY);
+
+        PluginHost::PerformanceAdministrator::Instance().Visit([&](const string& method, const PluginHost::PerformanceAdministrator::Statistics& statistics) {
+            if ((index.empty() == true) || (index == method)) {
+                PluginHost::MetaData::Performance& entry(response.Add());
+
+                entry.Method = method;
+                Fill(entry.Deserialization, statistics[PluginHost::PerformanceAdministrator::DESERIALIZATION]);
+                Fill(entry.Queueing, statistics[PluginHost::PerformanceAdministrator::QUEUEING]);
+                Fill(entry.Waiting, statistics[PluginHost::PerformanceAdministrator::WAITING]);
+                Fill(entry.Execution, statistics[PluginHost::PerformanceAdministrator::EXECUTION]);
+                Fill(entry.Communication, statistics[PluginHost::PerformanceAdministrator::COMMUNICATION]);
+                Fill(entry.Total, statistics[PluginHost::PerformanceAdministrator::TOTAL]);
+
+                result = Core::ERROR_NONE;
+            }
+        });
+
+        return result;
+    }
+
+    /* static */ void Controller::Fill(PluginHost::MetaData::Histogram& entry, const PluginHost::PerformanceAdministrator::Histogram& histogram)
+    {
+        uint32_t upTo;
+
+        entry.Count = histogram.Count();
+        entry.Average = histogram.Average();
+        entry.Maximum = histogram.Maximum();
+
+        for (uint8_t index = 0; index < PluginHost::PerformanceAdministrator::Histogram::Buckets; index++) {
+            entry.Buckets.Add() = histogram.Bucket(index, upTo);
+        }
+    }
+#endif
 
     // Note: event_all and event_subsytemchange are handled internally within the Controller
 
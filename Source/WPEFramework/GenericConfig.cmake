@@ -32,10 +32,14 @@ set(PROXYSTUB_PATH "${CMAKE_INSTALL_PREFIX}/lib/${NAMESPACE_LIB}/proxystubs" CAC
 set(POSTMORTEM_PATH "/opt/minidumps" CACHE STRING "Core file path to do the postmortem of the crash")
 set(CONFIG_INSTALL_PATH "/etc/${NAMESPACE}" CACHE STRING "Install location of the configuration")
 set(IPV6_SUPPORT false CACHE STRING "Controls if should application supports ipv6")
+set(WEBSOCKET_COMPRESSION false CACHE STRING "Accept permessage-deflate on the WebSocket connections")
 set(PRIORITY 0 CACHE STRING "Change the nice level [-20 - 20]")
 set(POLICY "OTHER" CACHE STRING "NA")
 set(OOMADJUST 0 CACHE STRING "Adapt the OOM score [-15 - 15]")
 set(STACKSIZE 0 CACHE STRING "Default stack size per thread")
+set(WORKERPOOL_QUEUE_SIZE 16 CACHE STRING "Maximum number of jobs pending in the worker pool queue")
+set(REACTORS 1 CACHE STRING "Number of resource monitor threads handling the sockets")
+set(REACTOR_AFFINITY false CACHE STRING "Pin each resource monitor thread to its own CPU")
 set(KEY_OUTPUT_DISABLED false CACHE STRING "New outputs on the VirtualInput will be disabled by default")
 set(EXIT_REASONS "Failure;MemoryExceeded;WatchdogExpired" CACHE STRING "Process exit reason list for which the postmortem is required")
 set(ETHERNETCARD_NAME "eth0" CACHE STRING "Ethernet Card name which has to be associated for the Raw Device Id creation")
@@ -55,6 +59,7 @@ ans(CONFIG)
 map_set(${CONFIG} port ${PORT})
 map_set(${CONFIG} binding ${BINDING})
 map_set(${CONFIG} ipv6 ${IPV6_SUPPORT})
+map_set(${CONFIG} compression ${WEBSOCKET_COMPRESSION})
 map_set(${CONFIG} idletime ${IDLE_TIME})
 map_set(${CONFIG} softkillcheckwaittime ${SOFT_KILL_CHECK_WAIT_TIME})
 map_set(${CONFIG} hardkillcheckwaittime ${HARD_KILL_CHECK_WAIT_TIME})
@@ -75,6 +80,9 @@ map()
     kv(policy ${POLICY})
     kv(oomadjust ${OOMADJUST})
     kv(stacksize ${STACKSIZE})
+    kv(queuesize ${WORKERPOOL_QUEUE_SIZE})
+    kv(reactors ${REACTORS})
+    kv(affinity ${REACTOR_AFFINITY})
     if(DEFINED UMASK)
         kv(umask ${UMASK})
     endif()
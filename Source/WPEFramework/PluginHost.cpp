@@ -498,6 +498,9 @@ POP_WARNING()
                 if (_config->StackSize() != 0) {
                     Core::Thread::DefaultStackSize(_config->StackSize()); 
                 }
+                if (_config->Process().Reactors() > 1) {
+                    Core::ResourceMonitor::Configure(_config->Process().Reactors(), _config->Process().Affinity());
+                }
 
 #ifndef __WINDOWS__
                 if (_config->Process().UMask() != 0) {
@@ -794,7 +797,8 @@ POP_WARNING()
                         printf("Occupation:  %d\n", metaData.Occupation);
                         printf("Poolruns:\n");
                         for (uint8_t index = 0; index < metaData.Slots; index++) {
-                            printf("  Thread%02d:  %d\n", (index + 1), metaData.Slot[index]);
+                            printf("  Thread%02d:  %d (local: %d, global: %d, stolen: %d)\n", (index + 1), metaData.Slot[index],
+                                metaData.Local[index], metaData.Global[index], metaData.Stolen[index]);
                         }
                         status->Release();
                         break;
@@ -854,10 +858,16 @@ POP_WARNING()
                     case 'R': {
                         printf("\nMonitor callstack:\n");
                         printf("============================================================\n");
-                        std::list<string> stackList;
-                        ::DumpCallStack(Core::ResourceMonitor::Instance().Id(), stackList);
-                        for (const string& entry : stackList) {
-                            printf("%s\n", entry.c_str());
+                        Core::ResourceMonitor& monitor = Core::ResourceMonitor::Instance();
+                        for (uint8_t reactor = 0; reactor < monitor.Reactors(); reactor++) {
+                            std::list<string> stackList;
+                            if (monitor.Reactors() > 1) {
+                                printf("Reactor %d:\n", reactor);
+                            }
+                            ::DumpCallStack(monitor.Reactor(reactor).Id(), stackList);
+                            for (const string& entry : stackList) {
+                                printf("%s\n", entry.c_str());
+                            }
                         }
                         break;
                     }
@@ -720,6 +720,9 @@ namespace PluginHost
         , _service()
         , _requestClose(false)
     {
+        // Offer permessage-deflate to the clients that ask for it, if so configured.
+        Compression(_parent.Configuration().Compression());
+
         TRACE(Activity, (_T("Construct a link with ID: [%d] to [%s]"), Id(), remoteId.QualifiedName().c_str()));
     }
 
@@ -744,7 +747,7 @@ namespace PluginHost
 PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
 
     Server::Server(Config& configuration, const bool background)
-        : _dispatcher(configuration.StackSize())
+        : _dispatcher(configuration.StackSize(), configuration.Process().QueueSize())
         , _connections(*this, configuration.Binder(), configuration.IdleTime())
         , _config(configuration)
         , _services(*this, _config)
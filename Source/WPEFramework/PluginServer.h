@@ -122,8 +122,8 @@ namespace PluginHost {
             WorkerPoolImplementation(const WorkerPoolImplementation&) = delete;
             WorkerPoolImplementation& operator=(const WorkerPoolImplementation&) = delete;
 
-            WorkerPoolImplementation(const uint32_t stackSize)
-                : Core::WorkerPool(THREADPOOL_COUNT, stackSize, 16, &_dispatch)
+            WorkerPoolImplementation(const uint32_t stackSize, const uint32_t queueSize)
+                : Core::WorkerPool(THREADPOOL_COUNT, stackSize, queueSize, &_dispatch)
                 , _dispatch()
             {
                 Run();
@@ -2287,8 +2287,20 @@ POP_WARNING()
                             Core::ProxyType<Core::JSONRPC::Message> message(_request->Body<Core::JSONRPC::Message>());
 
                             if (message->IsSet()) {
+#if THUNDER_PERFORMANCE
+                                Core::ProxyType<TrackingJSONRPC> tracking(message);
+                                if (tracking.IsValid() == true) {
+                                    tracking->Dispatch();
+                                }
+#endif
                                 Core::ProxyType<Core::JSONRPC::Message> body = Job::Process(_token, message);
 
+#if THUNDER_PERFORMANCE
+                                if (tracking.IsValid() == true) {
+                                    tracking->Execution(body);
+                                }
+#endif
+
                                 // If we have no response body, it looks like an async-call...
                                 if (body.IsValid() == false) {
                                     // It's a a-synchronous call, seems we should just queue this request, it will be answered later on..
@@ -2390,19 +2402,23 @@ POP_WARNING()
                     ASSERT(_element.IsValid() == true);
 
                     if (_jsonrpc == true) {
-#if THUNDER_PERFORMANCE
-                        Core::ProxyType<TrackingJSONRPC> tracking (_element);
-                        ASSERT (tracking.IsValid() == true);
-                                    tracking->Dispatch();
-#endif
                         Core::ProxyType<Core::JSONRPC::Message> message(_element);
                         ASSERT(message.IsValid() == true);
 
-                        _element = Core::ProxyType<Core::JSON::IElement>(Job::Process(_token, message));
+#if THUNDER_PERFORMANCE
+                        Core::ProxyType<TrackingJSONRPC> tracking(_element);
+                        if (tracking.IsValid() == true) {
+                            tracking->Dispatch();
+                        }
+#endif
+                        Core::ProxyType<Core::JSONRPC::Message> response(Job::Process(_token, message));
 
 #if THUNDER_PERFORMANCE
-                        tracking->Execution();
+                        if (tracking.IsValid() == true) {
+                            tracking->Execution(response);
+                        }
 #endif
+                        _element = Core::ProxyType<Core::JSON::IElement>(response);
 
                     } else {
                         _element = Job::Process(_element);
@@ -2586,7 +2602,15 @@ POP_WARNING()
                     if (serviceCall == true) {
                         service->Inbound(*request);
                     } else {
-                        request->Body(IFactories::Instance().JSONRPC());
+                        Core::ProxyType<Web::JSONBodyType<Core::JSONRPC::Message>> body(IFactories::Instance().JSONRPC());
+#if THUNDER_PERFORMANCE
+                        // The header is in, that is as close to the first byte as we get.
+                        Core::ProxyType<TrackingJSONRPC> tracking(body);
+                        if (tracking.IsValid() == true) {
+                            tracking->In(1);
+                        }
+#endif
+                        request->Body(body);
                     }
                 }
             }
@@ -2696,8 +2720,17 @@ POP_WARNING()
 
                         if (job.IsValid() == true) {
                             Core::ProxyType<Web::Request> baseRequest(request);
+#if THUNDER_PERFORMANCE
+                            if ((request->ServiceCall() == false) && (request->HasBody() == true)) {
+                                Core::ProxyType<TrackingJSONRPC> tracking(request->Body<TrackingJSONRPC>());
+                                if (tracking.IsValid() == true) {
+                                    tracking->In(0);
+                                    tracking->Queued();
+                                }
+                            }
+#endif
                             job->Set(Id(), &_parent, service, baseRequest, _security->Token(), !request->ServiceCall());
-                            _parent.Submit(Core::ProxyType<Core::IDispatch>(job));
+                            _parent.Submit(service, Core::ProxyType<Core::IDispatch>(job));
                         }
                     }
                     break;
@@ -2710,6 +2743,14 @@ POP_WARNING()
             }
             virtual void Send(const Core::ProxyType<Web::Response>& response)
             {
+#if THUNDER_PERFORMANCE
+                if (response->HasBody() == true) {
+                    Core::ProxyType<const TrackingJSONRPC> tracking(response->Body<const TrackingJSONRPC>());
+                    if (tracking.IsValid() == true) {
+                        const_cast<TrackingJSONRPC&>(*tracking).Sent();
+                    }
+                }
+#endif
                 if (_requestClose == true) {
                     PluginHost::Channel::Close(0);
                 }
@@ -2770,8 +2811,14 @@ POP_WARNING()
                     ASSERT(job.IsValid() == true);
 
                     if ((_service.IsValid() == true) && (job.IsValid() == true)) {
+#if THUNDER_PERFORMANCE
+                        Core::ProxyType<TrackingJSONRPC> tracking(element);
+                        if (tracking.IsValid() == true) {
+                            tracking->Queued();
+                        }
+#endif
                         job->Set(Id(), &_parent, _service, element, _security->Token(), ((State() & Channel::JSONRPC) != 0));
-                        _parent.Submit(Core::ProxyType<Core::IDispatch>(job));
+                        _parent.Submit(_service, Core::ProxyType<Core::IDispatch>(job));
                     }
                 }
             }
@@ -2789,7 +2836,7 @@ POP_WARNING()
 
                 if ((_service.IsValid() == true) && (job.IsValid() == true)) {
                     job->Set(Id(), &_parent, _service, value);
-                    _parent.Submit(Core::ProxyType<Core::IDispatch>(job));
+                    _parent.Submit(_service, Core::ProxyType<Core::IDispatch>(job));
                 }
             }
 
@@ -3079,6 +3126,14 @@ POP_WARNING()
         {
             _dispatcher.Submit(job);
         }
+        // Work on behalf of a plugin is queued fairly against the work of the other plugins,
+        // so a busy plugin can not starve the rest. The controller always goes first.
+        inline void Submit(const Core::ProxyType<Service>& service, const Core::ProxyType<Core::IDispatch>& job)
+        {
+            const Core::ThreadPool::priority level = (service == _controller ? Core::ThreadPool::HIGH : Core::ThreadPool::MEDIUM);
+
+            _dispatcher.Submit(job, level, static_cast<uint32_t>(std::hash<string>()(service->Callsign())));
+        }
         inline void Schedule(const uint64_t time, const Core::ProxyType<Core::IDispatch>& job)
         {
             _dispatcher.Schedule(time, job);
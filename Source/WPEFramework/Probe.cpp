@@ -126,6 +126,8 @@ namespace Plugin {
         , _model(model)
         , _destinations()
     {
+        // Searches tend to come in bursts, from all devices on the network at once.
+        Link().Batch(8);
 
         if (Link().Open(1000) != Core::ERROR_NONE) {
             ASSERT(false && "Seems we can not open the discovery port");
@@ -111,6 +111,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
             , _dispatcher(callsign)
             , _announceHandler(nullptr)
             , _sink(*this)
+            , _lane(Core::ProxyType<RPC::OneWayLane>::Create())
         {
             Core::ServiceAdministrator::Instance().Callback(&_sink);
 
@@ -146,16 +147,23 @@ POP_WARNING()
     protected:
         void Procedure(Core::IPCChannel& channel, Core::ProxyType<Core::IIPC>& data) override
         {
-            Core::ProxyType<RPC::Job> job(RPC::Job::Instance());
+            if (data->Label() == RPC::OneWayMessage::Id()) {
+                if (_lane->Add(channel, data) == true) {
+                    WorkerPool::Submit(Core::ProxyType<Core::IDispatch>(_lane));
+                }
+            } else {
+                Core::ProxyType<RPC::Job> job(RPC::Job::Instance());
 
-            job->Set(channel, data, _announceHandler);
+                job->Set(channel, data, _announceHandler);
 
-            WorkerPool::Submit(Core::ProxyType<Core::IDispatch>(job));
+                WorkerPool::Submit(Core::ProxyType<Core::IDispatch>(job));
+            }
         }
     private:
         Dispatcher _dispatcher;
         Core::IIPCServer* _announceHandler;
         Sink _sink;
+        Core::ProxyType<RPC::OneWayLane> _lane;
     };
 
     class ConsoleOptions : public Core::Options {
@@ -28,6 +28,7 @@ namespace RPC {
         , _stubs()
         , _proxy()
         , _factory(8)
+        , _oneWay(2)
         , _channelProxyMap()
     {
     }
@@ -143,6 +144,89 @@ namespace RPC {
             TRACE_L1("Unknown interface. %d", interfaceId);
         }
     }
+    void Administrator::Invoke(Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<OneWayMessage>& message)
+    {
+        const Data::Batch& batch(message->Parameters());
+
+        if (batch.IsEmpty() == false) {
+            Core::ProxyType<InvokeMessage> invoke(_factory.Element());
+            uint16_t offset = 0;
+
+            // Unpack the invokes one by one, in the order they were sent.
+            do {
+                offset = batch.Get(offset, invoke->Parameters());
+
+                Invoke(channel, invoke);
+
+                invoke->Response().Clear();
+
+            } while (offset != 0);
+        }
+    }
+
+    void Administrator::Retain(const Data::Batch& batch)
+    {
+        if (batch.IsEmpty() == false) {
+            Data::Input input;
+            uint16_t offset = 0;
+
+            do {
+                offset = batch.Get(offset, input);
+
+                // stub are loaded before any action is taken and destructed if the process closes down, so no need to lock..
+                std::map<uint32_t, ProxyStub::UnknownStub*>::const_iterator index(_stubs.find(input.InterfaceId()));
+
+                if (index != _stubs.end()) {
+                    Core::IUnknown* implementation = index->second->Convert(reinterpret_cast<void*>(input.Implementation()));
+
+                    ASSERT(implementation != nullptr);
+
+                    implementation->AddRef();
+                }
+            } while (offset != 0);
+        }
+    }
+
+    void Administrator::Relinquish(const Data::Batch& batch)
+    {
+        if (batch.IsEmpty() == false) {
+            Data::Input input;
+            uint16_t offset = 0;
+
+            do {
+                offset = batch.Get(offset, input);
+
+                std::map<uint32_t, ProxyStub::UnknownStub*>::const_iterator index(_stubs.find(input.InterfaceId()));
+
+                if (index != _stubs.end()) {
+                    Core::IUnknown* implementation = index->second->Convert(reinterpret_cast<void*>(input.Implementation()));
+
+                    ASSERT(implementation != nullptr);
+
+                    implementation->Release();
+                }
+            } while (offset != 0);
+        }
+    }
+
+    uint32_t Administrator::Post(const Core::ProxyType<Core::IPCChannel>& channel, const Data::Input& parameters)
+    {
+        uint32_t result;
+        BatchScope* scope = BatchScope::Current();
+
+        if (scope != nullptr) {
+            result = scope->Add(channel, parameters);
+        } else {
+            Core::ProxyType<OneWayMessage> message(_oneWay.Element());
+
+            message->Parameters().Add(parameters);
+
+            result = channel->Post(message);
+        }
+
+        return (result);
+    }
+
     ProxyStub::UnknownProxy* Administrator::ProxyFind(const Core::ProxyType<Core::IPCChannel>& channel, const instance_id& impl, const uint32_t id, void*& interface)
     {
         ProxyStub::UnknownProxy* result = nullptr;
@@ -330,6 +414,59 @@ namespace RPC {
 
     /* static */ Administrator& Job::_administrator= Administrator::Instance();
 	/* static */ Core::ProxyPoolType<Job> Job::_factory(6);
+    /* static */ thread_local BatchScope* BatchScope::_current = nullptr;
+
+    uint32_t BatchScope::Add(const Core::ProxyType<Core::IPCChannel>& channel, const Data::Input& parameters)
+    {
+        uint32_t result = Core::ERROR_NONE;
+        Batches::iterator index(_batches.begin());
+
+        while ((index != _batches.end()) && (index->first != channel)) {
+            index++;
+        }
+
+        if (index == _batches.end()) {
+            _batches.emplace_back(channel, Administrator::Instance().OneWay());
+            index = std::prev(_batches.end());
+        }
+
+        if (index->second->Parameters().Add(parameters) == false) {
+            // This one is full, send it out and start a new one.
+            result = index->first->Post(index->second);
+
+            index->second = Administrator::Instance().OneWay();
+            index->second->Parameters().Add(parameters);
+        }
+
+        return (result);
+    }
+
+    void BatchScope::Flush(const Core::ProxyType<Core::IPCChannel>& channel)
+    {
+        Batches::iterator index(_batches.begin());
+
+        while ((index != _batches.end()) && (index->first != channel)) {
+            index++;
+        }
+
+        if (index != _batches.end()) {
+            if (index->first->Post(index->second) != Core::ERROR_NONE) {
+                TRACE_L1("Could not send out the one-way invokes for a channel.");
+            }
+            _batches.erase(index);
+        }
+    }
+
+    void BatchScope::Flush()
+    {
+        for (std::pair< Core::ProxyType<Core::IPCChannel>, Core::ProxyType<OneWayMessage> >& entry : _batches) {
+            if (entry.first->Post(entry.second) != Core::ERROR_NONE) {
+                TRACE_L1("Could not send out the one-way invokes for a channel.");
+            }
+        }
+
+        _batches.clear();
+    }
 
 }
 } // namespace Core
@@ -168,6 +168,10 @@ namespace RPC {
         {
             return (_factory.Element());
         }
+        Core::ProxyType<OneWayMessage> OneWay()
+        {
+            return (_oneWay.Element());
+        }
 
         void DeleteChannel(const Core::ProxyType<Core::IPCChannel>& channel, std::list<ProxyStub::UnknownProxy*>& pendingProxies);
 
@@ -196,11 +200,21 @@ namespace RPC {
         void AddRef(Core::ProxyType<Core::IPCChannel>& channel, void* impl, const uint32_t interfaceId);
         void Release(Core::ProxyType<Core::IPCChannel>& channel, void* impl, const uint32_t interfaceId, const uint32_t dropCount);
 
+        // Send out the invoke of a one-way method. Within a BatchScope it is collected with the other
+        // one-way invokes for this channel, otherwise it is sent out right away.
+        uint32_t Post(const Core::ProxyType<Core::IPCChannel>& channel, const Data::Input& parameters);
+
         // ----------------------------------------------------------------------------------------------------
         // Methods for the Stub Environment
         // ----------------------------------------------------------------------------------------------------
         void Release(ProxyStub::UnknownProxy* proxy, Data::Output& response);
         void Invoke(Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<InvokeMessage>& message);
+        void Invoke(Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<OneWayMessage>& message);
+
+        // One-way invokes might be overtaken by a later invoke that releases the implementation they
+        // are meant for, so the implementations are kept alive from reception until handled.
+        void Retain(const Data::Batch& batch);
+        void Relinquish(const Data::Batch& batch);
 
         // ----------------------------------------------------------------------------------------------------
         // Methods for the Administration
@@ -261,10 +275,56 @@ namespace RPC {
         std::map<uint32_t, ProxyStub::UnknownStub*> _stubs;
         std::map<uint32_t, IMetadata*> _proxy;
         Core::ProxyPoolType<InvokeMessage> _factory;
+        Core::ProxyPoolType<OneWayMessage> _oneWay;
         ChannelMap _channelProxyMap;
         ReferenceMap _channelReferenceMap;
     };
 
+    // Collects the one-way invokes of this thread, per channel, to send them out in as few messages
+    // as possible; at the latest when the (outermost) scope ends. Before a two-way invoke goes out on
+    // a channel, what is collected for that channel is sent out first.
+    // One-way invokes are only kept in order amongst themselves, not with respect to two-way invokes.
+    class EXTERNAL BatchScope {
+    private:
+        using Batches = std::list< std::pair< Core::ProxyType<Core::IPCChannel>, Core::ProxyType<OneWayMessage> > >;
+
+    public:
+        BatchScope(const BatchScope&) = delete;
+        BatchScope& operator=(const BatchScope&) = delete;
+
+        BatchScope()
+            : _outer(_current)
+            , _batches()
+        {
+            if (_outer == nullptr) {
+                _current = this;
+            }
+        }
+        ~BatchScope()
+        {
+            if (_outer == nullptr) {
+                Flush();
+                _current = nullptr;
+            }
+        }
+
+    public:
+        static BatchScope* Current()
+        {
+            return (_current);
+        }
+
+        uint32_t Add(const Core::ProxyType<Core::IPCChannel>& channel, const Data::Input& parameters);
+        void Flush(const Core::ProxyType<Core::IPCChannel>& channel);
+        void Flush();
+
+    private:
+        BatchScope* _outer;
+        Batches _batches;
+
+        static thread_local BatchScope* _current;
+    };
+
     class EXTERNAL Job : public Core::IDispatch {
     public:
         Job()
@@ -314,7 +374,7 @@ namespace RPC {
         }
         void Dispatch() override
         {
-            if (_message->Label() == InvokeMessage::Id()) {
+            if ((_message->Label() == InvokeMessage::Id()) || (_message->Label() == OneWayMessage::Id())) {
                 Invoke(_channel, _message);
             } else {
                 ASSERT(_message->Label() == AnnounceMessage::Id());
@@ -326,11 +386,17 @@ namespace RPC {
 
 		static void Invoke(Core::ProxyType<Core::IPCChannel>& channel, Core::ProxyType<Core::IIPC>& data)
 		{
-            Core::ProxyType<InvokeMessage> message(data);
-            ASSERT(message.IsValid() == true);
-            _administrator.Invoke(channel, message);
-            channel->ReportResponse(data);
-
+            if (data->Label() == OneWayMessage::Id()) {
+                // Nobody is waiting for this one, so there is nothing to report.
+                Core::ProxyType<OneWayMessage> message(data);
+                ASSERT(message.IsValid() == true);
+                _administrator.Invoke(channel, message);
+            } else {
+                Core::ProxyType<InvokeMessage> message(data);
+                ASSERT(message.IsValid() == true);
+                _administrator.Invoke(channel, message);
+                channel->ReportResponse(data);
+            }
 		}
 
     private:
@@ -342,6 +408,73 @@ namespace RPC {
         static Administrator& _administrator;
     };
 
+    // The sender does not wait for one-way invokes, so the next ones might arrive before the previous
+    // ones are handled. The lane hands them to a single job, that handles them in order of arrival.
+    class EXTERNAL OneWayLane : public Core::IDispatch {
+    private:
+        using Entry = std::pair< Core::ProxyType<Core::IPCChannel>, Core::ProxyType<Core::IIPC> >;
+
+    public:
+        OneWayLane(const OneWayLane&) = delete;
+        OneWayLane& operator=(const OneWayLane&) = delete;
+
+        OneWayLane()
+            : _lock()
+            , _queue()
+            , _scheduled(false)
+        {
+        }
+        ~OneWayLane() override = default;
+
+    public:
+        // Returns true if the lane needs to be submitted to get this message handled.
+        bool Add(Core::IPCChannel& channel, const Core::ProxyType<Core::IIPC>& message)
+        {
+            Core::ProxyType<OneWayMessage> oneWay(message);
+
+            ASSERT(oneWay.IsValid() == true);
+
+            Administrator::Instance().Retain(oneWay->Parameters());
+
+            _lock.Lock();
+
+            _queue.emplace_back(Core::ProxyType<Core::IPCChannel>(channel), message);
+
+            bool result = (_scheduled == false);
+            _scheduled = true;
+
+            _lock.Unlock();
+
+            return (result);
+        }
+        void Dispatch() override
+        {
+            _lock.Lock();
+
+            while (_queue.empty() == false) {
+                Entry entry(_queue.front());
+                _queue.pop_front();
+
+                _lock.Unlock();
+
+                Job::Invoke(entry.first, entry.second);
+
+                Administrator::Instance().Relinquish(Core::ProxyType<OneWayMessage>(entry.second)->Parameters());
+
+                _lock.Lock();
+            }
+
+            _scheduled = false;
+
+            _lock.Unlock();
+        }
+
+    private:
+        Core::CriticalSection _lock;
+        std::list<Entry> _queue;
+        bool _scheduled;
+    };
+
     struct EXTERNAL IIPCServer : public Core::IIPCServer {
         ~IIPCServer() override = default;
 
@@ -358,6 +491,7 @@ namespace RPC {
         InvokeServer(Core::IWorkerPool* workers)
             : _threadPoolEngine(*workers)
             , _handler(nullptr)
+            , _lane(Core::ProxyType<OneWayLane>::Create())
         {
             ASSERT(workers != nullptr);
         }
@@ -380,15 +514,22 @@ namespace RPC {
     private:
         void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& message) override
         {
-            Core::ProxyType<Job> job(Job::Instance());
+            if (message->Label() == OneWayMessage::Id()) {
+                if (_lane->Add(source, message) == true) {
+                    _threadPoolEngine.Submit(Core::ProxyType<Core::IDispatch>(_lane));
+                }
+            } else {
+                Core::ProxyType<Job> job(Job::Instance());
 
-            job->Set(source, message, _handler);
-            _threadPoolEngine.Submit(Core::ProxyType<Core::IDispatch>(job));
+                job->Set(source, message, _handler);
+                _threadPoolEngine.Submit(Core::ProxyType<Core::IDispatch>(job));
+            }
         }
 
     private:
         Core::IWorkerPool& _threadPoolEngine;
         Core::IIPCServer* _handler;
+        Core::ProxyType<OneWayLane> _lane;
     };
 
     template <const uint8_t THREADPOOLCOUNT, const uint32_t STACKSIZE, const uint32_t MESSAGESLOTS>
@@ -420,6 +561,7 @@ namespace RPC {
             : _dispatcher()
             , _threadPoolEngine(THREADPOOLCOUNT,STACKSIZE,MESSAGESLOTS, &_dispatcher, nullptr)
             , _handler(nullptr)
+            , _lane(Core::ProxyType<OneWayLane>::Create())
         {
             _threadPoolEngine.Run();
         }
@@ -457,6 +599,10 @@ namespace RPC {
             if (message->Label() == AnnounceMessage::Id()) {
                 ASSERT(_handler != nullptr);
                 _handler->Procedure(source, message);
+            } else if (message->Label() == OneWayMessage::Id()) {
+                if (_lane->Add(source, message) == true) {
+                    _threadPoolEngine.Submit(Core::ProxyType<Core::IDispatch>(_lane), Core::infinite);
+                }
             } else {
                 Core::ProxyType<RPC::Job> job(Job::Instance());
 
@@ -469,6 +615,7 @@ namespace RPC {
         Dispatcher _dispatcher;
         Core::ThreadPool _threadPoolEngine;
         Core::IIPCServer* _handler;
+        Core::ProxyType<OneWayLane> _lane;
     };
 }
 
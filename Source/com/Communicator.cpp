@@ -423,6 +423,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         // These are the elements we are expecting to receive over the IPC channels.
         _ipcServer.CreateFactory<AnnounceMessage>(1);
         _ipcServer.CreateFactory<InvokeMessage>(3);
+        _ipcServer.CreateFactory<OneWayMessage>(1);
     }
 
     Communicator::Communicator(
@@ -438,6 +439,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         // These are the elements we are expecting to receive over the IPC channels.
         _ipcServer.CreateFactory<AnnounceMessage>(1);
         _ipcServer.CreateFactory<InvokeMessage>(3);
+        _ipcServer.CreateFactory<OneWayMessage>(1);
     }
 
     /* virtual */ Communicator::~Communicator()
@@ -467,8 +469,10 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
     {
         CreateFactory<RPC::AnnounceMessage>(1);
         CreateFactory<RPC::InvokeMessage>(2);
+        CreateFactory<RPC::OneWayMessage>(1);
 
         Register(RPC::InvokeMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<InvokeHandlerImplementation>::Create()));
+        Register(RPC::OneWayMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<InvokeHandlerImplementation>::Create()));
         Register(RPC::AnnounceMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<AnnounceHandlerImplementation>::Create(this)));
     }
 
@@ -483,8 +487,10 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
     {
         CreateFactory<RPC::AnnounceMessage>(1);
         CreateFactory<RPC::InvokeMessage>(2);
+        CreateFactory<RPC::OneWayMessage>(1);
 
         BaseClass::Register(RPC::InvokeMessage::Id(), handler);
+        BaseClass::Register(RPC::OneWayMessage::Id(), handler);
         BaseClass::Register(RPC::AnnounceMessage::Id(), handler);
     }
 POP_WARNING()
@@ -494,9 +500,11 @@ POP_WARNING()
         BaseClass::Close(Core::infinite);
 
         BaseClass::Unregister(RPC::InvokeMessage::Id());
+        BaseClass::Unregister(RPC::OneWayMessage::Id());
         BaseClass::Unregister(RPC::AnnounceMessage::Id());
 
         DestroyFactory<RPC::InvokeMessage>();
+        DestroyFactory<RPC::OneWayMessage>();
         DestroyFactory<RPC::AnnounceMessage>();
     }
 
@@ -1216,6 +1216,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _announceHandler(this)
             {
                 BaseClass::Register(InvokeMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<InvokeHandlerImplementation>::Create()));
+                BaseClass::Register(OneWayMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<InvokeHandlerImplementation>::Create()));
                 BaseClass::Register(AnnounceMessage::Id(), Core::ProxyType<Core::IIPCServer>(Core::ProxyType<AnnounceHandlerImplementation>::Create(this)));
             }
             ChannelServer(
@@ -1229,6 +1230,7 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _announceHandler(this)
             {
                 BaseClass::Register(InvokeMessage::Id(), handler);
+                BaseClass::Register(OneWayMessage::Id(), handler);
                 BaseClass::Register(AnnounceMessage::Id(), handler);
             }
 POP_WARNING()
@@ -1236,6 +1238,7 @@ POP_WARNING()
             ~ChannelServer()
             {
                 BaseClass::Unregister(AnnounceMessage::Id());
+                BaseClass::Unregister(OneWayMessage::Id());
                 BaseClass::Unregister(InvokeMessage::Id());
             }
 
@@ -285,6 +285,13 @@ namespace ProxyStub {
         {
             ASSERT(_channel.IsValid() == true);
 
+            RPC::BatchScope* scope = RPC::BatchScope::Current();
+
+            if (scope != nullptr) {
+                // What this thread posted on this channel, should go out before this invoke.
+                scope->Flush(_channel);
+            }
+
             uint32_t result = _channel->Invoke(message, waitTime);
 
             if (result != Core::ERROR_NONE) {
@@ -294,6 +301,18 @@ namespace ProxyStub {
 
             return (result);
         }
+        inline uint32_t Post(Core::ProxyType<RPC::InvokeMessage>& message) const
+        {
+            ASSERT(_channel.IsValid() == true);
+
+            uint32_t result = RPC::Administrator::Instance().Post(_channel, message->Parameters());
+
+            if (result != Core::ERROR_NONE) {
+                TRACE_L1("IPC method post failed for 0x%X, error: %d", message->Parameters().InterfaceId(), result);
+            }
+
+            return (result);
+        }
         inline void Complete(RPC::Data::Frame::Reader& reader) const
         {
             while (reader.HasData() == true) {
@@ -408,6 +427,10 @@ POP_WARNING()
         {
             return (_unknown.Invoke(message, waitTime));
         }
+        inline uint32_t Post(Core::ProxyType<RPC::InvokeMessage>& message) const
+        {
+            return (_unknown.Post(message));
+        }
         inline void* Interface(const RPC::instance_id& implementation, const uint32_t id) const
         {
             void* result = nullptr;
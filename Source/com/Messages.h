@@ -39,6 +39,155 @@ namespace RPC {
     namespace Data {
         static const uint16_t IPC_BLOCK_SIZE = 512;
 
+        // Buffers larger than this do not travel in the frame (which can not hold more
+        // than 64Kb anyway), but are handed over through a Region.
+        static const uint32_t IPC_SHARED_THRESHOLD = (16 * 1024);
+
+        // One-way invokes are collected in a batch up to this size, before it is sent.
+        static const uint16_t IPC_BATCH_SIZE = (16 * 1024);
+
+        // A memory mapped file, owned by the side that issues an invoke. Large buffers
+        // are placed in there and only a descriptor (name and offset) goes into the
+        // frame. The called side maps the file on first use and keeps it mapped for
+        // as long as the calling side keeps using the same file. Results for large
+        // buffers are written by the called side in space the caller reserved, so the
+        // region of a message is only touched by one invoke at a time.
+        class Region {
+        private:
+            static constexpr uint32_t InitialSize = (256 * 1024);
+
+        public:
+            Region(const Region&) = delete;
+            Region& operator=(const Region&) = delete;
+
+            Region()
+                : _storage(nullptr)
+                , _owner(false)
+                , _used(0)
+            {
+            }
+            ~Region()
+            {
+                Close();
+            }
+
+        public:
+            inline void Clear()
+            {
+                _used = 0;
+            }
+            inline bool IsValid() const
+            {
+                return (_storage != nullptr);
+            }
+            inline const string& Name() const
+            {
+                ASSERT(_storage != nullptr);
+
+                return (_storage->Name());
+            }
+            // Calling side, claim space in the region owned by this side. A region that is
+            // mapped from the other side, can not be claimed from.
+            uint8_t* Allocate(const uint32_t length, uint32_t& offset)
+            {
+                uint8_t* result = nullptr;
+
+                if (_storage == nullptr) {
+                    Open(Unique(), true);
+                }
+
+                if ((_owner == true) && (_storage != nullptr)) {
+                    if ((_used + length) > _storage->Size()) {
+                        _storage->Size(_used + length);
+                    }
+                    if ((_storage->IsValid() == true) && ((_used + length) <= _storage->Size())) {
+                        offset = _used;
+                        result = &(_storage->Buffer()[_used]);
+                        _used += length;
+                    }
+                }
+
+                return (result);
+            }
+            // Locate a range in the region with the given name, mapping it if it is not ours.
+            uint8_t* Map(const string& name, const uint32_t offset, const uint32_t length)
+            {
+                if ((_storage == nullptr) || (_storage->Name() != name) || ((offset + length) > _storage->Size())) {
+                    if (_owner == false) {
+                        Open(name, false);
+                    }
+                }
+
+                return ((_storage != nullptr) && (_storage->IsValid() == true) && (_storage->Name() == name) && ((offset + length) <= _storage->Size()) ? &(_storage->Buffer()[offset]) : nullptr);
+            }
+            bool Contains(const uint8_t buffer[], const uint32_t length, uint32_t& offset) const
+            {
+                bool result = false;
+
+                if ((_storage != nullptr) && (_storage->IsValid() == true)) {
+                    const uint8_t* begin = _storage->Buffer();
+
+                    if ((buffer >= begin) && ((buffer + length) <= (begin + _storage->Size()))) {
+                        offset = static_cast<uint32_t>(buffer - begin);
+                        result = true;
+                    }
+                }
+
+                return (result);
+            }
+
+        private:
+            string Unique() const
+            {
+                #ifdef __LINUX__
+                string result(_T("/dev/shm/comrpc."));
+                #else
+                string result(_T("/tmp/comrpc."));
+                #endif
+
+                return (result + Core::NumberType<uint32_t>(Core::ProcessInfo().Id()).Text() + '.' + Core::NumberType<uint64_t>(reinterpret_cast<uintptr_t>(this)).Text());
+            }
+            void Open(const string& name, const bool create)
+            {
+                Close();
+
+                if (create == true) {
+                    _storage = new Core::DataElementFile(name, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::GROUP_READ | Core::File::GROUP_WRITE | Core::File::SHAREABLE | Core::File::CREATE, InitialSize);
+                } else {
+                    _storage = new Core::DataElementFile(name, Core::File::USER_READ | Core::File::USER_WRITE | Core::File::SHAREABLE);
+                }
+
+                if (_storage->IsValid() == false) {
+                    TRACE_L1("Could not map shared region %s, error: %d", name.c_str(), _storage->ErrorCode());
+                    delete _storage;
+                    _storage = nullptr;
+                } else {
+                    _owner = create;
+                }
+            }
+            void Close()
+            {
+                if (_storage != nullptr) {
+                    const string name(_storage->Name());
+
+                    delete _storage;
+                    _storage = nullptr;
+
+                    if (_owner == true) {
+                        Core::File(name).Destroy();
+                    }
+                }
+
+                _owner = false;
+                _used = 0;
+            }
+
+        private:
+            Core::DataElementFile* _storage;
+            bool _owner;
+            uint32_t _used;
+        };
+
         class Frame : public Core::FrameType<IPC_BLOCK_SIZE, true, uint16_t> {
         private:
             using BaseClass = Core::FrameType < IPC_BLOCK_SIZE, true, uint16_t>;
@@ -79,7 +228,7 @@ namespace RPC {
             Input(const Input&) = delete;
             Input& operator=(const Input&) = delete;
 
-            Input() : _data() {
+            Input() : _data(), _region(), _calling(false) {
             }
             ~Input() = default;
 
@@ -87,9 +236,13 @@ namespace RPC {
             inline void Clear()
             {
                 _data.Clear();
+                _region.Clear();
             }
             void Set(instance_id implementation, const uint32_t interfaceId, const uint8_t methodId)
             {
+                _region.Clear();
+                _calling = true;
+
                 uint16_t result = _data.SetNumber<instance_id>(0, implementation);
                 result += _data.SetNumber<uint32_t>(result, interfaceId);
                 _data.SetNumber(result, methodId);
@@ -135,6 +288,185 @@ namespace RPC {
                 return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
             }
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
+            {
+                _calling = false;
+
+                return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
+            }
+
+            // Buffers with a 32 bits length, go through the region of this invoke if they
+            // are larger than the IPC_SHARED_THRESHOLD. The writer/reader may belong to the
+            // parameters or to the response of this invoke. Only the calling side claims
+            // space in the region, the called side only uses what the caller handed over.
+            void Buffer(Frame::Writer& writer, const uint32_t length, const uint8_t buffer[])
+            {
+                uint32_t offset = 0;
+                bool shared = false;
+
+                if (length > IPC_SHARED_THRESHOLD) {
+                    // If it is already in the region (called side writing the results), only
+                    // the descriptor is needed, otherwise it is copied into our region.
+                    shared = _region.Contains(buffer, length, offset);
+
+                    if ((shared == false) && (_calling == true)) {
+                        uint8_t* destination = _region.Allocate(length, offset);
+
+                        if (destination != nullptr) {
+                            ::memcpy(destination, buffer, length);
+                            shared = true;
+                        }
+                    }
+                }
+
+                writer.Number<uint32_t>(length);
+                writer.Boolean(shared);
+
+                if (shared == true) {
+                    writer.Text(_region.Name());
+                    writer.Number<uint32_t>(offset);
+                } else if (length != 0) {
+                    ASSERT((length < 0x10000) && "Buffer too large for a frame");
+                    writer.Copy(static_cast<uint16_t>(length), buffer);
+                }
+            }
+            // Called side, lock the buffer in the frame or in the region of the caller.
+            uint32_t Buffer(Frame::Reader& reader, const uint8_t*& buffer)
+            {
+                uint32_t length = reader.Number<uint32_t>();
+
+                if (reader.Boolean() == true) {
+                    const string name(reader.Text());
+                    const uint32_t offset = reader.Number<uint32_t>();
+
+                    buffer = _region.Map(name, offset, length);
+                } else {
+                    buffer = reader.Data();
+                    reader.Forward(static_cast<uint16_t>(length));
+                }
+
+                if (buffer == nullptr) {
+                    length = 0;
+                }
+
+                return (length);
+            }
+            // Calling side, copy out a buffer from the frame or from our own region.
+            uint32_t Buffer(Frame::Reader& reader, const uint32_t maxLength, uint8_t buffer[])
+            {
+                const uint8_t* source = nullptr;
+                uint32_t length = Buffer(reader, source);
+
+                if (length > maxLength) {
+                    length = maxLength;
+                }
+                if (length != 0) {
+                    ::memcpy(buffer, source, length);
+                }
+
+                return (length);
+            }
+            // Calling side, make room in our region for a large buffer the called side
+            // has to fill.
+            void Reserve(Frame::Writer& writer, const uint32_t length)
+            {
+                uint32_t offset = 0;
+                bool shared = ((_calling == true) && (length > IPC_SHARED_THRESHOLD) && (_region.Allocate(length, offset) != nullptr));
+
+                writer.Number<uint32_t>(length);
+                writer.Boolean(shared);
+
+                if (shared == true) {
+                    writer.Text(_region.Name());
+                    writer.Number<uint32_t>(offset);
+                }
+            }
+            // Called side, the room reserved by the caller, or nullptr if there is none.
+            uint8_t* Reserved(Frame::Reader& reader)
+            {
+                uint8_t* result = nullptr;
+                const uint32_t length = reader.Number<uint32_t>();
+
+                if (reader.Boolean() == true) {
+                    const string name(reader.Text());
+                    const uint32_t offset = reader.Number<uint32_t>();
+
+                    result = _region.Map(name, offset, length);
+                }
+
+                return (result);
+            }
+
+        private:
+            Frame _data;
+            Region _region;
+            bool _calling;
+        };
+
+        // The invokes of one-way methods (no response expected) are sent in a batch: a
+        // sequence of length prefixed Input frames, handled in the order they were added.
+        class Batch {
+        public:
+            Batch(const Batch&) = delete;
+            Batch& operator=(const Batch&) = delete;
+
+            Batch() : _data() {
+            }
+            ~Batch() = default;
+
+        public:
+            inline void Clear()
+            {
+                _data.Clear();
+            }
+            inline bool IsEmpty() const
+            {
+                return (_data.Size() == 0);
+            }
+            // Returns false if the batch has no room left for this invoke.
+            bool Add(const Input& input)
+            {
+                bool result = false;
+                const uint16_t offset = _data.Size();
+                const uint32_t length = input.Length();
+
+                if ((IsEmpty() == true) || ((offset + sizeof(uint16_t) + length) <= IPC_BATCH_SIZE)) {
+                    ASSERT((offset + sizeof(uint16_t) + length) < 0x10000);
+
+                    _data.SetNumber<uint16_t>(offset, static_cast<uint16_t>(length));
+                    _data.Size(static_cast<uint16_t>(offset + sizeof(uint16_t) + length));
+                    input.Serialize(&(_data[offset + sizeof(uint16_t)]), static_cast<uint16_t>(length), 0);
+                    result = true;
+                }
+
+                return (result);
+            }
+            // Load the invoke at the given offset, returns the offset of the next one
+            // or 0 if this was the last.
+            uint16_t Get(const uint16_t offset, Input& input) const
+            {
+                uint16_t length = 0;
+                uint16_t next = 0;
+
+                _data.GetNumber<uint16_t>(offset, length);
+
+                ASSERT((offset + sizeof(uint16_t) + length) <= _data.Size());
+
+                input.Clear();
+                input.Deserialize(&(_data[offset + sizeof(uint16_t)]), length, 0);
+
+                next = static_cast<uint16_t>(offset + sizeof(uint16_t) + length);
+
+                return (next < _data.Size() ? next : 0);
+            }
+            uint32_t Length() const
+            {
+                return (_data.Size());
+            }
+            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, const uint32_t offset) const
+            {
+                return (_data.Serialize(static_cast<uint16_t>(offset), stream, maxLength));
+            }
+            uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength, const uint32_t offset)
             {
                 return (_data.Deserialize(static_cast<uint16_t>(offset), stream, maxLength));
             }
@@ -414,5 +746,6 @@ namespace RPC {
 
     typedef Core::IPCMessageType<1, Data::Init, Data::Setup> AnnounceMessage;
     typedef Core::IPCMessageType<2, Data::Input, Data::Output> InvokeMessage;
+    typedef Core::IPCMessageType<3, Data::Batch, Data::Output> OneWayMessage;
 }
 }
@@ -331,17 +331,21 @@ namespace Core {
                         uint32_t part1 = 0;
                         uint32_t part2 = 0;
 
-                        if (_administration->_size < offset) {
-                            part2 = result - (offset - _administration->_size);
+                        if (_administration->_size <= offset) {
+                            // What GetReadSize() skipped already wrapped, all data is at the start of the buffer.
+                            offset -= _administration->_size;
+                            part2 = offset + result;
+
+                            memcpy(buffer, _realBuffer + offset, bufferLength);
                         } else {
                             part1 = _administration->_size - offset;
                             part2 = result - part1;
-                        }
 
-                        memcpy(buffer, _realBuffer + offset, std::min(part1, bufferLength));
+                            memcpy(buffer, _realBuffer + offset, std::min(part1, bufferLength));
 
-                        if (part1 < bufferLength) {
-                            memcpy(buffer + part1, _realBuffer, bufferLength - part1);
+                            if (part1 < bufferLength) {
+                                memcpy(buffer + part1, _realBuffer, bufferLength - part1);
+                            }
                         }
 
                         // Add one round, but prevent overflow.
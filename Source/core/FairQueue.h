@@ -0,0 +1,410 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "StateTrigger.h"
+#include "Sync.h"
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+
+namespace WPEFramework {
+namespace Core {
+
+    // -------------------------------------------------------------------
+    // Bounded producer/consumer queue, a drop in for the QueueType, that
+    // does not hand out the entries in the order they were posted.
+    // Every entry is posted in a class, a lower class number always goes
+    // first, and within a class for a key (a flow). Within a class, the
+    // flows that have entries are served deficit round robin: each flow
+    // gets its quantum (default 1) of entries per turn, before the next
+    // flow is served. This way, one flow flooding the queue, can not
+    // starve the other flows of the same class.
+    // Posts without a class/key, go to the middle class, flow 0.
+    // -------------------------------------------------------------------
+    template <typename CONTEXT, const uint8_t CLASSES = 3>
+    class FairQueueType {
+    private:
+        static_assert(CLASSES > 0, "At least one class is required");
+
+        struct Flow {
+            Flow(const uint32_t key, const uint16_t quantum)
+                : Key(key)
+                , Quantum(quantum)
+                , Credit(0)
+                , Entries()
+            {
+            }
+
+            uint32_t Key;
+            uint16_t Quantum;
+            uint16_t Credit;
+            std::list<CONTEXT> Entries;
+        };
+
+        typedef std::list<Flow> Flows;
+
+    public:
+        static constexpr uint8_t DefaultClass = (CLASSES / 2);
+
+        FairQueueType() = delete;
+        FairQueueType(const FairQueueType<CONTEXT, CLASSES>&) = delete;
+        FairQueueType& operator=(const FairQueueType<CONTEXT, CLASSES>&) = delete;
+
+        explicit FairQueueType(const uint32_t highWaterMark)
+            : _classes()
+            , _quanta()
+            , _count(0)
+            , _state(EMPTY)
+            , _adminLock()
+            , _maxSlots(highWaterMark)
+        {
+            // A highwatermark of 0 is bullshit.
+            ASSERT(_maxSlots != 0);
+        }
+        ~FairQueueType()
+        {
+            // Disable the queue and flush all entries.
+            Disable();
+        }
+
+        typedef enum {
+            EMPTY = 0x0001,
+            ENTRIES = 0x0002,
+            LIMITED = 0x0004,
+            DISABLED = 0x0008
+
+        } enumQueueState;
+
+    public:
+        // The number of entries a flow may extract in a row, before the next flow
+        // in its class gets its turn. Applies to the current and future flows of the key.
+        void Quantum(const uint32_t key, const uint16_t quantum)
+        {
+            ASSERT(quantum != 0);
+
+            _adminLock.Lock();
+
+            _quanta[key] = quantum;
+
+            for (Flows& flows : _classes) {
+                typename Flows::iterator index = std::find_if(flows.begin(), flows.end(), [key](const Flow& flow) { return (flow.Key == key); });
+
+                if (index != flows.end()) {
+                    index->Quantum = quantum;
+                }
+            }
+
+            _adminLock.Unlock();
+        }
+        bool Remove(const CONTEXT& entry)
+        {
+            bool removed = false;
+
+            // This needs to be atomic. Make sure it is.
+            _adminLock.Lock();
+
+            if (_state != DISABLED) {
+                removed = Erase(entry);
+
+                // Determine the new state.
+                _state.SetState(IsEmpty() ? EMPTY : ENTRIES);
+            }
+
+            _adminLock.Unlock();
+
+            return (removed);
+        }
+        bool Post(const CONTEXT& entry)
+        {
+            return (Post(entry, DefaultClass, 0));
+        }
+        bool Post(const CONTEXT& entry, const uint8_t level, const uint32_t key)
+        {
+            bool result = false;
+
+            ASSERT(level < CLASSES);
+
+            // This needs to be atomic. Make sure it is.
+            _adminLock.Lock();
+
+            if (_state != DISABLED) {
+                Add(entry, level, key);
+
+                // Determine the new state.
+                _state.SetState(IsFull() ? LIMITED : ENTRIES);
+
+                result = true;
+            }
+
+            _adminLock.Unlock();
+
+            return (result);
+        }
+        bool Insert(const CONTEXT& entry, const uint32_t waitTime)
+        {
+            return (Insert(entry, waitTime, DefaultClass, 0));
+        }
+        bool Insert(const CONTEXT& entry, const uint32_t waitTime, const uint8_t level, const uint32_t key)
+        {
+            bool posted = false;
+            bool triggered = true;
+
+            ASSERT(level < CLASSES);
+
+            // This needs to be atomic. Make sure it is.
+            _adminLock.Lock();
+
+            if (_state != DISABLED) {
+                do {
+                    // And is there a slot available to us ?
+                    if (_state != LIMITED) {
+                        posted = true;
+
+                        Add(entry, level, key);
+
+                        // Determine the new state.
+                        _state.SetState(IsFull() ? LIMITED : ENTRIES);
+                    } else {
+                        // We are moving into a wait, release the lock.
+                        _adminLock.Unlock();
+
+                        // Wait till the status of the queue changes.
+                        triggered = _state.WaitState(DISABLED | ENTRIES | EMPTY, waitTime);
+
+                        // Seems something happend, lock the administration.
+                        _adminLock.Lock();
+
+                        // If we were reset, that is assumed to be also a timeout
+                        triggered = triggered && (_state != DISABLED);
+                    }
+
+                } while ((posted == false) && (triggered != false));
+            }
+
+            _adminLock.Unlock();
+
+            return (posted);
+        }
+        bool Extract(CONTEXT& result, const uint32_t waitTime)
+        {
+            bool received = false;
+            bool triggered = true;
+
+            // This needs to be atomic. Make sure it is.
+            _adminLock.Lock();
+
+            if (_state != DISABLED) {
+                do {
+                    // And is there a slot to read ?
+                    if (_state != EMPTY) {
+                        received = true;
+
+                        Next(result);
+
+                        // Determine the new state.
+                        _state.SetState(IsEmpty() ? EMPTY : ENTRIES);
+                    } else {
+                        // We are moving into a wait, release the lock.
+                        _adminLock.Unlock();
+
+                        // Wait till the status of the queue changes.
+                        triggered = _state.WaitState(DISABLED | ENTRIES | LIMITED, waitTime);
+
+                        // Seems something happend, lock the administration.
+                        _adminLock.Lock();
+
+                        // If we were reset, that is assumed to be also a timeout
+                        triggered = triggered && (_state != DISABLED);
+                    }
+
+                } while ((received == false) && (triggered != false));
+            }
+
+            _adminLock.Unlock();
+
+            return (received);
+        }
+        void Enable()
+        {
+            _adminLock.Lock();
+
+            if (_state == DISABLED) {
+                _state.SetState(EMPTY);
+            }
+
+            _adminLock.Unlock();
+        }
+        void Disable()
+        {
+            _adminLock.Lock();
+
+            if (_state != DISABLED) {
+                _state.SetState(DISABLED);
+            }
+
+            _adminLock.Unlock();
+        }
+        void Flush()
+        {
+            // Clear is only possible in a "DISABLED" state !!
+            ASSERT(_state == DISABLED);
+
+            _adminLock.Lock();
+
+            for (Flows& flows : _classes) {
+                flows.clear();
+            }
+            _count = 0;
+
+            _adminLock.Unlock();
+        }
+        inline void FreeSlot() const
+        {
+            _state.WaitState(false, DISABLED | ENTRIES | EMPTY, Core::infinite);
+        }
+        inline bool IsEmpty() const
+        {
+            return (_count == 0);
+        }
+        inline bool IsFull() const
+        {
+            return (_count >= _maxSlots);
+        }
+        inline uint32_t Length() const
+        {
+            return (_count);
+        }
+        inline bool HasEntry(const CONTEXT& element) const
+        {
+            _adminLock.Lock();
+
+            bool found = false;
+
+            for (uint8_t level = 0; (level < CLASSES) && (found == false); level++) {
+                typename Flows::const_iterator flow = _classes[level].cbegin();
+
+                while ((flow != _classes[level].cend()) && (std::find(flow->Entries.cbegin(), flow->Entries.cend(), element) == flow->Entries.cend())) {
+                    flow++;
+                }
+
+                found = (flow != _classes[level].cend());
+            }
+
+            _adminLock.Unlock();
+
+            return (found);
+        }
+        void Lock()
+        {
+            _adminLock.Lock();
+        }
+        void Unlock()
+        {
+            _adminLock.Unlock();
+        }
+
+    private:
+        void Add(const CONTEXT& entry, const uint8_t level, const uint32_t key)
+        {
+            Flows& flows(_classes[level]);
+
+            typename Flows::iterator index = std::find_if(flows.begin(), flows.end(), [key](const Flow& flow) { return (flow.Key == key); });
+
+            if (index == flows.end()) {
+                // A flow that becomes active, joins at the end of the round.
+                std::unordered_map<uint32_t, uint16_t>::const_iterator quantum = _quanta.find(key);
+                flows.emplace_back(key, (quantum != _quanta.cend() ? quantum->second : 1));
+                index = std::prev(flows.end());
+            }
+
+            index->Entries.push_back(entry);
+            _count++;
+        }
+        void Next(CONTEXT& result)
+        {
+            uint8_t level = 0;
+
+            while (_classes[level].empty() == true) {
+                level++;
+                ASSERT(level < CLASSES);
+            }
+
+            Flows& flows(_classes[level]);
+            Flow& flow(flows.front());
+
+            if (flow.Credit == 0) {
+                // Its turn starts, top up its credit.
+                flow.Credit = flow.Quantum;
+            }
+
+            result = flow.Entries.front();
+            flow.Entries.pop_front();
+            flow.Credit--;
+            _count--;
+
+            if (flow.Entries.empty() == true) {
+                // An idle flow does not save up credit.
+                flows.pop_front();
+            } else if (flow.Credit == 0) {
+                // Turn is over, move to the end of the round.
+                flows.splice(flows.end(), flows, flows.begin());
+            }
+        }
+        bool Erase(const CONTEXT& entry)
+        {
+            bool found = false;
+
+            for (uint8_t level = 0; (level < CLASSES) && (found == false); level++) {
+                Flows& flows(_classes[level]);
+                typename Flows::iterator flow = flows.begin();
+
+                while ((flow != flows.end()) && (found == false)) {
+                    typename std::list<CONTEXT>::iterator index = std::find(flow->Entries.begin(), flow->Entries.end(), entry);
+
+                    if (index == flow->Entries.end()) {
+                        flow++;
+                    } else {
+                        found = true;
+                        flow->Entries.erase(index);
+                        _count--;
+
+                        if (flow->Entries.empty() == true) {
+                            flows.erase(flow);
+                        }
+                    }
+                }
+            }
+
+            return (found);
+        }
+
+    private:
+        Flows _classes[CLASSES];
+        std::unordered_map<uint32_t, uint16_t> _quanta;
+        uint32_t _count;
+        StateTrigger<enumQueueState> _state;
+        mutable CriticalSection _adminLock;
+        const uint32_t _maxSlots;
+    };
+}
+} // namespace Core
@@ -28,6 +28,9 @@
 #include "SocketPort.h"
 #include "TypeTraits.h"
 
+#include <map>
+#include <tuple>
+
 namespace WPEFramework {
 
 namespace Core {
@@ -37,7 +40,25 @@ namespace Core {
     struct IMessage {
     public:
         typedef IMessage BaseElement;
-        typedef uint32_t Identifier;
+
+        // Frames start with the length and the label of the message. After the
+        // SWITCH frame passed in a direction, the frames in that direction also
+        // carry a sequence, so responses can be matched on it, in any order.
+        // The HELLO and SWITCH frames themselves never carry a sequence.
+        enum control : uint32_t {
+            HelloLabel = 0x1FFFFFFC,
+            SwitchLabel = 0x1FFFFFFE
+        };
+
+        struct Identifier {
+            uint32_t Label;
+            uint32_t Sequence;
+        };
+
+        static inline bool IsControl(const uint32_t label)
+        {
+            return ((label == HelloLabel) || (label == SwitchLabel));
+        }
 
         class Serializer {
         public:
@@ -47,6 +68,8 @@ namespace Core {
             Serializer()
                 : _length(0)
                 , _offset(0)
+                , _base(8)
+                , _sequenced(false)
                 , _current(nullptr)
             {
             }
@@ -56,6 +79,11 @@ namespace Core {
             }
 
         public:
+            // A new connection starts without sequences.
+            inline void Reset()
+            {
+                _sequenced = false;
+            }
             bool Submit(const IMessage& element)
             {
 
@@ -68,6 +96,7 @@ namespace Core {
                 // thius all other parameters) are set correctly.
                 _length = element.Length();
                 _offset = 0;
+                _base = (((_sequenced == true) && (IsControl(element.Label()) == false)) ? 12 : 8);
                 _current = &element;
 
                 ASSERT(_length <= 0x1FFFFFFF);
@@ -82,7 +111,7 @@ namespace Core {
 
                 while ((_current != nullptr) && (result < maxLength)) {
                     if (_offset < 4) {
-                        uint32_t length = _length + CommandSize();
+                        uint32_t length = _length + Size(_current->Label()) + (_base != 8 ? Size(_current->Sequence()) : 0);
 
                         // Write the length. Continue as long as the top bt is active..
                         while ((_offset < 4) && (result < maxLength)) {
@@ -111,19 +140,37 @@ namespace Core {
                         }
                     }
 
+                    // Write the sequence, if any, Same structure as length..
+                    while ((_offset < _base) && (result < maxLength)) {
+                        uint32_t value = _current->Sequence() >> (7 * (_offset - 8));
+                        stream[result] = ((value & 0x7F) | (value >= 0x80 ? 0x80 : 0x00));
+                        result++;
+
+                        if (value >= 0x80) {
+                            _offset++;
+                        } else {
+                            _offset = _base;
+                        }
+                    }
+
                     if (result < maxLength) {
                         // Write the command, Same structure as length..
-                        uint16_t handled = _current->Serialize(&stream[result], maxLength - result, _offset - 8);
+                        uint16_t handled = _current->Serialize(&stream[result], maxLength - result, _offset - _base);
 
                         result += handled;
                         _offset += handled;
 
-                        ASSERT_VERBOSE((_offset - 8) <= _length, "%d <= %d", (_offset - 8), _length);
+                        ASSERT_VERBOSE((_offset - _base) <= _length, "%d <= %d", (_offset - _base), _length);
 
-                        if ((_offset - 8) == _length) {
+                        if ((_offset - _base) == _length) {
                             const IMessage* ready = _current;
                             _current = nullptr;
 
+                            if (ready->Label() == SwitchLabel) {
+                                // All that follows this frame, carries a sequence.
+                                _sequenced = true;
+                            }
+
                             // we are done, send out that we copied it all
                             Serialized(*ready);
                         }
@@ -135,14 +182,16 @@ namespace Core {
             virtual void Serialized(const IMessage& element) = 0;
 
         private:
-            inline uint32_t CommandSize() const
+            static inline uint8_t Size(const uint32_t value)
             {
-                return (_current->Label() > 0x1FFFFF ? 4 : (_current->Label() > 0xCFFF ? 3 : (_current->Label() > 0x7F ? 2 : 1)));
+                return (value > 0x1FFFFF ? 4 : (value > 0x3FFF ? 3 : (value > 0x7F ? 2 : 1)));
             }
 
         private:
             uint32_t _length;
             uint32_t _offset;
+            uint32_t _base;
+            bool _sequenced;
             const IMessage* _current;
         };
 
@@ -154,7 +203,10 @@ namespace Core {
             Deserializer()
                 : _length(0)
                 , _offset(0)
+                , _base(8)
                 , _label(0)
+                , _sequence(0)
+                , _sequenced(false)
                 , _current(nullptr)
             {
             }
@@ -162,14 +214,19 @@ namespace Core {
 
         public:
             virtual void Deserialized(IMessage& element) = 0;
-            virtual IMessage* Element(const uint32_t& label) = 0;
+            virtual IMessage* Element(const Identifier& identifier) = 0;
 
+            // A new connection starts without sequences.
+            inline void Reset()
+            {
+                _sequenced = false;
+            }
             uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength)
             {
                 uint16_t result = 0;
 
                 while (result < maxLength) {
-					if ((_current == nullptr) && (_offset < 8)) {
+                    if ((_current == nullptr) && (_offset < _base)) {
                         // We have nothing, start by getting the length/command
                         while ((_offset < 4) && (result < maxLength)) {
                             _length |= ((stream[result] & (_offset == 3 ? 0xFF : 0x7F)) << (7 * _offset));
@@ -189,40 +246,65 @@ namespace Core {
                                 _offset++;
                             } else {
                                 _offset = 8;
+                                _base = (((_sequenced == true) && (IsControl(_label) == false)) ? 12 : 8);
                             }
                         }
 
-                        if (_offset == 8) {
-                            _current = Element(_label);
+                        while ((_offset < _base) && (result < maxLength)) {
+                            _sequence |= ((stream[result] & (_offset == 11 ? 0xFF : 0x7F)) << (7 * (_offset - 8)));
+                            _length--;
+
+                            if ((stream[result++] & 0x80) != 0) {
+                                _offset++;
+                            } else {
+                                _offset = _base;
+                            }
+                        }
+
+                        if (_offset == _base) {
+                            Identifier identifier;
+                            identifier.Label = _label;
+                            identifier.Sequence = _sequence;
+
+                            if (_label == SwitchLabel) {
+                                // All that follows this frame, carries a sequence.
+                                _sequenced = true;
+                            }
+
+                            _current = Element(identifier);
                             _label = 0;
+                            _sequence = 0;
                         }
                     }
 
-                    ASSERT((_offset - 8) <= _length);
+                    if (_offset >= _base) {
+                        ASSERT((_offset - _base) <= _length);
 
-                    if ((_offset - 8) < _length) {
+                        if ((_offset - _base) < _length) {
 
-                        // There could be multiple packages in this frame, do not read/handle more than what fits in the frame.
-                        uint16_t handled((maxLength - result) > static_cast<uint16_t>(_length - (_offset - 8)) ? static_cast<uint16_t>(_length - (_offset - 8)) : (maxLength - result));
+                            // There could be multiple packages in this frame, do not read/handle more than what fits in the frame.
+                            uint16_t handled((maxLength - result) > static_cast<uint16_t>(_length - (_offset - _base)) ? static_cast<uint16_t>(_length - (_offset - _base)) : (maxLength - result));
 
-                        if (_current != nullptr) {
-                            handled = _current->Deserialize(&stream[result], handled, _offset - 8);
-                        }
+                            if (_current != nullptr) {
+                                handled = _current->Deserialize(&stream[result], handled, _offset - _base);
+                            }
 
-                        _offset += handled;
-                        result += handled;
-                    }
+                            _offset += handled;
+                            result += handled;
+                        }
 
-                    ASSERT((_offset - 8) <= _length);
+                        ASSERT((_offset - _base) <= _length);
 
-                    if ((_offset - 8) == _length) {
-                        if (_current != nullptr) {
-                            IMessage* ready = _current;
-                            _current = nullptr;
-                            Deserialized(*ready);
+                        if ((_offset - _base) == _length) {
+                            if (_current != nullptr) {
+                                IMessage* ready = _current;
+                                _current = nullptr;
+                                Deserialized(*ready);
+                            }
+                            _offset = 0;
+                            _length = 0;
+                            _base = 8;
                         }
-                        _offset = 0;
-                        _length = 0;
                     }
                 }
                 return (result);
@@ -231,7 +313,10 @@ namespace Core {
         private:
             uint32_t _length;
             uint32_t _offset;
+            uint32_t _base;
             uint32_t _label;
+            uint32_t _sequence;
+            bool _sequenced;
             IMessage* _current;
         };
 
@@ -239,6 +324,7 @@ namespace Core {
         virtual ~IMessage() = default;
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
         virtual uint32_t Length() const = 0;
         virtual uint16_t Serialize(uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) const = 0;
         virtual uint16_t Deserialize(const uint8_t[] /* stream*/, const uint16_t /* maxLength */, const uint32_t offset) = 0;
@@ -248,6 +334,8 @@ namespace Core {
         virtual ~IIPC() = default;
 
         virtual uint32_t Label() const = 0;
+        virtual uint32_t Sequence() const = 0;
+        virtual void Sequence(const uint32_t sequence) = 0;
         virtual ProxyType<IMessage> IParameters() = 0;
         virtual ProxyType<IMessage> IResponse() = 0;
     };
@@ -303,6 +391,10 @@ namespace Core {
             {
                 return (REALIDENTIFIER);
             }
+            uint32_t Sequence() const override
+            {
+                return (_parent.Sequence());
+            }
             uint32_t Length() const override
             {
                 return (_Length());
@@ -415,11 +507,13 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         IPCMessageType()
             : _parameters(*this)
             , _response(*this)
+            , _sequence(0)
         {
         }
         IPCMessageType(const PARAMETERS& info)
             : _parameters(*this, info)
             , _response(*this)
+            , _sequence(0)
         {
         }
 POP_WARNING()
@@ -449,6 +543,14 @@ POP_WARNING()
         {
             return (IDENTIFIER);
         }
+        virtual uint32_t Sequence() const
+        {
+            return (_sequence);
+        }
+        virtual void Sequence(const uint32_t sequence)
+        {
+            _sequence = sequence;
+        }
         virtual ProxyType<IMessage> IParameters()
         {
             return (ProxyType<IMessage>(_parameters, _parameters));
@@ -461,19 +563,76 @@ POP_WARNING()
     private:
         ParameterType _parameters;
         ResponseType _response;
+        uint32_t _sequence;
     };
 
     class EXTERNAL IPCChannel {
+    private:
+        // The HELLO and SWITCH frames, used to negotiate the sequences, have no payload.
+        class ControlMessage : public IMessage {
+        public:
+            ControlMessage() = delete;
+            ControlMessage(const ControlMessage&) = delete;
+            ControlMessage& operator=(const ControlMessage&) = delete;
+
+            ControlMessage(const uint32_t label)
+                : _label(label)
+            {
+            }
+            ~ControlMessage() override = default;
+
+        public:
+            uint32_t Label() const override
+            {
+                return (_label);
+            }
+            uint32_t Sequence() const override
+            {
+                return (0);
+            }
+            uint32_t Length() const override
+            {
+                return (0);
+            }
+            uint16_t Serialize(uint8_t[] /* stream */, const uint16_t /* maxLength */, const uint32_t /* offset */) const override
+            {
+                return (0);
+            }
+            uint16_t Deserialize(const uint8_t[] /* stream */, const uint16_t /* maxLength */, const uint32_t /* offset */) override
+            {
+                return (0);
+            }
+
+        private:
+            const uint32_t _label;
+        };
+
     public:
         class EXTERNAL IPCFactory {
         private:
             friend IPCChannel;
 
+            struct Outbound {
+                Outbound(const Core::ProxyType<IIPC>& message, IDispatchType<IIPC>* callback)
+                    : Message(message)
+                    , Callback(callback)
+                {
+                }
+
+                Core::ProxyType<IIPC> Message;
+                IDispatchType<IIPC>* Callback;
+            };
+
+            typedef std::map<uint32_t, Outbound> Outbounds;
+
             IPCFactory()
                 : _lock()
                 , _inbound()
-                , _outbound()
-                , _callback(nullptr)
+                , _outbounds()
+                , _sequence(0)
+                , _sequenced(0)
+                , _hello(ProxyType<ControlMessage>::Create(IMessage::HelloLabel))
+                , _switch(ProxyType<ControlMessage>::Create(IMessage::SwitchLabel))
                 , _factory()
                 , _handlers()
             {
@@ -486,14 +645,23 @@ POP_WARNING()
             }
 
         public:
+            // Directions in which the frames carry a sequence.
+            enum direction : uint8_t {
+                INBOUND = 0x01,
+                OUTBOUND = 0x02
+            };
+
             IPCFactory(const IPCFactory& copy) = delete;
             IPCFactory& operator=(const IPCFactory&) = delete;
 
             IPCFactory(Core::ProxyType<FactoryType<IIPC, uint32_t>>& factory)
                 : _lock()
                 , _inbound()
-                , _outbound()
-                , _callback(nullptr)
+                , _outbounds()
+                , _sequence(0)
+                , _sequenced(0)
+                , _hello(ProxyType<ControlMessage>::Create(IMessage::HelloLabel))
+                , _switch(ProxyType<ControlMessage>::Create(IMessage::SwitchLabel))
                 , _factory(factory)
                 , _handlers()
             {
@@ -546,19 +714,58 @@ POP_WARNING()
 
             inline bool InProgress() const
             {
-                return (_outbound.IsValid());
+                _lock.Lock();
+
+                bool result = (_outbounds.empty() == false);
+
+                _lock.Unlock();
+
+                return (result);
+            }
+
+            // Only if the frames carry a sequence in both directions, responses can
+            // be matched on it and more than one invoke can be outstanding.
+            inline bool IsSequenced() const
+            {
+                _lock.Lock();
+
+                bool result = (_sequenced == (INBOUND | OUTBOUND));
+
+                _lock.Unlock();
+
+                return (result);
             }
 
-            inline ProxyType<IMessage> Element(const uint32_t& identifier)
+            inline void Sequenced(const direction way)
+            {
+                _lock.Lock();
+
+                _sequenced |= way;
+
+                _lock.Unlock();
+            }
+
+            inline ProxyType<IMessage> Control(const uint32_t label) const
+            {
+                ASSERT(IMessage::IsControl(label) == true);
+
+                return (label == IMessage::HelloLabel ? _hello : _switch);
+            }
+
+            inline ProxyType<IMessage> Element(const IMessage::Identifier& identifier)
             {
                 ProxyType<IMessage> result;
-                uint32_t searchIdentifier(identifier >> 1);
+                uint32_t searchIdentifier(identifier.Label >> 1);
 
                 _lock.Lock();
 
-                if (identifier & 0x01) {
-                    if ((_outbound.IsValid() == true) && (_outbound->Label() == searchIdentifier)) {
-                        result = _outbound->IResponse();
+                if (IMessage::IsControl(identifier.Label) == true) {
+                    result = Control(identifier.Label);
+                } else if (identifier.Label & 0x01) {
+                    Outbounds::iterator index(Find(searchIdentifier, identifier.Sequence));
+
+                    if (index != _outbounds.end()) {
+                        result = index->second.Message->IResponse();
                     } else {
                         TRACE_L1("Unexpected response message for ID [%d].\n", searchIdentifier);
                     }
@@ -568,6 +775,8 @@ POP_WARNING()
                     ProxyType<IIPC> rpcCall(_factory->Element(searchIdentifier));
 
                     if (rpcCall.IsValid() == true) {
+                        // The response goes out with the sequence of the request.
+                        rpcCall->Sequence(identifier.Sequence);
                         _inbound = rpcCall;
                         result = rpcCall->IParameters();
                     } else {
@@ -586,11 +795,9 @@ POP_WARNING()
 
                 TRACE_L1("Flushing the IPC mechanims. %d", __LINE__);
 
-                _callback = nullptr;
+                _outbounds.clear();
+                _sequenced = 0;
 
-                if (_outbound.IsValid() == true) {
-                    _outbound.Release();
-                }
                 if (_inbound.IsValid() == true) {
                     _inbound.Release();
                 }
@@ -604,15 +811,17 @@ POP_WARNING()
 
                 _lock.Lock();
 
-                if ((_outbound.IsValid() == true) && (_outbound->IResponse() == rhs)) {
+                Outbounds::iterator index(_outbounds.find(rhs->Sequence()));
+
+                if ((index != _outbounds.end()) && (index->second.Message->IResponse() == rhs)) {
 
-                    ASSERT(_callback != nullptr);
+                    ASSERT(index->second.Callback != nullptr);
 
-                    ProxyType<IIPC> handledObject(_outbound);
+                    ProxyType<IIPC> handledObject(index->second.Message);
+                    IDispatchType<IIPC>* callback(index->second.Callback);
 
-                    _outbound.Release();
-                    _callback->Dispatch(*handledObject);
-                    _callback = nullptr;
+                    _outbounds.erase(index);
+                    callback->Dispatch(*handledObject);
                 }
                 // If this is *NOT* the outbound call, it is inbound and thus it must have been registered
                 else if (_inbound.IsValid() == true) {
@@ -643,10 +852,16 @@ POP_WARNING()
                 _lock.Lock();
 
                 ASSERT((outbound.IsValid() == true) && (callback != nullptr));
-                ASSERT((_outbound.IsValid() == false) && (_callback == nullptr));
+                ASSERT((_outbounds.empty() == true) || (IsSequenced() == true));
 
-                _outbound = outbound;
-                _callback = callback;
+                // The sequence is a varint of at most 4 bytes on the line, 0 means "none".
+                _sequence = (_sequence >= 0x1FFFFFFF ? 1 : _sequence + 1);
+
+                outbound->Sequence(_sequence);
+
+                _outbounds.emplace(std::piecewise_construct,
+                    std::forward_as_tuple(_sequence),
+                    std::forward_as_tuple(outbound, callback));
 
                 _lock.Unlock();
             }
@@ -657,18 +872,40 @@ POP_WARNING()
 
                 _lock.Lock();
 
-                if (_outbound.IsValid() == true) {
+                Outbounds::iterator index(_outbounds.begin());
 
+                while (index != _outbounds.end()) {
                     result = true;
 
-                    if (_callback != nullptr) {
-                        _callback->Dispatch(*_outbound);
-                        _callback = nullptr;
+                    if (index->second.Callback != nullptr) {
+                        index->second.Callback->Dispatch(*(index->second.Message));
                     }
 
-                    _outbound.Release();
-                } else {
-                    ASSERT(_callback == nullptr);
+                    index = _outbounds.erase(index);
+                }
+
+                _lock.Unlock();
+
+                return (result);
+            }
+
+            inline bool AbortOutbound(const Core::ProxyType<IIPC>& outbound)
+            {
+                bool result = false;
+
+                _lock.Lock();
+
+                Outbounds::iterator index(_outbounds.find(outbound->Sequence()));
+
+                if ((index != _outbounds.end()) && (index->second.Message == outbound)) {
+
+                    result = true;
+
+                    if (index->second.Callback != nullptr) {
+                        index->second.Callback->Dispatch(*outbound);
+                    }
+
+                    _outbounds.erase(index);
                 }
 
                 _lock.Unlock();
@@ -676,11 +913,38 @@ POP_WARNING()
                 return (result);
             }
 
+        private:
+            Outbounds::iterator Find(const uint32_t label, const uint32_t sequence)
+            {
+                Outbounds::iterator index;
+
+                if (sequence != 0) {
+                    index = _outbounds.find(sequence);
+
+                    if ((index != _outbounds.end()) && (index->second.Message->Label() != label)) {
+                        index = _outbounds.end();
+                    }
+                } else {
+                    // A response without a sequence, belongs to a request that was sent out
+                    // without one, and that can only be the oldest one with this label.
+                    index = _outbounds.begin();
+
+                    while ((index != _outbounds.end()) && (index->second.Message->Label() != label)) {
+                        index++;
+                    }
+                }
+
+                return (index);
+            }
+
         private:
             mutable CriticalSection _lock;
             Core::ProxyType<IIPC> _inbound;
-            mutable Core::ProxyType<IIPC> _outbound;
-            IDispatchType<IIPC>* _callback;
+            Outbounds _outbounds;
+            uint32_t _sequence;
+            uint8_t _sequenced;
+            ProxyType<IMessage> _hello;
+            ProxyType<IMessage> _switch;
             Core::ProxyType<FactoryType<IIPC, uint32_t>> _factory;
             std::map<uint32_t, ProxyType<IIPCServer>> _handlers;
         };
@@ -741,11 +1005,24 @@ POP_WARNING()
             return (Execute(command, waitTime));
         }
 
+        // Send out the parameters of a message without expecting, or waiting for, a response.
+        template <typename ACTUALELEMENT>
+        inline uint32_t Post(ProxyType<ACTUALELEMENT>& command)
+        {
+            Core::ProxyType<IIPC> base(command);
+            return (Notify(base));
+        }
+        inline uint32_t Post(ProxyType<Core::IIPC>& command)
+        {
+            return (Notify(command));
+        }
+
         virtual uint32_t ReportResponse(Core::ProxyType<IIPC>& inbound) = 0;
 
     private:
         virtual uint32_t Execute(ProxyType<IIPC>& command, IDispatchType<IIPC>* completed) = 0;
         virtual uint32_t Execute(ProxyType<IIPC>& command, const uint32_t waitTime) = 0;
+        virtual uint32_t Notify(ProxyType<IIPC>& command) = 0;
 
     protected:
         IPCFactory _administration;
@@ -784,13 +1061,21 @@ POP_WARNING()
             // Notification of a INBOUND element received.
             void Received(Core::ProxyType<IMessage>& message) override
             {
+                if (message->Label() == IMessage::HelloLabel) {
+                    // The other side understands sequences, from now on we send them.
+                    BaseClass::Submit(_factory.Control(IMessage::SwitchLabel));
+                    _factory.Sequenced(IPCFactory::OUTBOUND);
+                } else if (message->Label() == IMessage::SwitchLabel) {
+                    // From now on, all that comes in carries a sequence.
+                    _factory.Sequenced(IPCFactory::INBOUND);
+                } else {
+                    Core::ProxyType<IIPC> inbound;
+                    ProxyType<IIPCServer> handler(_factory.ReceivedMessage(message, inbound));
 
-                Core::ProxyType<IIPC> inbound;
-                ProxyType<IIPCServer> handler(_factory.ReceivedMessage(message, inbound));
-
-                if (handler.IsValid() == true) {
-                    _parent.CallProcedure(handler, inbound);
-                } 
+                    if (handler.IsValid() == true) {
+                        _parent.CallProcedure(handler, inbound);
+                    }
+                }
             }
 
             // Notification of a Response send.
@@ -806,6 +1091,11 @@ POP_WARNING()
                     // Whatever s hapening, Flush what we were doing..
                     _parent.Abort();
                     _factory.Flush();
+                    BaseClass::Reset();
+                } else if (_parent.Source().IsListening() == false) {
+                    // Offer the sequences. If the other side does not know the HELLO, it drops
+                    // it as an unknown message and we stay with one invoke at a time.
+                    BaseClass::Submit(_factory.Control(IMessage::HelloLabel));
                 }
 
                 _parent.StateChange();
@@ -821,8 +1111,9 @@ POP_WARNING()
             IPCTrigger(const IPCTrigger&) = delete;
             IPCTrigger& operator=(const IPCTrigger&) = delete;
 
-            IPCTrigger(IPCFactory& administration)
+            IPCTrigger(IPCFactory& administration, const ProxyType<IIPC>& command)
                 : _administration(administration)
+                , _command(command)
                 , _signal(false, true)
             {
             }
@@ -835,10 +1126,10 @@ POP_WARNING()
 
                 // Now we wait for ever, to get a signal that we are done :-)
                 if (_signal.Lock(waitTime) != Core::ERROR_NONE) {
-                    _administration.AbortOutbound();
+                    _administration.AbortOutbound(_command);
 
                     result = Core::ERROR_TIMEDOUT;
-                } else if (_administration.AbortOutbound() == true) {
+                } else if (_administration.AbortOutbound(_command) == true) {
                     result = Core::ERROR_ASYNC_FAILED;
                 }
 
@@ -851,6 +1142,7 @@ POP_WARNING()
 
         private:
             IPCFactory& _administration;
+            const ProxyType<IIPC>& _command;
             Event _signal;
         };
 
@@ -934,7 +1226,7 @@ POP_WARNING()
 
             _serialize.Lock();
 
-            if (_administration.InProgress() == true) {
+            if ((_administration.InProgress() == true) && (_administration.IsSequenced() == false)) {
                 success = Core::ERROR_INPROGRESS;
             } else if (_link.IsOpen() == true) {
                 // We need to accept a CONST object to avoid an additional object creation
@@ -954,11 +1246,16 @@ POP_WARNING()
         uint32_t Execute(ProxyType<IIPC>& command, const uint32_t waitTime) override
         {
             uint32_t success = Core::ERROR_CONNECTION_CLOSED;
+            IPCTrigger sink(_administration, command);
 
             _serialize.Lock();
 
-            if (_link.IsOpen() == true) {
-                IPCTrigger sink(_administration);
+            if (_link.IsOpen() == false) {
+                _serialize.Unlock();
+            } else {
+                // If the response is matched on its sequence, other invokes do not
+                // have to wait for this round trip, only for the submit.
+                const bool pipelined = _administration.IsSequenced();
 
                 // We need to accept a CONST object to avoid an additional object creation
                 // proxy casted objects.
@@ -967,7 +1264,33 @@ POP_WARNING()
                 // Send out the
                 _link.Submit(command->IParameters());
 
-                success = sink.Wait(waitTime);
+                if (pipelined == true) {
+                    _serialize.Unlock();
+
+                    success = sink.Wait(waitTime);
+                } else {
+                    success = sink.Wait(waitTime);
+
+                    _serialize.Unlock();
+                }
+            }
+
+            return (success);
+        }
+        uint32_t Notify(ProxyType<IIPC>& command) override
+        {
+            uint32_t success = Core::ERROR_CONNECTION_CLOSED;
+
+            _serialize.Lock();
+
+            if (_link.IsOpen() == true) {
+                // Nothing will come back for this message, so it is not registered as an
+                // outbound and carries no sequence to match a response on.
+                command->Sequence(0);
+
+                _link.Submit(command->IParameters());
+
+                success = Core::ERROR_NONE;
             }
 
             _serialize.Unlock();
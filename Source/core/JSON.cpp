@@ -19,12 +19,247 @@
 
 #include "JSON.h"
 #include <iomanip>
+#include <memory>
 #include <sstream>
+#include <typeindex>
+#include <unordered_map>
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#include <immintrin.h>
+#define __JSON_SCANNER_SSE2__
+#define __JSON_SCANNER_AVX2__
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <arm_neon.h>
+#define __JSON_SCANNER_NEON__
+#endif
 
 namespace WPEFramework {
 namespace Core {
     namespace JSON {
 
+        namespace {
+
+            // 9 up to 13 are \t, \n, \v, \f and \r
+            inline bool IsSpace(const char character)
+            {
+                return ((character == ' ') || (static_cast<uint8_t>(character - 9) <= 4));
+            }
+
+            inline bool IsPlain(const char character)
+            {
+                return ((character != '\"') && (character != '\\'));
+            }
+
+            uint16_t WhitespaceScalar(const char stream[], const uint16_t length)
+            {
+                uint16_t index = 0;
+
+                while ((index < length) && (IsSpace(stream[index]) == true)) {
+                    index++;
+                }
+
+                return (index);
+            }
+
+            uint16_t PlainScalar(const char stream[], const uint16_t length)
+            {
+                uint16_t index = 0;
+
+                while ((index < length) && (IsPlain(stream[index]) == true)) {
+                    index++;
+                }
+
+                return (index);
+            }
+
+#ifdef __JSON_SCANNER_SSE2__
+            // Per block, a bit per character that does (not) belong to the run.
+            inline uint32_t SpaceMask(const __m128i block)
+            {
+                const __m128i control = _mm_sub_epi8(block, _mm_set1_epi8(9));
+                const __m128i isControl = _mm_cmpeq_epi8(_mm_min_epu8(control, _mm_set1_epi8(4)), control);
+                const __m128i isSpace = _mm_cmpeq_epi8(block, _mm_set1_epi8(' '));
+
+                return (static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(isControl, isSpace))));
+            }
+
+            inline uint32_t SpecialMask(const __m128i block)
+            {
+                const __m128i quote = _mm_cmpeq_epi8(block, _mm_set1_epi8('\"'));
+                const __m128i backslash = _mm_cmpeq_epi8(block, _mm_set1_epi8('\\'));
+
+                return (static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(quote, backslash))));
+            }
+
+            uint16_t WhitespaceSSE2(const char stream[], const uint16_t length)
+            {
+                uint16_t index = 0;
+
+                while ((index + 16) <= length) {
+                    const uint32_t mask = (~SpaceMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&(stream[index]))))) & 0xFFFF;
+
+                    if (mask != 0) {
+                        return (index + static_cast<uint16_t>(__builtin_ctz(mask)));
+                    }
+                    index += 16;
+                }
+
+                return (index + WhitespaceScalar(&(stream[index]), length - index));
+            }
+
+            uint16_t PlainSSE2(const char stream[], const uint16_t length)
+            {
+                uint16_t index = 0;
+
+                while ((index + 16) <= length) {
+                    const uint32_t mask = SpecialMask(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&(stream[index]))));
+
+                    if (mask != 0) {
+                        return (index + static_cast<uint16_t>(__builtin_ctz(mask)));
+                    }
+                    index += 16;
+                }
+
+                return (index + PlainScalar(&(stream[index]), length - index));
+            }
+#endif
+
+#ifdef __JSON_SCANNER_AVX2__
+            __attribute__((target("avx2"))) uint16_t WhitespaceAVX2(const char stream[], const uint16_t length)
+            {
+                uint16_t index = 0;
+
+                while ((index + 32) <= length) {
+                    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&(stream[index])));
+                    const __m256i control = _mm256_sub_epi8(block, _mm256_set1_epi8(9));
+                    const __m256i isControl = _mm256_cmpeq_epi8(_mm256_min_epu8(control, _mm256_set1_epi8(4)), control);
+                    const __m256i isSpace = _mm256_cmpeq_epi8(block, _mm256_set1_epi8(' '));
+                    const uint32_t mask = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(isControl, isSpace)));
+
+                    if (mask != 0) {
+                        return (index + static_cast<uint16_t>(__builtin_ctz(mask)));
+                    }
+                    index += 32;
+                }
+
+                return (index + WhitespaceSSE2(&(stream[index]), length - index));
+            }
+
+            __attribute__((target("avx2"))) uint16_t PlainAVX2(const char stream[], const uint16_t length)
+            {
+                uint16_t index = 0;
+
+                while ((index + 32) <= length) {
+                    const __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&(stream[index])));
+                    const __m256i quote = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\"'));
+                    const __m256i backslash = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\\'));
+                    const uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(quote, backslash)));
+
+                    if (mask != 0) {
+                        return (index + static_cast<uint16_t>(__builtin_ctz(mask)));
+                    }
+                    index += 32;
+                }
+
+                return (index + PlainSSE2(&(stream[index]), length - index));
+            }
+#endif
+
+#ifdef __JSON_SCANNER_NEON__
+            uint16_t WhitespaceNEON(const char stream[], const uint16_t length)
+            {
+                uint16_t index = 0;
+
+                while ((index + 16) <= length) {
+                    const uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(&(stream[index])));
+                    const uint8x16_t isSpace = vorrq_u8(vceqq_u8(block, vdupq_n_u8(' ')), vcleq_u8(vsubq_u8(block, vdupq_n_u8(9)), vdupq_n_u8(4)));
+
+                    if (vminvq_u8(isSpace) == 0) {
+                        // There is a non space in this block, it is in the first 16 characters.
+                        return (index + WhitespaceScalar(&(stream[index]), 16));
+                    }
+                    index += 16;
+                }
+
+                return (index + WhitespaceScalar(&(stream[index]), length - index));
+            }
+
+            uint16_t PlainNEON(const char stream[], const uint16_t length)
+            {
+                uint16_t index = 0;
+
+                while ((index + 16) <= length) {
+                    const uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t*>(&(stream[index])));
+                    const uint8x16_t special = vorrq_u8(vceqq_u8(block, vdupq_n_u8('\"')), vceqq_u8(block, vdupq_n_u8('\\')));
+
+                    if (vmaxvq_u8(special) != 0) {
+                        // There is a quote or backslash in this block, it is in the first 16 characters.
+                        return (index + PlainScalar(&(stream[index]), 16));
+                    }
+                    index += 16;
+                }
+
+                return (index + PlainScalar(&(stream[index]), length - index));
+            }
+#endif
+
+            class ScannerImplementation {
+            public:
+                ScannerImplementation(const ScannerImplementation&) = delete;
+                ScannerImplementation& operator=(const ScannerImplementation&) = delete;
+
+                ScannerImplementation()
+                    : Whitespace(WhitespaceScalar)
+                    , Plain(PlainScalar)
+                    , Name(_T("scalar"))
+                {
+#if defined(__JSON_SCANNER_AVX2__)
+                    if (__builtin_cpu_supports("avx2")) {
+                        Whitespace = WhitespaceAVX2;
+                        Plain = PlainAVX2;
+                        Name = _T("AVX2");
+                    } else {
+                        Whitespace = WhitespaceSSE2;
+                        Plain = PlainSSE2;
+                        Name = _T("SSE2");
+                    }
+#elif defined(__JSON_SCANNER_NEON__)
+                    Whitespace = WhitespaceNEON;
+                    Plain = PlainNEON;
+                    Name = _T("NEON");
+#endif
+                }
+                ~ScannerImplementation() = default;
+
+                static const ScannerImplementation& Instance()
+                {
+                    static const ScannerImplementation singleton;
+
+                    return (singleton);
+                }
+
+            public:
+                uint16_t (*Whitespace)(const char[], const uint16_t);
+                uint16_t (*Plain)(const char[], const uint16_t);
+                const TCHAR* Name;
+            };
+        }
+
+        /* static */ uint16_t Scanner::Whitespace(const char stream[], const uint16_t length)
+        {
+            return (ScannerImplementation::Instance().Whitespace(stream, length));
+        }
+
+        /* static */ uint16_t Scanner::Plain(const char stream[], const uint16_t length)
+        {
+            return (ScannerImplementation::Instance().Plain(stream, length));
+        }
+
+        /* static */ const TCHAR* Scanner::Implementation()
+        {
+            return (ScannerImplementation::Instance().Name);
+        }
+
         string ErrorDisplayMessage(const Error& err)
         {
             string msg;
@@ -38,6 +273,35 @@ namespace Core {
 
         /* static */ constexpr size_t Error::kContextMaxLength;
 
+        // The innermost Retain scope of the calling thread.
+        static thread_local String::Retain* _retained = nullptr;
+
+        String::Retain::Retain(const string& buffer)
+            : _begin(buffer.c_str())
+            , _end(buffer.c_str() + buffer.length() + 1) // The terminator may be passed to the deserializer as well
+            , _previous(_retained)
+        {
+            _retained = this;
+        }
+
+        String::Retain::~Retain()
+        {
+            ASSERT(_retained == this);
+
+            _retained = _previous;
+        }
+
+        /* static */ bool String::Retain::Covers(const TCHAR begin[], const uint32_t length)
+        {
+            const Retain* scope = _retained;
+
+            while ((scope != nullptr) && ((begin < scope->_begin) || ((begin + length) > scope->_end))) {
+                scope = scope->_previous;
+            }
+
+            return (scope != nullptr);
+        }
+
         /* static */ char IElement::NullTag[5] = { 'n', 'u', 'l', 'l', '\0' };
         /* static */ char IElement::TrueTag[5] = { 't', 'r', 'u', 'e', '\0' };
         /* static */ char IElement::FalseTag[6] = { 'f', 'a', 'l', 's', 'e', '\0' };
@@ -79,6 +343,88 @@ namespace Core {
                 ss << iterator.Current().GetDebugString(iterator.Label(), indent);
             return ss.str();
         }
+
+        Container::Index::Index(const JSONElementList& data)
+            : _labels()
+            , _slots()
+            , _seed(0)
+            , _mask(0)
+        {
+            ASSERT(data.size() < NotFound);
+
+            for (const JSONLabelValue& entry : data) {
+                _labels.emplace_back(entry.first);
+            }
+
+            // Twice as many slots as labels, and look for a seed that gives every label its own slot.
+            uint32_t size = 8;
+            while (size < (2 * _labels.size())) {
+                size <<= 1;
+            }
+
+            bool perfect = false;
+
+            while (perfect == false) {
+                _mask = size - 1;
+
+                for (_seed = 0; (_seed < 256) && (perfect == false); _seed++) {
+                    _slots.assign(size, Slot{ NotFound, 0 });
+                    perfect = true;
+
+                    for (uint16_t position = 0; (position < _labels.size()) && (perfect == true); position++) {
+                        const uint16_t length = static_cast<uint16_t>(_labels[position].length());
+                        Slot& slot(_slots[Hash(_labels[position].c_str(), length, _seed) & _mask]);
+
+                        if (slot.Position == NotFound) {
+                            slot.Position = position;
+                            slot.Length = length;
+                        } else {
+                            // A duplicate label does not need a slot, the first one is found first anyway.
+                            perfect = (_labels[slot.Position] == _labels[position]);
+                        }
+                    }
+                }
+
+                if (perfect == true) {
+                    _seed--;
+                } else {
+                    size <<= 1;
+                }
+            }
+        }
+
+        /* static */ const Container::Index* Container::Index::Instance(const std::type_info& type, const JSONElementList& data)
+        {
+            static CriticalSection lock;
+            static std::unordered_map<std::type_index, std::unique_ptr<const Index>> indexes;
+
+            lock.Lock();
+
+            std::unique_ptr<const Index>& index(indexes[std::type_index(type)]);
+
+            if (index == nullptr) {
+                index.reset(new Index(data));
+            }
+
+            const Index* result = index.get();
+
+            lock.Unlock();
+
+            return (result);
+        }
+
+        bool Container::Index::Matches(const JSONElementList& data) const
+        {
+            uint16_t position = 0;
+
+            if (data.size() == _labels.size()) {
+                while ((position < _labels.size()) && (_labels[position] == data[position].first)) {
+                    position++;
+                }
+            }
+
+            return (position == data.size());
+        }
     }
 }
 
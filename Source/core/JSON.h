@@ -21,6 +21,8 @@
 #define __JSON_H
 
 #include <map>
+#include <memory>
+#include <typeinfo>
 #include <vector>
 
 #include "Enumerate.h"
@@ -83,6 +85,29 @@ namespace Core {
 
         string EXTERNAL ErrorDisplayMessage(const Error& err);
 
+        // Helpers for the deserializers, to step over a run of characters that does not
+        // change their state in one go, instead of one character per iteration. They look
+        // at blocks of 16 or 32 characters at once, with the vector instructions (AVX2,
+        // SSE2 or NEON) the CPU supports, picked at runtime. They only look ahead in the
+        // chunk they are given, so the chunked deserialization works as before.
+        struct EXTERNAL Scanner {
+            // Number of leading whitespace characters (as in ::isspace).
+            static uint16_t Whitespace(const char stream[], const uint16_t length);
+
+            // Number of leading characters that can be copied into a string value as is,
+            // so up to the first quote or backslash.
+            static uint16_t Plain(const char stream[], const uint16_t length);
+
+            // The instruction set the scanning is done with.
+            static const TCHAR* Implementation();
+
+            static inline uint16_t SkipWhitespace(const char stream[], const uint16_t length)
+            {
+                // Most runs are empty or a single space, those are not worth a call.
+                return (((length == 0) || (::isspace(stream[0]) == 0)) ? 0 : (((length == 1) || (::isspace(stream[1]) == 0)) ? 1 : Whitespace(stream, length)));
+            }
+        };
+
         struct EXTERNAL IElement {
 
             static TCHAR NullTag[5];
@@ -1480,10 +1505,37 @@ namespace Core {
                 SQUARE_BRACKET = 1
             };
 
+        public:
+            // Zero copy deserialization, opt-in. While a Retain scope for a buffer is alive,
+            // Strings deserialized on the same thread from that buffer, that contain no
+            // escapes, reference the buffer instead of copying their value out of it. Such
+            // a String takes a copy of its own, as soon as it is changed, copied or
+            // assigned, so the buffer must outlive the deserialized object (e.g. both
+            // are owned by the same message), not its copies.
+            class EXTERNAL Retain {
+            public:
+                Retain() = delete;
+                Retain(const Retain&) = delete;
+                Retain& operator=(const Retain&) = delete;
+
+                explicit Retain(const string& buffer);
+                ~Retain();
+
+            public:
+                static bool Covers(const TCHAR begin[], const uint32_t length);
+
+            private:
+                const TCHAR* _begin;
+                const TCHAR* _end;
+                Retain* _previous;
+            };
+
         public:
             explicit String(const bool quoted = true)
                 : _default()
                 , _value()
+                , _view(nullptr)
+                , _viewLength(0)
                 , _storage(0)
                 , _flagsAndCounters(quoted ? QuotedSerializeBit : 0)
             {
@@ -1492,6 +1544,8 @@ namespace Core {
             explicit String(const string& Value, const bool quoted = true)
                 : _default()
                 , _value()
+                , _view(nullptr)
+                , _viewLength(0)
                 , _storage(0)
                 , _flagsAndCounters(quoted ? QuotedSerializeBit : 0)
             {
@@ -1501,6 +1555,8 @@ namespace Core {
             explicit String(const char Value[], const bool quoted = true)
                 : _default()
                 , _value()
+                , _view(nullptr)
+                , _viewLength(0)
                 , _storage(0)
                 , _flagsAndCounters(quoted ? QuotedSerializeBit : 0)
             {
@@ -1511,6 +1567,8 @@ namespace Core {
             explicit String(const wchar_t Value[], const bool quoted = true)
                 : _default()
                 , _value()
+                , _view(nullptr)
+                , _viewLength(0)
                 , _storage(0)
                 , _flagsAndCounters(quoted ? QuotedSerializeBit : 0)
             {
@@ -1520,7 +1578,9 @@ namespace Core {
 
             String(const String& copy)
                 : _default(copy._default)
-                , _value(copy._value)
+                , _value(copy._view == nullptr ? copy._value : string(copy._view, copy._viewLength))
+                , _view(nullptr)
+                , _viewLength(0)
                 , _storage(copy._storage)
                 , _flagsAndCounters(copy._flagsAndCounters)
             {
@@ -1531,6 +1591,7 @@ namespace Core {
             String& operator=(const string& RHS)
             {
                 Core::ToString(RHS.c_str(), _value);
+                _view = nullptr;
                 _flagsAndCounters |= SetBit;
 
                 return (*this);
@@ -1539,6 +1600,7 @@ namespace Core {
             String& operator=(const char RHS[])
             {
                 Core::ToString(RHS, _value);
+                _view = nullptr;
                 _flagsAndCounters |= SetBit;
 
                 return (*this);
@@ -1548,6 +1610,7 @@ namespace Core {
             String& operator=(const wchar_t RHS[])
             {
                 Core::ToString(RHS, _value);
+                _view = nullptr;
                 _flagsAndCounters |= SetBit;
 
                 return (*this);
@@ -1557,7 +1620,12 @@ namespace Core {
             String& operator=(const String& RHS)
             {
                 _default = RHS._default;
-                _value = RHS._value;
+                if (RHS._view == nullptr) {
+                    _value = RHS._value;
+                } else {
+                    _value.assign(RHS._view, RHS._viewLength);
+                }
+                _view = nullptr;
                 _flagsAndCounters = RHS._flagsAndCounters;
 
                 return (*this);
@@ -1620,9 +1688,16 @@ namespace Core {
             inline const string Value() const
             {
                 if ((_flagsAndCounters & (SetBit | QuoteFoundBit | QuotedSerializeBit)) == (SetBit | QuoteFoundBit)) {
-                    return ('\"' + Core::ToString(_value.c_str()) + '\"');
+                    return ('\"' + Text() + '\"');
                 }
-                return (((_flagsAndCounters & (SetBit | NullBit)) == SetBit) ? Core::ToString(_value.c_str()) : Core::ToString(_default.c_str()));
+                return (((_flagsAndCounters & (SetBit | NullBit)) == SetBit) ? Text() : Core::ToString(_default.c_str()));
+            }
+
+            // The value (or default) as is, without taking a copy. Valid as long as
+            // this String is not changed.
+            inline TextFragment Fragment() const
+            {
+                return (((_flagsAndCounters & (SetBit | NullBit)) == SetBit) ? TextFragment(Data(), Size()) : TextFragment(_default.c_str(), static_cast<uint32_t>(_default.length())));
             }
 
             inline const string& Default() const
@@ -1640,6 +1715,7 @@ namespace Core {
                     _flagsAndCounters &= ~(NullBit | SetBit);
                     _value.clear();
                 }
+                _view = nullptr;
             }
 
             // IElement iface:
@@ -1657,6 +1733,7 @@ namespace Core {
             {
                 _flagsAndCounters = (_flagsAndCounters & QuotedSerializeBit);
                 _value.clear();
+                _view = nullptr;
             }
 
             inline bool IsQuoted() const
@@ -1693,10 +1770,11 @@ namespace Core {
                         _flagsAndCounters &= (FlagMask ^ (SpecialSequenceBit|EscapeFoundBit));
                     }
 
-                    uint32_t length = static_cast<uint32_t>(_value.length()) - (offset - 1);
+                    const TCHAR* value = Data();
+                    uint32_t length = Size() - (offset - 1);
 
                     while ((result < maxLength) && (length > 0)) {
-                        const uint16_t current = static_cast<uint16_t>((_value[offset - 1]) & 0xFF);
+                        const uint16_t current = static_cast<uint16_t>((value[offset - 1]) & 0xFF);
                            
                         // See if this is a printable character
                         if ((isQuoted == false) || ((::isprint(current)) && (current != '\"') && (current != '\\') && (current != '/')) ) {
@@ -1722,7 +1800,7 @@ namespace Core {
                             case '"': stream[result++] = '"'; break;
                             default: {
                                 uint16_t lowPart, highPart;
-                                int8_t codeSize = ToCodePoint(&(_value[offset - 1]), length, _storage);
+                                int8_t codeSize = ToCodePoint(&(value[offset - 1]), length, _storage);
 
                                 if (codeSize < 0) {
                                     // Oops it is a bad code thingy, Skip it..
@@ -1839,11 +1917,18 @@ namespace Core {
 
                 if (offset == 0) {
                     _value.clear();
+                    _view = nullptr;
                     _flagsAndCounters &= (FlagMask ^ (SpecialSequenceBit|EscapeFoundBit|QuoteFoundBit));
                     _storage = 0;
                     if (stream[result] == '\"') {
                         result++;
                         _flagsAndCounters |= QuoteFoundBit;
+
+                        if (Reference(&(stream[result]), maxLength - result) == true) {
+                            // Got it in one go, skip the value and the closing quote.
+                            _flagsAndCounters |= SetBit;
+                            return (result + static_cast<uint16_t>(_viewLength) + 1);
+                        }
                     }
                     offset = 1;
                 }
@@ -1906,8 +1991,10 @@ namespace Core {
                             finished = true;
                         }
                         else {
-                            // Just copy, we and onto the next;
-                            _value += current;
+                            // Just copy, the whole run of plain characters at once.
+                            uint16_t run = Scanner::Plain(&(stream[result + 1]), maxLength - result - 1);
+                            _value.append(&(stream[result]), run + 1);
+                            result += run;
                         }
                         result++;
                     }
@@ -1995,15 +2082,15 @@ namespace Core {
                 if (offset == 0) {
                     if ((_flagsAndCounters & NullBit) != 0) {
                         stream[loaded++] = IMessagePack::NullValue;
-                    } else if (_value.length() <= 31) {
+                    } else if (Size() <= 31) {
                         _storage = 1;
-                        stream[loaded++] = static_cast<uint8_t>(_value.length() | 0xA0);
+                        stream[loaded++] = static_cast<uint8_t>(Size() | 0xA0);
                         offset++;
-                    } else if (_value.length() <= 0xFF) {
+                    } else if (Size() <= 0xFF) {
                         _storage = 2;
                         stream[loaded++] = 0xD9;
                         offset++;
-                    } else if (_value.length() <= 0xFFFF) {
+                    } else if (Size() <= 0xFFFF) {
                         _storage = 3;
                         stream[loaded++] = 0xDA;
                         offset++;
@@ -2014,13 +2101,14 @@ namespace Core {
 
                 if (offset != 0) {
                     while ((loaded < maxLength) && (offset < (_storage & 0x0F))) {
-                        stream[loaded++] = static_cast<uint8_t>((_value.length() >> (8 * ( (_storage & 0x0F) - offset - 1))) & 0xFF);
+                        stream[loaded++] = static_cast<uint8_t>((Size() >> (8 * ( (_storage & 0x0F) - offset - 1))) & 0xFF);
                         offset++;
                     }
 
                     uint16_t copied = 0;
                     while ((loaded < maxLength) && (offset != 0)) {
-                        copied = static_cast<uint16_t>(_value.copy(reinterpret_cast<char*>(&stream[loaded]), (maxLength - loaded), offset - (_storage & 0x0F)));
+                        copied = static_cast<uint16_t>(std::min(static_cast<uint32_t>(maxLength - loaded), Size() - (offset - (_storage & 0x0F))));
+                        ::memcpy(&stream[loaded], &(Data()[offset - (_storage & 0x0F)]), copied);
                         offset += copied;
                         loaded += copied;
                         if ((_storage & 0x0F) != 0) {
@@ -2028,7 +2116,7 @@ namespace Core {
                            _storage = 0;
                         }
 
-                        if (offset >= _value.length()) {
+                        if (offset >= Size()) {
                             offset = 0;
                         }
                     }
@@ -2042,6 +2130,7 @@ namespace Core {
                 uint16_t loaded = 0;
                 if (offset == 0) {
                     _value.clear();
+                    _view = nullptr;
                     if (stream[loaded] == IMessagePack::NullValue) {
                         _flagsAndCounters |= NullBit;
                         loaded++;
@@ -2082,9 +2171,41 @@ namespace Core {
                 return (loaded);
             }
 
+        private:
+            inline const TCHAR* Data() const
+            {
+                return (_view != nullptr ? _view : _value.c_str());
+            }
+            inline uint32_t Size() const
+            {
+                return (_view != nullptr ? _viewLength : static_cast<uint32_t>(_value.length()));
+            }
+            inline string Text() const
+            {
+                return (_view != nullptr ? string(_view, _viewLength) : Core::ToString(_value.c_str()));
+            }
+            bool Reference(const TCHAR stream[], const uint16_t maxLength)
+            {
+                if (Retain::Covers(stream, maxLength) == true) {
+                    uint16_t length = Scanner::Plain(stream, maxLength);
+
+                    // Only a value without escapes, that is complete in this chunk, can be referenced.
+                    // A quoted null, is still a null, leave that one to the regular deserialization.
+                    if ((length < maxLength) && (stream[length] == '\"') &&
+                        ((length != (sizeof(IElement::NullTag) - 1)) || (::memcmp(stream, IElement::NullTag, length) != 0))) {
+                        _view = stream;
+                        _viewLength = length;
+                    }
+                }
+
+                return (_view != nullptr);
+            }
+
         private:
             std::string _default;
             std::string _value;
+            const TCHAR* _view;
+            uint32_t _viewLength;
 
             mutable uint32_t _storage;
 
@@ -2608,6 +2729,194 @@ namespace Core {
             mutable NumberType<uint32_t, FALSE, BASE_HEXADECIMAL> _package;
         };
 
+        // Element storage of the ArrayType. Elements live in a few contiguous
+        // chunks, each chunk (at least) as large as all previous ones together,
+        // so an array of N elements costs O(log N) allocations, instead of one
+        // allocation per element. Elements are never moved once constructed, so
+        // references and Positions stay valid while elements are added.
+        // If the number of elements is known upfront, Reserve() makes it a single
+        // allocation.
+        template <typename ELEMENT>
+        class ArrayStorageType {
+        private:
+            static constexpr uint32_t MinimumChunk = 8;
+
+            struct Chunk {
+                ELEMENT* Elements;
+                uint32_t Used;
+                uint32_t Size;
+            };
+
+        public:
+            struct Position {
+                uint32_t Chunk;
+                uint32_t Offset;
+            };
+
+        public:
+            ArrayStorageType()
+                : _chunks()
+                , _fill(0)
+                , _size(0)
+            {
+            }
+            ArrayStorageType(const ArrayStorageType<ELEMENT>& copy)
+                : _chunks()
+                , _fill(0)
+                , _size(0)
+            {
+                Copy(copy);
+            }
+            ~ArrayStorageType()
+            {
+                clear();
+            }
+
+            ArrayStorageType<ELEMENT>& operator=(const ArrayStorageType<ELEMENT>& RHS)
+            {
+                if (this != &RHS) {
+                    clear();
+                    Copy(RHS);
+                }
+                return (*this);
+            }
+
+        public:
+            inline uint32_t size() const
+            {
+                return (_size);
+            }
+            inline bool empty() const
+            {
+                return (_size == 0);
+            }
+            void Reserve(const uint32_t count)
+            {
+                uint32_t available = 0;
+
+                for (uint32_t index = _fill; index < _chunks.size(); index++) {
+                    available += (_chunks[index].Size - _chunks[index].Used);
+                }
+
+                if (count > available) {
+                    Allocate(count - available);
+                }
+            }
+            template <typename... Args>
+            ELEMENT& emplace_back(Args&&... args)
+            {
+                while ((_fill < _chunks.size()) && (_chunks[_fill].Used == _chunks[_fill].Size)) {
+                    _fill++;
+                }
+                if (_fill == _chunks.size()) {
+                    // Grow geometrically, the new chunk doubles the capacity.
+                    Allocate(_size > MinimumChunk ? _size : MinimumChunk);
+                }
+
+                Chunk& chunk(_chunks[_fill]);
+                ELEMENT* element = new (&(chunk.Elements[chunk.Used])) ELEMENT(std::forward<Args>(args)...);
+                chunk.Used++;
+                _size++;
+
+                return (*element);
+            }
+            ELEMENT& back()
+            {
+                ASSERT(_size > 0);
+
+                const Chunk& chunk(_chunks[(_chunks[_fill].Used == 0) ? (_fill - 1) : _fill]);
+
+                return (chunk.Elements[chunk.Used - 1]);
+            }
+            void clear()
+            {
+                std::allocator<ELEMENT> allocator;
+
+                for (Chunk& chunk : _chunks) {
+                    for (uint32_t index = 0; index < chunk.Used; index++) {
+                        chunk.Elements[index].~ELEMENT();
+                    }
+                    allocator.deallocate(chunk.Elements, chunk.Size);
+                }
+
+                _chunks.clear();
+                _fill = 0;
+                _size = 0;
+            }
+            ELEMENT& operator[](const uint32_t index)
+            {
+                return (const_cast<ELEMENT&>(static_cast<const ArrayStorageType<ELEMENT>&>(*this)[index]));
+            }
+            const ELEMENT& operator[](const uint32_t index) const
+            {
+                uint32_t offset = index;
+                uint32_t chunk = 0;
+
+                ASSERT(index < _size);
+
+                while (offset >= _chunks[chunk].Used) {
+                    offset -= _chunks[chunk].Used;
+                    chunk++;
+                }
+
+                return (_chunks[chunk].Elements[offset]);
+            }
+
+            // Walking the elements, without the chunk lookup of the index operator.
+            inline Position Begin() const
+            {
+                return (Position { 0, 0 });
+            }
+            inline bool IsEnd(const Position& position) const
+            {
+                return ((position.Chunk >= _chunks.size()) || (position.Offset >= _chunks[position.Chunk].Used));
+            }
+            inline void Next(Position& position) const
+            {
+                ASSERT(IsEnd(position) == false);
+
+                position.Offset++;
+
+                if ((position.Offset == _chunks[position.Chunk].Size) && ((position.Chunk + 1) < _chunks.size())) {
+                    position.Chunk++;
+                    position.Offset = 0;
+                }
+            }
+            inline ELEMENT& At(const Position& position)
+            {
+                ASSERT(IsEnd(position) == false);
+
+                return (_chunks[position.Chunk].Elements[position.Offset]);
+            }
+            inline const ELEMENT& At(const Position& position) const
+            {
+                ASSERT(IsEnd(position) == false);
+
+                return (_chunks[position.Chunk].Elements[position.Offset]);
+            }
+
+        private:
+            void Allocate(const uint32_t count)
+            {
+                std::allocator<ELEMENT> allocator;
+
+                _chunks.push_back(Chunk { allocator.allocate(count), 0, count });
+            }
+            void Copy(const ArrayStorageType<ELEMENT>& copy)
+            {
+                Reserve(copy._size);
+
+                for (Position index = copy.Begin(); copy.IsEnd(index) == false; copy.Next(index)) {
+                    emplace_back(copy.At(index));
+                }
+            }
+
+        private:
+            std::vector<Chunk> _chunks;
+            uint32_t _fill;
+            uint32_t _size;
+        };
+
         template <typename ELEMENT>
         class ArrayType : public IElement, public IMessagePack {
         private:
@@ -2627,7 +2936,7 @@ namespace Core {
             template <typename ARRAYELEMENT>
             class ConstIteratorType {
             private:
-                typedef std::list<ARRAYELEMENT> ArrayContainer;
+                typedef ArrayStorageType<ARRAYELEMENT> ArrayContainer;
                 enum State {
                     AT_BEGINNING,
                     AT_ELEMENT,
@@ -2637,21 +2946,21 @@ namespace Core {
             public:
                 ConstIteratorType()
                     : _container(nullptr)
-                    , _iterator()
+                    , _position()
                     , _state(AT_BEGINNING)
                 {
                 }
 
                 ConstIteratorType(const ArrayContainer& container)
                     : _container(&container)
-                    , _iterator(container.begin())
+                    , _position(container.Begin())
                     , _state(AT_BEGINNING)
                 {
                 }
 
                 ConstIteratorType(const ConstIteratorType<ARRAYELEMENT>& copy)
                     : _container(copy._container)
-                    , _iterator(copy._iterator)
+                    , _position(copy._position)
                     , _state(copy._state)
                 {
                 }
@@ -2661,7 +2970,7 @@ namespace Core {
                 ConstIteratorType<ARRAYELEMENT>& operator=(const ConstIteratorType<ARRAYELEMENT>& RHS)
                 {
                     _container = RHS._container;
-                    _iterator = RHS._iterator;
+                    _position = RHS._position;
                     _state = RHS._state;
 
                     return (*this);
@@ -2678,23 +2987,23 @@ namespace Core {
                     _state = AT_BEGINNING;
 
                     if (_container != nullptr) {
-                        _iterator = _container->begin();
+                        _position = _container->Begin();
 
                         if (index != static_cast<uint32_t>(~0)) {
                             uint32_t position = (index + 1);
                             while (position > 0) {
-                                while ((_iterator != _container->end()) && (_iterator->IsSet() == false)) {
-                                    _iterator++;
+                                while ((_container->IsEnd(_position) == false) && (_container->At(_position).IsSet() == false)) {
+                                    _container->Next(_position);
                                 }
 
-                                if (_iterator == _container->end()) {
+                                if (_container->IsEnd(_position) == true) {
                                     position = 0;
                                 }
                                 else if (--position != 0) {
-                                    _iterator++;
+                                    _container->Next(_position);
                                 }
                             }
-                            _state = (_iterator != _container->end() ? AT_ELEMENT : AT_END);
+                            _state = (_container->IsEnd(_position) == false ? AT_ELEMENT : AT_END);
                         }
                     }
 
@@ -2706,14 +3015,14 @@ namespace Core {
                     if (_container != nullptr) {
                         if (_state != AT_END) {
                             if (_state != AT_BEGINNING) {
-                                _iterator++;
+                                _container->Next(_position);
                             }
 
-                            while ((_iterator != _container->end()) && (_iterator->IsSet() == false)) {
-                                _iterator++;
+                            while ((_container->IsEnd(_position) == false) && (_container->At(_position).IsSet() == false)) {
+                                _container->Next(_position);
                             }
 
-                            _state = (_iterator != _container->end() ? AT_ELEMENT : AT_END);
+                            _state = (_container->IsEnd(_position) == false ? AT_ELEMENT : AT_END);
                         }
                     } else {
                         _state = AT_END;
@@ -2725,7 +3034,7 @@ namespace Core {
                 {
                     ASSERT(_state == AT_ELEMENT);
 
-                    return (*_iterator);
+                    return (_container->At(_position));
                 }
 
                 inline uint32_t Count() const
@@ -2735,14 +3044,14 @@ namespace Core {
 
             private:
                 const ArrayContainer* _container;
-                typename ArrayContainer::const_iterator _iterator;
+                typename ArrayContainer::Position _position;
                 State _state;
             };
 
             template <typename ARRAYELEMENT>
             class IteratorType {
             private:
-                typedef std::list<ARRAYELEMENT> ArrayContainer;
+                typedef ArrayStorageType<ARRAYELEMENT> ArrayContainer;
                 enum State {
                     AT_BEGINNING,
                     AT_ELEMENT,
@@ -2752,21 +3061,21 @@ namespace Core {
             public:
                 IteratorType()
                     : _container(nullptr)
-                    , _iterator()
+                    , _position()
                     , _state(AT_BEGINNING)
                 {
                 }
 
                 IteratorType(ArrayContainer& container)
                     : _container(&container)
-                    , _iterator(container.begin())
+                    , _position(container.Begin())
                     , _state(AT_BEGINNING)
                 {
                 }
 
                 IteratorType(const IteratorType<ARRAYELEMENT>& copy)
                     : _container(copy._container)
-                    , _iterator(copy._iterator)
+                    , _position(copy._position)
                     , _state(copy._state)
                 {
                 }
@@ -2778,7 +3087,7 @@ namespace Core {
                 IteratorType<ARRAYELEMENT>& operator=(const IteratorType<ARRAYELEMENT>& RHS)
                 {
                     _container = RHS._container;
-                    _iterator = RHS._iterator;
+                    _position = RHS._position;
                     _state = RHS._state;
 
                     return (*this);
@@ -2795,22 +3104,23 @@ namespace Core {
                     _state = AT_BEGINNING;
 
                     if (_container != nullptr) {
-                        _iterator = _container->begin();
+                        _position = _container->Begin();
+
                         if (index != static_cast<uint32_t>(~0)) {
                             uint32_t position = (index + 1);
                             while (position > 0) {
-                                while ((_iterator != _container->end()) && (_iterator->IsSet() == false)) {
-                                    _iterator++;
+                                while ((_container->IsEnd(_position) == false) && (_container->At(_position).IsSet() == false)) {
+                                    _container->Next(_position);
                                 }
 
-                                if (_iterator == _container->end()) {
+                                if (_container->IsEnd(_position) == true) {
                                     position = 0;
                                 }
                                 else if (--position != 0) {
-                                    _iterator++;
+                                    _container->Next(_position);
                                 }
                             }
-                            _state = (_iterator != _container->end() ? AT_ELEMENT : AT_END);
+                            _state = (_container->IsEnd(_position) == false ? AT_ELEMENT : AT_END);
                         }
                     }
 
@@ -2822,14 +3132,14 @@ namespace Core {
                     if (_container != nullptr) {
                         if (_state != AT_END) {
                             if (_state != AT_BEGINNING) {
-                                _iterator++;
+                                _container->Next(_position);
                             }
 
-                            while ((_iterator != _container->end()) && (_iterator->IsSet() == false)) {
-                                _iterator++;
+                            while ((_container->IsEnd(_position) == false) && (_container->At(_position).IsSet() == false)) {
+                                _container->Next(_position);
                             }
 
-                            _state = (_iterator != _container->end() ? AT_ELEMENT : AT_END);
+                            _state = (_container->IsEnd(_position) == false ? AT_ELEMENT : AT_END);
                         }
                     } else {
                         _state = AT_END;
@@ -2841,14 +3151,14 @@ namespace Core {
                 {
                     ASSERT(_state == AT_ELEMENT);
 
-                    return (&(*_iterator));
+                    return (&(_container->At(_position)));
                 }
 
                 ARRAYELEMENT& Current()
                 {
                     ASSERT(_state == AT_ELEMENT);
 
-                    return (*_iterator);
+                    return (_container->At(_position));
                 }
 
                 inline uint32_t Count() const
@@ -2858,7 +3168,7 @@ namespace Core {
 
             private:
                 ArrayContainer* _container;
-                typename ArrayContainer::iterator _iterator;
+                typename ArrayContainer::Position _position;
                 State _state;
             };
 
@@ -2912,50 +3222,26 @@ namespace Core {
 
             inline ELEMENT& Add()
             {
-                _data.push_back(ELEMENT());
-
-                return (_data.back());
+                return (_data.emplace_back());
             }
 
             inline ELEMENT& Add(const ELEMENT& element)
             {
-                _data.push_back(element);
-
-                return (_data.back());
+                return (_data.emplace_back(element));
             }
 
             ELEMENT& operator[](const uint32_t index)
             {
-                uint32_t skip = index;
                 ASSERT(index < Length());
 
-                typename std::list<ELEMENT>::iterator locator = _data.begin();
-
-                while (skip != 0) {
-                    locator++;
-                    skip--;
-                }
-
-                ASSERT(locator != _data.end());
-
-                return (*locator);
+                return (_data[index]);
             }
 
             const ELEMENT& operator[](const uint32_t index) const
             {
-                uint32_t skip = index;
                 ASSERT(index < Length());
 
-                typename std::list<ELEMENT>::const_iterator locator = _data.begin();
-
-                while (skip != 0) {
-                    locator++;
-                    skip--;
-                }
-
-                ASSERT(locator != _data.end());
-
-                return (*locator);
+                return (_data[index]);
             }
 
             const ELEMENT& Get(const uint32_t index) const
@@ -3035,9 +3321,7 @@ namespace Core {
                 uint16_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == FIND_MARKER) {
-                    while ((loaded < maxLength) && ::isspace(stream[loaded])) {
-                        loaded++;
-                    }
+                    loaded += Scanner::SkipWhitespace(&(stream[loaded]), maxLength - loaded);
                 }
 
                 if (loaded == maxLength) {
@@ -3066,9 +3350,7 @@ namespace Core {
                 while ((offset != FIND_MARKER) && (loaded < maxLength)) {
                     if ((offset == SKIP_BEFORE) || (offset == SKIP_AFTER)) {
                         // Run till we find a character not a whitespace..
-                        while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
-                            loaded++;
-                        }
+                        loaded += Scanner::SkipWhitespace(&(stream[loaded]), maxLength - loaded);
 
                         if (loaded < maxLength) {
                             switch (stream[loaded]) {
@@ -3093,7 +3375,7 @@ namespace Core {
                                     ++loaded;
                                 } else {
                                     offset = PARSE;
-                                    _data.push_back(ELEMENT());
+                                    _data.emplace_back();
                                 }
                                 break;
                             }
@@ -3162,6 +3444,7 @@ namespace Core {
                         loaded = 1;
                     } else if ((stream[0] & 0xF0) == 0x90) {
                         _count = (stream[0] & 0x0F);
+                        _data.Reserve(_count);
                         offset = PARSE;
                     } else if (stream[0] & 0xDC) {
                         offset = 1;
@@ -3174,6 +3457,7 @@ namespace Core {
                         offset = 2;
                     } else if (offset == 2) {
                         _count = (_count << 8) | stream[loaded++];
+                        _data.Reserve(_count);
                         offset = PARSE;
                     }
                 }
@@ -3183,7 +3467,7 @@ namespace Core {
                     if (offset == PARSE) {
                         if (_count > 0) {
                             _count--;
-                            _data.emplace_back(ELEMENT());
+                            _data.emplace_back();
                         } else {
                             offset = 0;
                         }
@@ -3201,7 +3485,7 @@ namespace Core {
         private:
             uint8_t _state;
             uint16_t _count;
-            std::list<ELEMENT> _data;
+            ArrayStorageType<ELEMENT> _data;
             mutable IteratorType<ELEMENT> _iterator;
         };
 
@@ -3222,7 +3506,62 @@ namespace Core {
             static constexpr uint16_t PARSE = 7;
 
             typedef std::pair<const TCHAR*, IElement*> JSONLabelValue;
-            typedef std::list<JSONLabelValue> JSONElementList;
+            typedef std::vector<JSONLabelValue> JSONElementList;
+
+            // Below this number of members, just comparing the labels is cheap enough.
+            static constexpr uint16_t IndexThreshold = 8;
+
+            // Per container type, a perfect hash of the member labels onto their position.
+            // It is built once, from the first instance of the type that is parsed, and it
+            // is shared by all instances of that type. Instances that (temporarily) have
+            // other members, e.g. added on the fly, do not use it and search the labels.
+            class EXTERNAL Index {
+            private:
+                struct Slot {
+                    uint16_t Position;
+                    uint16_t Length;
+                };
+
+            public:
+                static constexpr uint16_t NotFound = static_cast<uint16_t>(~0);
+
+                Index() = delete;
+                Index(const Index&) = delete;
+                Index& operator=(const Index&) = delete;
+
+                explicit Index(const JSONElementList& data);
+                ~Index() = default;
+
+            public:
+                static const Index* Instance(const std::type_info& type, const JSONElementList& data);
+
+                bool Matches(const JSONElementList& data) const;
+                uint16_t Position(const TCHAR label[], const uint16_t length) const
+                {
+                    const Slot& slot(_slots[Hash(label, length, _seed) & _mask]);
+
+                    return (((slot.Length == length) && (slot.Position != NotFound) && (::memcmp(_labels[slot.Position].c_str(), label, length * sizeof(TCHAR)) == 0)) ? slot.Position : NotFound);
+                }
+
+            private:
+                static uint32_t Hash(const TCHAR label[], const uint16_t length, const uint32_t seed)
+                {
+                    // FNV-1a
+                    uint32_t hash = (2166136261u ^ seed);
+
+                    for (uint16_t index = 0; index < length; index++) {
+                        hash = (hash ^ static_cast<uint32_t>(label[index])) * 16777619u;
+                    }
+
+                    return (hash);
+                }
+
+            private:
+                std::vector<string> _labels;
+                std::vector<Slot> _slots;
+                uint32_t _seed;
+                uint32_t _mask;
+            };
 
             class Iterator {
             private:
@@ -3301,6 +3640,8 @@ namespace Core {
                 , _data()
                 , _iterator()
                 , _fieldName(true)
+                , _index(nullptr)
+                , _indexed(false)
             {
                 ::memset(&_current, 0, sizeof(_current));
             }
@@ -3356,11 +3697,15 @@ namespace Core {
                     index->second->Clear();
                     index = _data.erase(index);
                 }
+
+                Unindex();
             }
 
             void Add(const TCHAR label[], IElement* element)
             {
                 _data.push_back(JSONLabelValue(label, element));
+
+                Unindex();
             }
 
             void Remove(const TCHAR label[])
@@ -3373,6 +3718,8 @@ namespace Core {
 
                 if (index != _data.end()) {
                     _data.erase(index);
+
+                    Unindex();
                 }
             }
 
@@ -3436,9 +3783,7 @@ namespace Core {
                 uint16_t loaded = 0;
                 // Run till we find opening bracket..
                 if (offset == FIND_MARKER) {
-                    while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
-                        loaded++;
-                    }
+                    loaded += Scanner::SkipWhitespace(&(stream[loaded]), maxLength - loaded);
                 }
 
                 if (loaded == maxLength) {
@@ -3468,9 +3813,7 @@ namespace Core {
                 while ((offset != FIND_MARKER) && (loaded < maxLength)) {
                     if ((offset == SKIP_BEFORE) || (offset == SKIP_AFTER) || offset == SKIP_BEFORE_VALUE || offset == SKIP_AFTER_KEY) {
                         // Run till we find a character not a whitespace..
-                        while ((loaded < maxLength) && (::isspace(stream[loaded]))) {
-                            loaded++;
-                        }
+                        loaded += Scanner::SkipWhitespace(&(stream[loaded]), maxLength - loaded);
 
                         if (loaded < maxLength) {
                             switch (stream[loaded]) {
@@ -3711,17 +4054,35 @@ namespace Core {
             {
                 IElement* result = nullptr;
 
-                JSONElementList::iterator index = _data.begin();
+                if ((_indexed == false) && (_data.size() >= IndexThreshold)) {
+                    // Only trust the index of our type, if we have exactly the members it was built from.
+                    const Index* index = Index::Instance(typeid(*this), _data);
 
-                while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
-                    index++;
+                    _index = (index->Matches(_data) == true ? index : nullptr);
+                    _indexed = true;
                 }
 
-                if (index != _data.end()) {
-                    result = index->second;
+                if (_index != nullptr) {
+                    uint16_t position = _index->Position(label, static_cast<uint16_t>(strlen(label)));
+
+                    if (position != Index::NotFound) {
+                        result = _data[position].second;
+                    }
                 }
-                else if (Request(label) == true) {
-                    index = _data.end();
+                else {
+                    JSONElementList::iterator index = _data.begin();
+
+                    while ((index != _data.end()) && (strcmp(label, index->first) != 0)) {
+                        index++;
+                    }
+
+                    if (index != _data.end()) {
+                        result = index->second;
+                    }
+                }
+
+                if ((result == nullptr) && (Request(label) == true)) {
+                    JSONElementList::iterator index = _data.end();
 
                     while ((result == nullptr) && (index != _data.begin())) {
                         index--;
@@ -3762,6 +4123,12 @@ namespace Core {
                 return (false);
             }
 
+            void Unindex()
+            {
+                _index = nullptr;
+                _indexed = false;
+            }
+
         private:
             uint8_t _state;
             uint16_t _count;
@@ -3772,6 +4139,8 @@ namespace Core {
             JSONElementList _data;
             mutable JSONElementList::const_iterator _iterator;
             mutable String _fieldName;
+            const Index* _index;
+            bool _indexed;
         };
 
         class VariantContainer;
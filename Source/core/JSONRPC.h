@@ -849,6 +849,15 @@ namespace Core {
             }
 
         private:
+            // The parameters outlive the object they are deserialized into, so that object
+            // may reference the strings in there, instead of copying them.
+            template <typename INBOUND>
+            static void FromParameters(const string& parameters, INBOUND& inbound)
+            {
+                Core::JSON::String::Retain retain(parameters);
+
+                inbound.FromString(parameters);
+            }
             template <typename PARAMETER, typename GET_METHOD, typename REALOBJECT>
             void InternalProperty(const ::TemplateIntToType<1>&, const string& methodName, const GET_METHOD& getMethod, REALOBJECT* objectPtr)
             {
@@ -876,7 +885,7 @@ namespace Core {
                     PARAMETER parameter;
                     uint32_t code;
                     if (inbound.empty() == false) {
-                        parameter.FromString(inbound);
+                        FromParameters(inbound, parameter);
                         code = setter(*objectPtr, parameter);
                     } else {
                         code = Core::ERROR_UNAVAILABLE;
@@ -895,7 +904,7 @@ namespace Core {
                     PARAMETER parameter;
                     uint32_t code;
                     if (inbound.empty() == false) {
-                        parameter.FromString(inbound);
+                        FromParameters(inbound, parameter);
                         code = setter(*objectPtr, parameter);
                     } else {
                         code = getter(*objectPtr, parameter);
@@ -934,7 +943,7 @@ namespace Core {
                     uint32_t code;
                     if (inbound.empty() == false) {
                         const string index = Message::Index(method);
-                        parameter.FromString(inbound);
+                        FromParameters(inbound, parameter);
                         code = setter(*objectPtr, index, parameter);
                     } else {
                         code = Core::ERROR_UNAVAILABLE;
@@ -954,7 +963,7 @@ namespace Core {
                     uint32_t code;
                     const string index = Message::Index(method);
                     if (inbound.empty() == false) {
-                        parameter.FromString(inbound);
+                        FromParameters(inbound, parameter);
                         code = setter(*objectPtr, index, parameter);
                     } else {
                         code = getter(*objectPtr, index, parameter);
@@ -979,7 +988,7 @@ namespace Core {
                 std::function<uint32_t(const INBOUND&)> actualMethod = method;
                 InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context&, const string&, const string& parameters, string&) -> uint32_t {
                     INBOUND inbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     return (actualMethod(inbound));
                 };
                 Register(methodName, implementation);
@@ -1007,7 +1016,7 @@ namespace Core {
                 InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context&, const string&, const string& parameters, string& result) -> uint32_t {
                     INBOUND inbound;
                     OUTBOUND outbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     uint32_t code = actualMethod(inbound, outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1024,7 +1033,7 @@ namespace Core {
                 std::function<uint32_t(const string& index, const INBOUND&)> actualMethod = method;
                 InvokeFunction implementation = [actualMethod](const string& method, const string& parameters, string&) -> uint32_t {
                     INBOUND inbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     return (actualMethod(Message::Index(method), inbound));
                 };
                 Register(methodName, implementation);
@@ -1052,7 +1061,7 @@ namespace Core {
                 InvokeFunction implementation = [actualMethod](const string& method, const string& parameters, string& result) -> uint32_t {
                     INBOUND inbound;
                     OUTBOUND outbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     uint32_t code = actualMethod(Message::Index(method), inbound, outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1078,7 +1087,7 @@ namespace Core {
                 std::function<uint32_t(const INBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1);
                 InvokeFunction implementation = [actualMethod](const Context&, const string&, const string& parameters, string&) -> uint32_t {
                     INBOUND inbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     return (actualMethod(inbound));
                 };
                 Register(methodName, implementation);
@@ -1106,7 +1115,7 @@ namespace Core {
                 InvokeFunction implementation = [actualMethod](const Context&, const string&, const string& parameters, string& result) -> uint32_t {
                     INBOUND inbound;
                     OUTBOUND outbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     uint32_t code = actualMethod(inbound, outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1132,7 +1141,7 @@ namespace Core {
                 std::function<uint32_t(const Core::JSONRPC::Context&, const INBOUND&)> actualMethod = method;
                 InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string&, const string& parameters, string&) -> uint32_t {
                     INBOUND inbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     return (actualMethod(context, inbound));
                 };
                 Register(methodName, implementation);
@@ -1161,7 +1170,7 @@ namespace Core {
                 InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string&, const string& parameters, string& result) -> uint32_t {
                     INBOUND inbound;
                     OUTBOUND outbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     uint32_t code = actualMethod(context, inbound, outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1179,7 +1188,7 @@ namespace Core {
                 std::function<uint32_t(const Core::JSONRPC::Context&, const string& index, const INBOUND&)> actualMethod = method;
                 InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string& method, const string& parameters, string&) -> uint32_t {
                     INBOUND inbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     return (actualMethod(context, Message::Index(method), inbound));
                 };
                 Register(methodName, implementation);
@@ -1208,7 +1217,7 @@ namespace Core {
                 InvokeFunction implementation = [actualMethod](const Core::JSONRPC::Context& context, const string& method, const string& parameters, string& result) -> uint32_t {
                     INBOUND inbound;
                     OUTBOUND outbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     uint32_t code = actualMethod(context, Message::Index(method), inbound, outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1235,7 +1244,7 @@ namespace Core {
                 std::function<uint32_t(const Core::JSONRPC::Context&, const INBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1);
                 InvokeFunction implementation = [actualMethod](const Context& context, const string&, const string& parameters, string&) -> uint32_t {
                     INBOUND inbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     return (actualMethod(context, inbound));
                 };
                 Register(methodName, implementation);
@@ -1264,7 +1273,7 @@ namespace Core {
                 InvokeFunction implementation = [actualMethod](const Context& context, const string&, const string& parameters, string& result) -> uint32_t {
                     INBOUND inbound;
                     OUTBOUND outbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     uint32_t code = actualMethod(context, inbound, outbound);
                     if (code == Core::ERROR_NONE) {
                         outbound.ToString(result);
@@ -1291,7 +1300,7 @@ namespace Core {
                 std::function<void(const Core::JSONRPC::Context&, const INBOUND&)> actualMethod = method;
                 CallbackFunction implementation = [actualMethod](const Context& connection, const string& parameters) -> void {
                     INBOUND inbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     actualMethod(connection, inbound);
                 };
                 Register(methodName, implementation);
@@ -1311,7 +1320,7 @@ namespace Core {
                 std::function<void(const Core::JSONRPC::Context&, const INBOUND&)> actualMethod = std::bind(method, objectPtr, std::placeholders::_1, std::placeholders::_2);
                 CallbackFunction implementation = [actualMethod](const Context& connection, const string& parameters) -> void {
                     INBOUND inbound;
-                    inbound.FromString(parameters);
+                    FromParameters(parameters, inbound);
                     actualMethod(connection, inbound);
                 };
                 Register(methodName, implementation);
@@ -263,6 +263,14 @@ POP_WARNING()
             return (_channel.HasError());
         }
 
+    protected:
+        // Whatever was negotiated on the framing, a new connection starts from scratch.
+        inline void Reset()
+        {
+            _serializerImpl.Reset();
+            _deserialiserImpl.Reset();
+        }
+
     private:
         inline void Trigger()
         {
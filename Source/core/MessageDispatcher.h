@@ -43,6 +43,7 @@ namespace Core {
             DataBuffer(const string& doorBell, const string& fileName, const uint32_t mode, const uint32_t bufferSize, const bool overwrite)
                 : CyclicBuffer(fileName, mode, bufferSize, overwrite)
                 , _doorBell(doorBell.c_str())
+                , _overwrites(0)
             {
             }
             ~DataBuffer() override = default;
@@ -91,8 +92,14 @@ namespace Core {
                     cursor.Forward(chunkSize);
                 }
 
+                _overwrites++;
+
                 return cursor.Offset();
             }
+            uint32_t Overwrites() const
+            {
+                return (_overwrites);
+            }
             uint32_t GetReadSize(Cursor& cursor) override
             {
                 // Just read one entry.
@@ -109,6 +116,139 @@ namespace Core {
 
         private:
             Core::DoorBell _doorBell;
+            std::atomic<uint32_t> _overwrites;
+        };
+
+        /**
+        * @brief Buffer of a single thread. Only that thread writes to it and only the reader reads from it, so neither
+        *        side takes a lock: the writer only moves the head, the reader only moves the tail. Both keep counting
+        *        up, the size is a power of two so they can wrap around.
+        *        The writer may not touch the tail, so when the buffer is full new data is dropped, where the shared
+        *        buffer overwrites the oldest data.
+        */
+        class ThreadBuffer {
+        private:
+            struct Administration {
+                std::atomic<uint32_t> Head;
+                std::atomic<uint32_t> Tail;
+                uint32_t Size;
+            };
+
+        public:
+            ThreadBuffer() = delete;
+            ThreadBuffer(const ThreadBuffer&) = delete;
+            ThreadBuffer& operator=(const ThreadBuffer&) = delete;
+
+            ThreadBuffer(const string& fileName, const uint32_t mode, const uint32_t bufferSize)
+                : _file(fileName, (bufferSize == 0 ? (mode & (~File::CREATE)) : (mode | File::CREATE)), (bufferSize == 0 ? 0 : sizeof(Administration) + RoundUp(bufferSize)))
+                , _administration(nullptr)
+                , _buffer(nullptr)
+            {
+                if ((_file.IsValid() == true) && (_file.Size() > sizeof(Administration))) {
+                    _administration = reinterpret_cast<Administration*>(_file.Buffer());
+                    _buffer = &(_file.Buffer()[sizeof(Administration)]);
+
+                    if (bufferSize != 0) {
+                        std::atomic_init(&(_administration->Head), static_cast<uint32_t>(0));
+                        std::atomic_init(&(_administration->Tail), static_cast<uint32_t>(0));
+                        _administration->Size = RoundUp(bufferSize);
+                    }
+                }
+            }
+            ~ThreadBuffer() = default;
+
+        public:
+            bool IsValid() const
+            {
+                return (_administration != nullptr);
+            }
+            /**
+            * @brief Writer side, only to be called by the thread that owns this buffer.
+            *
+            * @param ring set if the reader may be waiting for this data
+            * @return uint32_t ERROR_NONE: OK
+            *                  ERROR_WRITE_ERROR: no room for this data, it is dropped
+            */
+            uint32_t Push(const uint16_t length, const uint8_t value[], bool& ring)
+            {
+                uint32_t result = Core::ERROR_WRITE_ERROR;
+                const uint32_t head = _administration->Head.load(std::memory_order_relaxed);
+                const uint32_t tail = _administration->Tail.load(std::memory_order_acquire);
+                const uint32_t required = sizeof(length) + length;
+
+                if ((_administration->Size - (head - tail)) >= required) {
+                    Copy(head, reinterpret_cast<const uint8_t*>(&length), sizeof(length));
+                    Copy(head + sizeof(length), value, length);
+
+                    _administration->Head.store(head + required, std::memory_order_release);
+
+                    // Empty before, or the reader took data while this was written, in which case it may have
+                    // found it empty and went back to waiting.
+                    ring = ((head == tail) || (_administration->Tail.load(std::memory_order_acquire) != tail));
+                    result = Core::ERROR_NONE;
+                }
+
+                return (result);
+            }
+            /**
+            * @brief Reader side, same as PopData.
+            */
+            uint32_t Pop(uint16_t& outLength, uint8_t* outValue)
+            {
+                uint32_t result = Core::ERROR_READ_ERROR;
+                const uint32_t tail = _administration->Tail.load(std::memory_order_relaxed);
+                const uint32_t head = _administration->Head.load(std::memory_order_acquire);
+
+                if (head != tail) {
+                    uint16_t length;
+
+                    Read(tail, reinterpret_cast<uint8_t*>(&length), sizeof(length));
+                    Read(tail + sizeof(length), outValue, std::min(length, outLength));
+
+                    _administration->Tail.store(tail + sizeof(length) + length, std::memory_order_release);
+
+                    result = (length > outLength ? Core::ERROR_GENERAL : Core::ERROR_NONE);
+                    outLength = length;
+                }
+
+                return (result);
+            }
+
+        private:
+            static uint32_t RoundUp(const uint32_t size)
+            {
+                uint32_t result = 1;
+                while (result < size) {
+                    result <<= 1;
+                }
+                return (result);
+            }
+            void Copy(const uint32_t position, const uint8_t value[], const uint32_t length)
+            {
+                const uint32_t offset = position & (_administration->Size - 1);
+                const uint32_t first = std::min(length, _administration->Size - offset);
+
+                ::memcpy(&_buffer[offset], value, first);
+                ::memcpy(_buffer, &value[first], length - first);
+            }
+            void Read(const uint32_t position, uint8_t value[], const uint32_t length) const
+            {
+                const uint32_t offset = position & (_administration->Size - 1);
+                const uint32_t first = std::min(length, _administration->Size - offset);
+
+                ::memcpy(value, &_buffer[offset], first);
+                ::memcpy(&value[first], _buffer, length - first);
+            }
+
+        private:
+            Core::DataElementFile _file;
+            Administration* _administration;
+            uint8_t* _buffer;
+        };
+
+        // Shared with the reader, tells it how many threads have a buffer of their own.
+        struct ThreadTable {
+            std::atomic<uint32_t> Count;
         };
 
         template <uint16_t SIZE>
@@ -188,22 +328,33 @@ namespace Core {
          * @param instanceId number of the instance
          * @param initialize should dispatcher be initialzied. Should be done only once, on the server side
          * @param baseDirectory where to place all the necessary files. This directory should exist before creating this class.
+         * @param threads number of threads that get a buffer of their own, the others share one buffer. Only used on the
+         *                initializing side, the reading side finds out by itself.
          */
-        MessageDispatcherType(const string& identifier, const uint32_t instanceId, bool initialize, string baseDirectory = _T("/tmp/MessageDispatcher"))
+        MessageDispatcherType(const string& identifier, const uint32_t instanceId, bool initialize, string baseDirectory = _T("/tmp/MessageDispatcher"), const uint8_t threads = 0)
             : _filenames(PrepareFilenames(baseDirectory, identifier, instanceId))
-            // clang-format off
-            , _dataBuffer(_filenames.doorBell, _filenames.data,  Core::File::USER_READ    |
-                                                                 Core::File::USER_WRITE   |
-                                                                 Core::File::USER_EXECUTE |
-                                                                 Core::File::GROUP_READ   |
-                                                                 Core::File::GROUP_WRITE  |
-                                                                 Core::File::OTHERS_READ  |
-                                                                 Core::File::OTHERS_WRITE |
-                                                                 Core::File::SHAREABLE,
-                                                                 initialize ? DATA_SIZE + sizeof(Core::CyclicBuffer::control) : 0, true)
-            // clang-format on
+            , _dataBuffer(_filenames.doorBell, _filenames.data, Mode(), initialize ? DATA_SIZE + sizeof(Core::CyclicBuffer::control) : 0, true)
             , _metaDataBuffer(initialize ? new MetaDataBuffer<METADATA_SIZE>(_filenames.metaData) : nullptr)
+            , _threads(initialize ? threads : 0)
+            , _serial(NextSerial())
+            , _threadTable()
+            , _threadBuffers()
+            , _threadOwners()
+            , _next(0)
+            , _dropped(0)
         {
+            if (_threads != 0) {
+                _threadTable.reset(new Core::DataElementFile(_filenames.threads, Mode() | Core::File::CREATE, sizeof(ThreadTable)));
+
+                if (_threadTable->IsValid() == true) {
+                    std::atomic_init(&(reinterpret_cast<ThreadTable*>(_threadTable->Buffer())->Count), static_cast<uint32_t>(0));
+                } else {
+                    TRACE_L1("MessageDispatcher could not create its thread table, all threads share one buffer!");
+                    _threadTable.reset(nullptr);
+                    _threads = 0;
+                }
+            }
+
             if (!IsValid()) {
                 TRACE_L1("MessageDispatcher is not valid!");
             }
@@ -221,13 +372,89 @@ namespace Core {
         /**
         * @brief Writes data into cyclic buffer. After writing everything, this side should call Ring() to notify other side.
         *        To receive this data other side needs to wait for the doorbel ring and then use PopData
+        *        Threads with a buffer of their own write without taking a lock and ring the doorbell themselves.
         *
         * @param length length of message
         * @param value buffer
-        * @return uint32_t ERROR_WRITE_ERROR: failed to reserve enough space - eg, value size is exceeding max cyclic buffer size
+        * @return uint32_t ERROR_WRITE_ERROR: failed to reserve enough space - eg, value size is exceeding max cyclic buffer size,
+        *                                     or the buffer of this thread is full
         *                  ERROR_NONE: OK
         */
         uint32_t PushData(const uint16_t length, const uint8_t* value)
+        {
+            uint32_t result;
+            ThreadBuffer* buffer = (_threads != 0 ? OwnBuffer() : nullptr);
+
+            if (buffer == nullptr) {
+                result = PushSharedData(length, value);
+            } else {
+                bool ring = false;
+
+                result = buffer->Push(length, value, ring);
+
+                if (result != Core::ERROR_NONE) {
+                    _dropped++;
+                } else if (ring == true) {
+                    _dataBuffer.Ring();
+                }
+            }
+
+            return (result);
+        }
+
+        /**
+         * @brief Read data after doorbell ringed. If buffer is too small to fit whole message it will be partially filled.
+         *        The shared buffer and those of the threads take turns, so none of them can hold up the others.
+         *
+         * @param outLength ERROR_NONE - read bytes.
+         *                  ERROR_GENERAL - mimimal required bytes to fit whole message.
+         *                  ERROR_READ_ERROR - the same value as passed in
+         * @param outValue buffer
+         * @return uint32_t ERROR_READ_ERROR - unable to read or there is no data
+         *                  ERROR_GENERAL - buffer too small to fit whole data at once
+         *                  ERROR_NONE - OK
+         */
+        uint32_t PopData(uint16_t& outLength, uint8_t* outValue)
+        {
+            uint32_t result = Core::ERROR_READ_ERROR;
+
+            _dataLock.Lock();
+
+            do {
+                const uint32_t count = 1 + static_cast<uint32_t>(_threadBuffers.size());
+
+                for (uint32_t index = 0; (index < count) && (result == Core::ERROR_READ_ERROR); index++) {
+                    const uint32_t current = (_next + index) % count;
+                    uint16_t length = outLength;
+
+                    result = (current == 0 ? PopSharedData(length, outValue) : _threadBuffers[current - 1]->Pop(length, outValue));
+
+                    if (result != Core::ERROR_READ_ERROR) {
+                        outLength = length;
+                        _next = current + 1;
+                    }
+                }
+
+                // All empty, but maybe there are threads that started writing in a buffer of their own.
+            } while ((result == Core::ERROR_READ_ERROR) && (Discover() == true));
+
+            _dataLock.Unlock();
+
+            return (result);
+        }
+
+        /**
+         * @brief Number of times data was dropped because the buffer of the writing thread was full.
+         *
+         * @return uint32_t count, only ever goes up
+         */
+        uint32_t Dropped() const
+        {
+            return (_dropped);
+        }
+
+    private:
+        uint32_t PushSharedData(const uint16_t length, const uint8_t* value)
         {
             _dataLock.Lock();
 
@@ -252,22 +479,10 @@ namespace Core {
             return result;
         }
 
-        /**
-         * @brief Read data after doorbell ringed. If buffer is too small to fit whole message it will be partially filled.
-         *
-         * @param outLength ERROR_NONE - read bytes.
-         *                  ERROR_GENERAL - mimimal required bytes to fit whole message.
-         *                  ERROR_READ_ERROR - the same value as passed in
-         * @param outValue buffer
-         * @return uint32_t ERROR_READ_ERROR - unable to read or data is corrupted
-         *                  ERROR_NONE - OK
-         *                  ERROR_GENERAL - buffer too small to fit whole message at once
-         */
-        uint32_t PopData(uint16_t& outLength, uint8_t* outValue)
+        uint32_t PopSharedData(uint16_t& outLength, uint8_t* outValue)
         {
             ASSERT(_dataBuffer.IsValid());
 
-            _dataLock.Lock();
             uint32_t result = Core::ERROR_READ_ERROR;
 
             if (_dataBuffer.Validate()) {
@@ -285,10 +500,10 @@ namespace Core {
                 }
             }
 
-            _dataLock.Unlock();
-
             return result;
         }
+
+    public:
         void Ring()
         {
             _dataBuffer.Ring();
@@ -303,6 +518,16 @@ namespace Core {
             _dataBuffer.Flush();
         }
 
+        /**
+         * @brief Number of times unread data had to make room for new data, on the writing side.
+         *
+         * @return uint32_t count, only ever goes up
+         */
+        uint32_t Overwrites() const
+        {
+            return (_dataBuffer.Overwrites());
+        }
+
         /**
          * @brief Exchanges metadata with the server. Reader needs to register for notifications to recevie this message.
          *        Passed buffer will be filled with data from thr other side
@@ -372,8 +597,118 @@ namespace Core {
             string doorBell;
             string metaData;
             string data;
+            string threads;
         } _filenames;
 
+        static uint32_t Mode()
+        {
+            // clang-format off
+            return (Core::File::USER_READ    |
+                    Core::File::USER_WRITE   |
+                    Core::File::USER_EXECUTE |
+                    Core::File::GROUP_READ   |
+                    Core::File::GROUP_WRITE  |
+                    Core::File::OTHERS_READ  |
+                    Core::File::OTHERS_WRITE |
+                    Core::File::SHAREABLE);
+            // clang-format on
+        }
+        static uint32_t NextSerial()
+        {
+            static std::atomic<uint32_t> serial(0);
+            return (++serial);
+        }
+        string ThreadFilename(const uint32_t index) const
+        {
+            return (Core::Format("%s.%u", _filenames.threads.c_str(), index));
+        }
+
+        /**
+        * @brief Writer side: the buffer of the calling thread. The first call of a thread claims one, as long as there
+        *        are any left. After that it is found without taking a lock.
+        *
+        * @return ThreadBuffer* buffer of this thread, nullptr if it has to use the shared buffer
+        */
+        ThreadBuffer* OwnBuffer()
+        {
+            struct Cache {
+                uint32_t Serial;
+                ThreadBuffer* Buffer;
+            };
+            static thread_local Cache cache = { 0, nullptr };
+
+            if (cache.Serial != _serial) {
+                cache.Buffer = Claim();
+                cache.Serial = _serial;
+            }
+
+            return (cache.Buffer);
+        }
+        ThreadBuffer* Claim()
+        {
+            ThreadBuffer* result = nullptr;
+            const ::ThreadId id = Core::Thread::ThreadId();
+
+            _dataLock.Lock();
+
+            std::vector<::ThreadId>::const_iterator index(std::find(_threadOwners.cbegin(), _threadOwners.cend(), id));
+
+            if (index != _threadOwners.cend()) {
+                result = _threadBuffers[std::distance(_threadOwners.cbegin(), index)].get();
+            } else if (_threadBuffers.size() < _threads) {
+                std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer(ThreadFilename(static_cast<uint32_t>(_threadBuffers.size())), Mode(), DATA_SIZE));
+
+                if (buffer->IsValid() == true) {
+                    result = buffer.get();
+                    _threadBuffers.emplace_back(std::move(buffer));
+                    _threadOwners.push_back(id);
+
+                    // Only now the reader may look at it.
+                    reinterpret_cast<ThreadTable*>(_threadTable->Buffer())->Count.store(static_cast<uint32_t>(_threadBuffers.size()), std::memory_order_release);
+                } else {
+                    TRACE_L1("Could not create a thread buffer, this thread uses the shared buffer");
+                }
+            }
+
+            _dataLock.Unlock();
+
+            return (result);
+        }
+        /**
+        * @brief Reader side: opens the buffers the threads of the other side claimed since the last time.
+        *
+        * @return bool true if there are new buffers to read from
+        */
+        bool Discover()
+        {
+            bool result = false;
+
+            if ((_threadTable == nullptr) && (Core::File(_filenames.threads).Exists() == true)) {
+                _threadTable.reset(new Core::DataElementFile(_filenames.threads, Mode(), 0));
+
+                if ((_threadTable->IsValid() == false) || (_threadTable->Size() < sizeof(ThreadTable))) {
+                    _threadTable.reset(nullptr);
+                }
+            }
+
+            if (_threadTable != nullptr) {
+                const uint32_t count = reinterpret_cast<ThreadTable*>(_threadTable->Buffer())->Count.load(std::memory_order_acquire);
+
+                while (_threadBuffers.size() < count) {
+                    std::unique_ptr<ThreadBuffer> buffer(new ThreadBuffer(ThreadFilename(static_cast<uint32_t>(_threadBuffers.size())), Mode(), 0));
+
+                    if (buffer->IsValid() == false) {
+                        break;
+                    }
+
+                    _threadBuffers.emplace_back(std::move(buffer));
+                    result = true;
+                }
+            }
+
+            return (result);
+        }
+
         /**
         * @brief Prepare filenames for MessageDispatcher
         *
@@ -392,8 +727,9 @@ namespace Core {
             string doorBellFilename = Core::Format("%s/%s.doorbell", baseDirectory.c_str(), identifier.c_str());
             string dataFilename = Core::Format("%s/%s.%d.data", baseDirectory.c_str(), identifier.c_str(), instanceId);
             string metaDataFilename = Core::Format("%s/%s.%d.metadata", baseDirectory.c_str(), identifier.c_str(), instanceId);
+            string threadsFilename = Core::Format("%s/%s.%d.threads", baseDirectory.c_str(), identifier.c_str(), instanceId);
 
-            return { doorBellFilename, metaDataFilename, dataFilename };
+            return { doorBellFilename, metaDataFilename, dataFilename, threadsFilename };
         }
 
         //private variables
@@ -402,6 +738,14 @@ namespace Core {
 
         DataBuffer _dataBuffer;
         std::unique_ptr<MetaDataBuffer<METADATA_SIZE>> _metaDataBuffer;
+
+        uint8_t _threads;
+        const uint32_t _serial;
+        std::unique_ptr<Core::DataElementFile> _threadTable;
+        std::vector<std::unique_ptr<ThreadBuffer>> _threadBuffers;
+        std::vector<::ThreadId> _threadOwners;
+        uint32_t _next;
+        std::atomic<uint32_t> _dropped;
     };
 }
 }
\ No newline at end of file
@@ -24,6 +24,33 @@ namespace Core {
     namespace Messaging {
         using namespace std::placeholders;
 
+        namespace {
+
+            // Every thread serializes in a buffer of its own, they may push at the same time.
+            uint8_t* SerializationBuffer()
+            {
+                static thread_local std::unique_ptr<uint8_t[]> buffer;
+
+                if (buffer == nullptr) {
+                    buffer.reset(new uint8_t[MessageUnit::DataSize]);
+                }
+
+                return (buffer.get());
+            }
+
+            uint8_t ThreadBufferCount()
+            {
+                string value;
+                uint32_t count = 0;
+
+                if (Core::SystemInfo::GetEnvironment(MessageUnit::MESSAGE_UNIT_THREAD_BUFFERS_ENV, value) == true) {
+                    std::istringstream(value) >> count;
+                }
+
+                return (static_cast<uint8_t>(std::min(count, static_cast<uint32_t>(std::numeric_limits<uint8_t>::max()))));
+            }
+        }
+
         MetaData::MetaData()
             : _type(INVALID)
         {
@@ -125,6 +152,79 @@ namespace Core {
             return length;
         }
 
+        bool InformationTable::Key::operator==(const Key& other) const
+        {
+            // The timestamp is the only thing that is not interned.
+            return ((Entry->MessageMetaData() == other.Entry->MessageMetaData()) && (Entry->LineNumber() == other.Entry->LineNumber()) && (Entry->FileName() == other.Entry->FileName()));
+        }
+
+        size_t InformationTable::Hash::operator()(const Key& key) const
+        {
+            const MetaData& metaData(key.Entry->MessageMetaData());
+            size_t result = std::hash<string>()(key.Entry->FileName()) ^ (static_cast<size_t>(key.Entry->LineNumber()) << 8) ^ metaData.Type();
+
+            result = (result * 31) ^ std::hash<string>()(metaData.Category());
+            result = (result * 31) ^ std::hash<string>()(metaData.Module());
+
+            return (result);
+        }
+
+        /**
+        * @brief Number of the given information, it gets one if it did not have one yet.
+        *
+        * @param info information to look up, its timestamp is ignored
+        * @return uint32_t number of this information, the same for as long as this table exists
+        */
+        uint32_t InformationTable::Intern(const Information& info)
+        {
+            uint32_t result;
+            const Key key = { &info };
+
+            _lock.Lock();
+
+            std::unordered_map<Key, uint32_t, Hash>::const_iterator index(_index.find(key));
+
+            if (index != _index.end()) {
+                result = index->second;
+            } else {
+                result = static_cast<uint32_t>(_entries.size());
+
+                // A deque keeps what it holds in place, so the key can point to it.
+                _entries.push_back(info);
+                _index.emplace(Key { &_entries.back() }, result);
+            }
+
+            _lock.Unlock();
+
+            return (result);
+        }
+
+        /**
+        * @brief What a number stands for.
+        *
+        * @param id number given by Intern
+        * @param info information, with a timestamp of 0
+        * @return bool false if the number was never given out
+        */
+        bool InformationTable::Lookup(const uint32_t id, Information& info) const
+        {
+            bool result = false;
+
+            _lock.Lock();
+
+            if (id < _entries.size()) {
+                const Information& entry(_entries[id]);
+                const MetaData& metaData(entry.MessageMetaData());
+
+                info = Information(metaData.Type(), metaData.Category(), metaData.Module(), entry.FileName(), entry.LineNumber(), 0);
+                result = true;
+            }
+
+            _lock.Unlock();
+
+            return (result);
+        }
+
         //----------Entry----------
         Settings::Messages::Entry::Entry(const string& module, const string& category, const bool enabled)
             : Core::JSON::Container()
@@ -576,7 +676,8 @@ namespace Core {
             Core::SystemInfo::SetEnvironment(MESSAGE_DISPATCHER_PATH_ENV, basePath);
             Core::SystemInfo::SetEnvironment(MESSAGE_DISPACTHER_IDENTIFIER_ENV, identifier);
 
-            _dispatcher.reset(new MessageDispatcher(identifier, 0, true, basePath));
+            _dispatcher.reset(new MessageDispatcher(identifier, 0, true, basePath, ThreadBufferCount()));
+            _generation++;
             if (_dispatcher != nullptr) {
                 if (_dispatcher->IsValid()) {
                     _dispatcher->RegisterDataAvailable(std::bind(&MessageUnit::ReceiveMetaData, this, _1, _2, _3, _4));
@@ -606,7 +707,8 @@ namespace Core {
             Core::SystemInfo::GetEnvironment(MESSAGE_DISPACTHER_IDENTIFIER_ENV, identifier);
             Core::SystemInfo::GetEnvironment(MESSAGE_UNIT_LOGGING_SYSLOG_ENV, isBackground);
 
-            _dispatcher.reset(new MessageDispatcher(identifier, instanceId, true, basePath));
+            _dispatcher.reset(new MessageDispatcher(identifier, instanceId, true, basePath, ThreadBufferCount()));
+            _generation++;
             std::istringstream(isBackground) >> _isBackground;
             if (_dispatcher != nullptr) {
                 if (_dispatcher->IsValid()) {
@@ -630,6 +732,17 @@ namespace Core {
             Core::SystemInfo::SetEnvironment(MESSAGE_UNIT_LOGGING_SYSLOG_ENV, std::to_string(background));
         }
 
+        /**
+        * @brief Give the first threads that push a message a buffer of their own, so they do not have to wait for each
+        *        other. Takes effect on the next Open, also for the processes started after this call.
+        *
+        * @param count number of threads with a buffer of their own, 0 to let all threads share one buffer
+        */
+        void MessageUnit::ThreadBuffers(const uint8_t count)
+        {
+            Core::SystemInfo::SetEnvironment(MESSAGE_UNIT_THREAD_BUFFERS_ENV, std::to_string(count));
+        }
+
         /**
         * @brief Read defaults settings form string
         * @param setting json able to be parsed by @ref MessageUnit::Settings
@@ -735,24 +848,52 @@ namespace Core {
 
             if (_dispatcher != nullptr) {
 
-                uint16_t length = 0;
+                uint8_t* serializationBuffer = SerializationBuffer();
+                const uint32_t id = _interned.Intern(info);
+                const uint64_t timestamp = info.TimeStamp();
+                uint16_t length = InternedHeaderSize;
 
-                length = info.Serialize(_serializationBuffer, sizeof(_serializationBuffer));
+                //the information itself is only sent when the reader asks for it
+                serializationBuffer[0] = InternedRecord;
+                ::memcpy(&serializationBuffer[sizeof(uint8_t)], &id, sizeof(id));
+                ::memcpy(&serializationBuffer[sizeof(uint8_t) + sizeof(id)], &timestamp, sizeof(timestamp));
 
-                //only serialize message if the information could fit
-                if (length != 0) {
-                    length += message->Serialize(_serializationBuffer + length, sizeof(_serializationBuffer) - length);
+                length += message->Serialize(serializationBuffer + length, DataSize - length);
 
-                    if (_dispatcher->PushData(length, _serializationBuffer) != Core::ERROR_NONE) {
-                        TRACE_L1(_T("Unable to push message data!"));
-                    }
+                if (_dispatcher->PushData(length, serializationBuffer) != Core::ERROR_NONE) {
+                    TRACE_L1(_T("Unable to push message data!"));
+                }
+            }
+        }
 
-                } else {
-                    TRACE_L1(_T("Unable to push data, buffer is too small!"));
+        /**
+        * @brief Push data that is already serialized, as is. Used for records that are not built from an
+        *        Information and an IEvent, like the binary trace records.
+        *
+        * @param length length of the data
+        * @param data serialized record, the first byte tells the reader what kind of record it is
+        */
+        void MessageUnit::Push(const uint16_t length, const uint8_t data[])
+        {
+            if (_dispatcher != nullptr) {
+                if (_dispatcher->PushData(length, data) != Core::ERROR_NONE) {
+                    TRACE_L1(_T("Unable to push message data!"));
                 }
             }
         }
 
+        /**
+        * @brief Changes every time the reader could have missed data: when the buffers are (re)opened, when
+        *        unread data was overwritten or dropped and when a (new) reader changes what is enabled. Whatever was announced once in the data buffer, should be announced
+        *        again when this changes.
+        *
+        * @return uint32_t generation of the data buffer
+        */
+        uint32_t MessageUnit::Generation() const
+        {
+            return (_generation + (_dispatcher != nullptr ? (_dispatcher->Overwrites() + _dispatcher->Dropped()) : 0));
+        }
+
         /**
         * @brief When IControl spawns it should announce itself to the unit, so it can be influenced from here
         *        (For example for enabling the category it controls)
@@ -787,7 +928,15 @@ namespace Core {
         */
         void MessageUnit::ReceiveMetaData(const uint16_t size, const uint8_t* data, uint16_t& outSize, uint8_t* outData)
         {
-            if (size != 0) {
+            if ((size == (sizeof(uint8_t) + sizeof(uint32_t))) && (data[0] == InternedRecord)) {
+                // The reader met a number it does not know yet.
+                Information info;
+                uint32_t id;
+
+                ::memcpy(&id, &data[sizeof(uint8_t)], sizeof(id));
+
+                outSize = (_interned.Lookup(id, info) == true ? info.Serialize(outData, outSize) : 0);
+            } else if (size != 0) {
                 MetaData metaData;
                 //last byte is enabled flag
                 auto length = metaData.Deserialize(const_cast<uint8_t*>(data), size - 1); //for now, FrameType is not handling const buffers :/
@@ -796,6 +945,9 @@ namespace Core {
                     bool enabled = data[length];
                     _controlList.Update(metaData, enabled);
                     _messages.Update(metaData, enabled);
+
+                    // Whoever changes what is enabled, is reading: let it know what it needs to know again.
+                    _generation++;
                 }
             } else {
                 auto length = _controlList.Serialize(outData, outSize);
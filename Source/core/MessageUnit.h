@@ -23,6 +23,8 @@
 #include "Proxy.h"
 #include "Sync.h"
 
+#include <deque>
+
 namespace WPEFramework {
 namespace Core {
     namespace Messaging {
@@ -56,11 +58,11 @@ namespace Core {
             {
                 return _type;
             }
-            inline string Category() const
+            inline const string& Category() const
             {
                 return _category;
             }
-            inline string Module() const
+            inline const string& Module() const
             {
                 return _module;
             }
@@ -90,7 +92,7 @@ namespace Core {
             {
                 return _metaData;
             }
-            inline string FileName() const
+            inline const string& FileName() const
             {
                 return _filename;
             }
@@ -113,6 +115,39 @@ namespace Core {
             uint64_t _timeStamp;
         };
 
+        /**
+        * @brief Gives every Information that is pushed a number, the same number for the same category, module, file and
+        *        line. The data buffer then only has to carry that number and the timestamp, the reader asks once, over
+        *        the metadata channel, what the number stands for.
+        */
+        class EXTERNAL InformationTable {
+        private:
+            struct Key {
+                const Information* Entry;
+
+                bool operator==(const Key& other) const;
+            };
+            struct Hash {
+                size_t operator()(const Key& key) const;
+            };
+
+        public:
+            InformationTable(const InformationTable&) = delete;
+            InformationTable& operator=(const InformationTable&) = delete;
+
+            InformationTable() = default;
+            ~InformationTable() = default;
+
+        public:
+            uint32_t Intern(const Information& info);
+            bool Lookup(const uint32_t id, Information& info) const;
+
+        private:
+            mutable Core::CriticalSection _lock;
+            std::deque<Information> _entries;
+            std::unordered_map<Key, uint32_t, Hash> _index;
+        };
+
         struct EXTERNAL IEvent {
             virtual ~IEvent() = default;
             virtual uint16_t Serialize(uint8_t buffer[], const uint16_t length) const = 0;
@@ -306,6 +341,13 @@ namespace Core {
             static constexpr const char* MESSAGE_DISPATCHER_PATH_ENV = _T("MESSAGE_DISPATCHER_PATH");
             static constexpr const char* MESSAGE_DISPACTHER_IDENTIFIER_ENV = _T("MESSAGE_DISPACTHER_IDENTIFIER");
             static constexpr const char* MESSAGE_UNIT_LOGGING_SYSLOG_ENV = _T("MESSAGE_UNIT_LOGGING_SYSLOG");
+            static constexpr const char* MESSAGE_UNIT_THREAD_BUFFERS_ENV = _T("MESSAGE_UNIT_THREAD_BUFFERS");
+
+            // Record of an interned Information: [InternedRecord][id:4][timestamp:8][event]. The first byte is far
+            // away from the MetaData::MessageType values, that start a record with the full Information.
+            // The metadata channel answers [InternedRecord][id:4] with the serialized Information.
+            static constexpr uint8_t InternedRecord = 0x82;
+            static constexpr uint8_t InternedHeaderSize = sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint64_t);
 
             using MessageDispatcher = Core::MessageDispatcherType<MetaDataSize, DataSize>;
 
@@ -315,6 +357,7 @@ namespace Core {
             uint32_t Open(const uint32_t instanceId);
             void Close();
             void IsBackground(bool background);
+            void ThreadBuffers(const uint8_t count);
 
             void Defaults(const string& setting);
             void Defaults(Core::File& file);
@@ -322,6 +365,8 @@ namespace Core {
             bool IsEnabledByDefault(const MetaData& metaData) const;
 
             void Push(const Information& info, const IEvent* message);
+            void Push(const uint16_t length, const uint8_t data[]);
+            uint32_t Generation() const;
 
             void Announce(IControl* control);
             void Revoke(IControl* control);
@@ -339,7 +384,8 @@ namespace Core {
         private:
             mutable Core::CriticalSection _adminLock;
             std::unique_ptr<MessageDispatcher> _dispatcher;
-            uint8_t _serializationBuffer[DataSize];
+            std::atomic<uint32_t> _generation{ 0 };
+            InformationTable _interned;
 
             MessageList _messages;
             ControlList _controlList;
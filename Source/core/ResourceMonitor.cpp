@@ -24,6 +24,41 @@ namespace WPEFramework {
 
 namespace Core {
 
+    /* static */ uint8_t ResourceMonitor::_reactorCount = 1;
+    /* static */ bool ResourceMonitor::_affinity = false;
+
+    ResourceMonitor::ResourceMonitor()
+        : _reactors()
+    {
+        const uint32_t cores = std::thread::hardware_concurrency();
+
+        _reactors.reserve(_reactorCount);
+
+        for (uint8_t index = 0; index < _reactorCount; index++) {
+            _reactors.push_back(new ResourceMonitorBase());
+
+            if ((_affinity == true) && (cores != 0)) {
+                _reactors.back()->Affinity(static_cast<uint16_t>(index % cores));
+            }
+        }
+    }
+
+    ResourceMonitor::~ResourceMonitor()
+    {
+        for (ResourceMonitorBase* reactor : _reactors) {
+            delete reactor;
+        }
+        _reactors.clear();
+    }
+
+    /* static */ void ResourceMonitor::Configure(const uint8_t reactors, const bool affinity)
+    {
+        ASSERT(reactors != 0);
+
+        _reactorCount = std::max(reactors, static_cast<uint8_t>(1));
+        _affinity = affinity;
+    }
+
     /* static */ ResourceMonitor& ResourceMonitor::Instance()
     {
         // Tests build/destroy the ResourceMonitor for each test. In production the
@@ -43,11 +43,44 @@ namespace Core {
 
     template <typename RESOURCE, typename WATCHDOG>
     class ResourceMonitorType {
+    public:
+        enum backend : uint8_t {
+            POLL,
+            EPOLL,
+            EPOLL_EDGE
+        };
+
+#if defined(__LINUX__) && !defined(__APPLE__) && defined(__CORE_RESOURCE_MONITOR_EDGE_TRIGGERED__)
+        static constexpr backend DefaultBackend = EPOLL_EDGE;
+#elif defined(__LINUX__) && !defined(__APPLE__) && defined(__CORE_RESOURCE_MONITOR_EPOLL__)
+        static constexpr backend DefaultBackend = EPOLL;
+#else
+        static constexpr backend DefaultBackend = POLL;
+#endif
+
     private:
         static constexpr uint8_t FileDescriptorAllocation = 32;
+        static constexpr uint8_t EventBatchSize = 64;
 
         typedef ResourceMonitorType<RESOURCE, WATCHDOG> Parent;
 
+        struct Entry {
+            Entry(RESOURCE* entry)
+                : resource(entry)
+                , events(0)
+                , revents(0)
+                , run(0)
+            {
+            }
+
+            RESOURCE* resource;
+            uint16_t events;
+            uint16_t revents;
+            uint32_t run;
+        };
+
+        typedef std::list<Entry> ResourceList;
+
         ResourceMonitorType(const ResourceMonitorType&) = delete;
         ResourceMonitorType& operator=(const ResourceMonitorType&) = delete;
 
@@ -96,7 +129,10 @@ namespace Core {
         };
 
     public:
-        ResourceMonitorType()
+        // The EPOLL backends only hand the descriptors that actually fired to the RESOURCE.
+        // With EPOLL_EDGE, a RESOURCE is only notified on a state change of its descriptor,
+        // so it must drain it (read/write till EWOULDBLOCK) on every Handle() call.
+        ResourceMonitorType(const backend mode = DefaultBackend)
             : _monitor(nullptr)
             , _adminLock()
             , _resourceList()
@@ -109,8 +145,19 @@ namespace Core {
             , _descriptorArrayLength(FileDescriptorAllocation)
             , _descriptorArray(static_cast<struct pollfd*>(::malloc(sizeof(::pollfd) * (_descriptorArrayLength + 1))))
             , _signalDescriptor(-1)
+#ifndef __APPLE__
+            , _backend(mode)
+            , _affinity(~0)
+            , _epollDescriptor(-1)
+            , _sweep(false)
+            , _additions()
+            , _removals(0)
+#endif
 #endif
         {
+#if defined(__WINDOWS__) || defined(__APPLE__)
+            ASSERT(mode == POLL);
+#endif
         }
 
         ~ResourceMonitorType()
@@ -139,6 +186,11 @@ namespace Core {
             if (_signalDescriptor != -1) {
                 ::close(_signalDescriptor);
             }
+#ifndef __APPLE__
+            if (_epollDescriptor != -1) {
+                ::close(_epollDescriptor);
+            }
+#endif
 #endif
 #ifdef __WINDOWS__
             WSACloseEvent(_action);
@@ -158,6 +210,22 @@ namespace Core {
         {
             return (_monitor != nullptr ? _monitor->Id() : 0);
         }
+        backend Backend() const
+        {
+#if defined(__LINUX__) && !defined(__APPLE__)
+            return (_backend);
+#else
+            return (POLL);
+#endif
+        }
+        // Pin the monitor thread to the given CPU, takes effect when the thread starts.
+        void Affinity(const uint16_t VARIABLE_IS_NOT_USED cpu)
+        {
+#if defined(__LINUX__) && !defined(__APPLE__)
+            ASSERT(_monitor == nullptr);
+            _affinity = cpu;
+#endif
+        }
         uint32_t Count() const 
         {
             return (static_cast<uint32_t>(_resourceList.size()));
@@ -168,18 +236,26 @@ namespace Core {
 
             _adminLock.Lock();
 
-            typename std::list<RESOURCE*>::const_iterator index(_resourceList.cbegin());
+            typename ResourceList::const_iterator index(_resourceList.cbegin());
             while ( (count != 0) && (index != _resourceList.cend()) ) { count--; index++; }
 
-            bool found = (index != _resourceList.cend());
+            bool found = ((index != _resourceList.cend()) && (index->resource != nullptr));
 
             if (found == true) {
-                info.descriptor = (*index)->Descriptor();
-                info.classname  = typeid(*(*index)).name();
+                info.descriptor = index->resource->Descriptor();
+                info.classname  = typeid(*(index->resource)).name();
 
 #ifdef __LINUX__
-                info.monitor = _descriptorArray[position + 1].events;
-                info.events  = _descriptorArray[position + 1].revents;
+#ifndef __APPLE__
+                if (_backend != POLL) {
+                    info.monitor = index->events;
+                    info.events  = index->revents;
+                } else
+#endif
+                {
+                    info.monitor = _descriptorArray[position + 1].events;
+                    info.events  = _descriptorArray[position + 1].revents;
+                }
 
                 char procfn[64];
                 sprintf(procfn, "/proc/self/fd/%d", info.descriptor);
@@ -203,8 +279,15 @@ namespace Core {
             _adminLock.Lock();
 
             // Make sure this entry is only registered once !!!
-            if (std::find(_resourceList.begin(), _resourceList.end(), &resource) == _resourceList.end()) {
-                _resourceList.push_back(&resource);
+            if (Find(resource) == _resourceList.end()) {
+                _resourceList.emplace_back(&resource);
+
+#if defined(__LINUX__) && !defined(__APPLE__)
+                if (_backend != POLL) {
+                    // The monitor thread subscribes it, it owns the first Events() call.
+                    _additions.push_back(&(_resourceList.back()));
+                }
+#endif
             }
 
             if (_resourceList.size() == 1) {
@@ -217,7 +300,7 @@ namespace Core {
 
                 _monitor->Run();
             } else {
-                Break();
+                Signal();
             }
 
             _adminLock.Unlock();
@@ -227,18 +310,34 @@ namespace Core {
             _adminLock.Lock();
 
             // Make sure this entry does not exist, only register resources once !!!
-            typename std::list<RESOURCE*>::iterator index(std::find(_resourceList.begin(), _resourceList.end(), &resource));
+            typename ResourceList::iterator index(Find(resource));
 
             if (index != _resourceList.end()) {
-                *index = nullptr;
-                Break();
+#if defined(__LINUX__) && !defined(__APPLE__)
+                if (_backend != POLL) {
+                    Unsubscribe(*index);
+                    _removals++;
+                }
+#endif
+                index->resource = nullptr;
+                Signal();
             }
 
             _adminLock.Unlock();
         }
         inline void Break()
         {
+#if defined(__LINUX__) && !defined(__APPLE__)
+            // A break means any resource might have changed its interest or has work
+            // pending that it wants to do on our thread, so visit them all.
+            _sweep = true;
+#endif
+            Signal();
+        }
 
+    private:
+        inline void Signal()
+        {
             ASSERT(_monitor != nullptr);
 
 #ifdef __APPLE__
@@ -256,6 +355,17 @@ namespace Core {
         };
 
     private:
+        typename ResourceList::iterator Find(const RESOURCE& resource)
+        {
+            typename ResourceList::iterator index(_resourceList.begin());
+
+            while ((index != _resourceList.end()) && (index->resource != &resource)) {
+                index++;
+            }
+
+            return (index);
+        }
+
         IS_MEMBER_AVAILABLE(Arm, hasArm);
 
         template <typename TYPE=WATCHDOG>
@@ -309,6 +419,17 @@ namespace Core {
 
 #else
 
+            if (_affinity != static_cast<uint16_t>(~0)) {
+                cpu_set_t cpus;
+
+                CPU_ZERO(&cpus);
+                CPU_SET(_affinity, &cpus);
+
+                if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) {
+                    TRACE_L1("Could not bind the monitor thread to CPU %d", _affinity);
+                }
+            }
+
             sigset_t sigset;
 
             /* Create a sigset of all the signals that we're interested in */
@@ -332,13 +453,178 @@ namespace Core {
             _descriptorArray[0].events = POLLIN;
             _descriptorArray[0].revents = 0;
 
+#ifndef __APPLE__
+            if ((_backend != POLL) && (_signalDescriptor != -1) && (_epollDescriptor == -1)) {
+                struct epoll_event signal;
+
+                signal.events = EPOLLIN;
+                signal.data.ptr = nullptr;
+
+                if ((_epollDescriptor = ::epoll_create1(EPOLL_CLOEXEC)) == -1) {
+                    TRACE_L1("Error on creating the epoll descriptor. Error %d", errno);
+                } else if (::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, _signalDescriptor, &signal) == -1) {
+                    TRACE_L1("Error on adding the signal descriptor to epoll. Error %d", errno);
+                    ::close(_epollDescriptor);
+                    _epollDescriptor = -1;
+                }
+
+                ASSERT(_epollDescriptor != -1);
+
+                return (_epollDescriptor != -1 ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
+            }
+#endif
+
             return (_signalDescriptor != -1 ? Core::ERROR_NONE : Core::ERROR_UNAVAILABLE);
         }
 #endif
 
+#if defined(__LINUX__) && !defined(__APPLE__)
+        // Bring the epoll registration in line with what the resource wants to be
+        // monitored for. Only a change in interest costs a system call.
+        void Update(Entry& entry)
+        {
+            ASSERT(entry.resource != nullptr);
+
+            uint16_t events = entry.resource->Events();
+
+            if (events == 0) {
+                Unsubscribe(entry);
+                entry.resource = nullptr;
+                _removals++;
+            } else if (events != entry.events) {
+                struct epoll_event change;
+
+                change.events = events | (_backend == EPOLL_EDGE ? EPOLLET : 0);
+                change.data.ptr = &entry;
+
+                int descriptor = entry.resource->Descriptor();
+
+                if ((entry.events == 0) && (::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, descriptor, &change) == 0)) {
+                    entry.events = events;
+                } else if (::epoll_ctl(_epollDescriptor, EPOLL_CTL_MOD, descriptor, &change) == 0) {
+                    entry.events = events;
+                } else if ((errno == ENOENT) && (::epoll_ctl(_epollDescriptor, EPOLL_CTL_ADD, descriptor, &change) == 0)) {
+                    // The kernel dropped it as the descriptor got closed and recreated under the same number.
+                    entry.events = events;
+                } else {
+                    TRACE_L1("epoll_ctl failed for descriptor %d with error <%d>", descriptor, errno);
+                }
+            }
+        }
+        void Unsubscribe(Entry& entry)
+        {
+            if (entry.events != 0) {
+                // Closed descriptors are already dropped by the kernel, so an error here is expected.
+                ::epoll_ctl(_epollDescriptor, EPOLL_CTL_DEL, entry.resource->Descriptor(), nullptr);
+                entry.events = 0;
+            }
+        }
+        void Dispatch(Entry& entry, const uint16_t flagsSet)
+        {
+            entry.revents = flagsSet;
+            entry.run = _monitorRuns;
+
+            Arm();
+
+            entry.resource->Handle(flagsSet);
+
+            Reset();
+
+            // The RESOURCE could have unregistered itself during the Handle..
+            if (entry.resource != nullptr) {
+                Update(entry);
+            }
+        }
+#endif
+
 #ifdef __LINUX__
         uint32_t Worker()
         {
+#ifndef __APPLE__
+            if (_backend != POLL) {
+                return (EpollWorker());
+            }
+#endif
+            return (PollWorker());
+        }
+
+#ifndef __APPLE__
+        uint32_t EpollWorker()
+        {
+            uint32_t delay = 0;
+
+            _monitorRuns++;
+
+            _adminLock.Lock();
+
+            // Subscribe the entries that got registered since the last run..
+            for (Entry* entry : _additions) {
+                if (entry->resource != nullptr) {
+                    Update(*entry);
+                }
+            }
+            _additions.clear();
+
+            if (_removals != 0) {
+                _resourceList.remove_if([](const Entry& entry) { return (entry.resource == nullptr); });
+                _removals = 0;
+            }
+
+            if (_resourceList.empty() == false) {
+                _adminLock.Unlock();
+
+                int result = ::epoll_wait(_epollDescriptor, _events, EventBatchSize, -1);
+
+                _adminLock.Lock();
+
+                if (result == -1) {
+                    TRACE_L1("epoll_wait failed with error <%d>", errno);
+                } else {
+                    bool breakIssued = false;
+
+                    // Only the fired descriptors are visited, that is the whole point of this backend.
+                    for (int index = 0; index < result; index++) {
+                        Entry* entry = static_cast<Entry*>(_events[index].data.ptr);
+
+                        if (entry == nullptr) {
+                            /* We have a valid signal, read the info from the fd */
+                            struct signalfd_siginfo info;
+                            uint32_t VARIABLE_IS_NOT_USED bytes = read(_signalDescriptor, &info, sizeof(info));
+                            ASSERT(bytes == sizeof(info) || bytes == 0);
+                            breakIssued = true;
+                        }
+                        // The entry might have been removed from observing in the mean time...
+                        else if (entry->resource != nullptr) {
+                            Dispatch(*entry, static_cast<uint16_t>(_events[index].events & 0xFFFF));
+                        }
+                    }
+
+                    if ((breakIssued == true) && (_sweep.exchange(false) == true)) {
+                        typename ResourceList::iterator index(_resourceList.begin());
+
+                        // Entries without events are not subscribed yet, they are picked up next run.
+                        while (index != _resourceList.end()) {
+                            if ((index->resource != nullptr) && (index->events != 0) && (index->run != _monitorRuns)) {
+                                // Event if the flagsSet == 0, call handle, maybe a break was issued by this RESOURCE..
+                                Dispatch(*index, 0);
+                            }
+                            index++;
+                        }
+                    }
+                }
+            } else {
+                _monitor->Block();
+                delay = Core::infinite;
+            }
+
+            _adminLock.Unlock();
+
+            return (delay);
+        }
+#endif
+
+        uint32_t PollWorker()
+        {
             uint32_t delay = 0;
 
             _monitorRuns++;
@@ -361,11 +647,11 @@ namespace Core {
             }
 
             int filledFileDescriptors = 1;
-            typename std::list<RESOURCE*>::iterator index = _resourceList.begin();
+            typename ResourceList::iterator index = _resourceList.begin();
 
             // Fill in all entries required/updated..
             while (index != _resourceList.end()) {
-                RESOURCE* entry = (*index);
+                RESOURCE* entry = index->resource;
 
                 uint16_t events;
 
@@ -409,7 +695,7 @@ namespace Core {
                 while (fd_index < filledFileDescriptors) {
                     ASSERT(index != _resourceList.end());
 
-                    RESOURCE* entry = (*index);
+                    RESOURCE* entry = index->resource;
 
                     // The entry might have been removed from observing in the mean time...
                     if (entry != nullptr) {
@@ -446,7 +732,7 @@ namespace Core {
         uint32_t Worker()
         {
             uint32_t delay = 0;
-            typename std::list<RESOURCE*>::iterator index;
+            typename ResourceList::iterator index;
 
             _monitorRuns++;
 
@@ -457,7 +743,7 @@ namespace Core {
 
             while (index != _resourceList.end()) {
 
-                RESOURCE* entry = (*index);
+                RESOURCE* entry = index->resource;
 
                 uint16_t events;
 
@@ -465,7 +751,7 @@ namespace Core {
                     index = _resourceList.erase(index);
                 } else {
                     if ((events & 0x8000) != 0) {
-                        ::WSAEventSelect((*index)->Descriptor(), _action, (events & 0x7FFF));
+                        ::WSAEventSelect(entry->Descriptor(), _action, (events & 0x7FFF));
                     }
                     index++;
                 }
@@ -485,7 +771,7 @@ namespace Core {
                 ::WSAResetEvent(_action);
 
                 while (index != _resourceList.end()) {
-                    RESOURCE* entry = (*index);
+                    RESOURCE* entry = index->resource;
 
                     if (entry != nullptr) {
 
@@ -519,7 +805,7 @@ namespace Core {
     private:
         MonitorWorker* _monitor;
         mutable Core::CriticalSection _adminLock;
-        std::list<RESOURCE*> _resourceList;
+        ResourceList _resourceList;
         uint32_t _monitorRuns;
         string _name;
         WATCHDOG _watchDog;
@@ -528,6 +814,15 @@ namespace Core {
         uint32_t _descriptorArrayLength;
         struct ::pollfd* _descriptorArray;
         int _signalDescriptor;
+#ifndef __APPLE__
+        const backend _backend;
+        uint16_t _affinity;
+        int _epollDescriptor;
+        std::atomic<bool> _sweep;
+        std::vector<Entry*> _additions;
+        uint32_t _removals;
+        struct epoll_event _events[EventBatchSize];
+#endif
 #endif
 
 #ifdef __WINDOWS__
@@ -565,20 +860,125 @@ namespace Core {
     typedef ResourceMonitorType<IResource, Void> ResourceMonitorBase;
 #endif
 
-    class EXTERNAL ResourceMonitor : public ResourceMonitorBase {
+    // The ResourceMonitor spreads the resources over one or more reactors, each being a
+    // ResourceMonitorBase with its own thread. A resource is pinned to a reactor by its
+    // address, so it is always registered, triggered and unregistered on the same thread.
+    class EXTERNAL ResourceMonitor {
     private:
-        ResourceMonitor()
-            : ResourceMonitorBase()
-        {
-        }
+        ResourceMonitor();
         ResourceMonitor(const ResourceMonitor&) = delete;
         ResourceMonitor& operator=(const ResourceMonitor&) = delete;
 
         friend class SingletonType<ResourceMonitor>;
 
+    public:
+        typedef ResourceMonitorBase::Metadata Metadata;
+
     public:
         static ResourceMonitor& Instance();
-        ~ResourceMonitor() {}
+        ~ResourceMonitor();
+
+        // Only effective if called before the first use of the ResourceMonitor.
+        static void Configure(const uint8_t reactors, const bool affinity);
+
+    public:
+        uint8_t Reactors() const
+        {
+            return (static_cast<uint8_t>(_reactors.size()));
+        }
+        ResourceMonitorBase& Reactor(const uint8_t index)
+        {
+            ASSERT(index < _reactors.size());
+
+            return (*(_reactors[index]));
+        }
+        uint32_t Runs() const
+        {
+            uint32_t result = 0;
+
+            for (const ResourceMonitorBase* reactor : _reactors) {
+                result += reactor->Runs();
+            }
+
+            return (result);
+        }
+        ::ThreadId Id() const
+        {
+            return (_reactors[0]->Id());
+        }
+        ::ThreadId Id(const IResource& resource) const
+        {
+            return (_reactors[Slot(resource)]->Id());
+        }
+        bool IsReactor(const ::ThreadId id) const
+        {
+            std::vector<ResourceMonitorBase*>::const_iterator index(_reactors.cbegin());
+
+            while ((index != _reactors.cend()) && ((*index)->Id() != id)) {
+                index++;
+            }
+
+            return (index != _reactors.cend());
+        }
+        uint32_t Count() const
+        {
+            uint32_t result = 0;
+
+            for (const ResourceMonitorBase* reactor : _reactors) {
+                result += reactor->Count();
+            }
+
+            return (result);
+        }
+        bool Info(const uint32_t position, Metadata& info) const
+        {
+            uint32_t offset = position;
+            std::vector<ResourceMonitorBase*>::const_iterator index(_reactors.cbegin());
+
+            while ((index != _reactors.cend()) && (offset >= (*index)->Count())) {
+                offset -= (*index)->Count();
+                index++;
+            }
+
+            return ((index != _reactors.cend()) && ((*index)->Info(offset, info) == true));
+        }
+        void Register(IResource& resource)
+        {
+            _reactors[Slot(resource)]->Register(resource);
+        }
+        void Unregister(IResource& resource)
+        {
+            _reactors[Slot(resource)]->Unregister(resource);
+        }
+        void Break()
+        {
+            for (ResourceMonitorBase* reactor : _reactors) {
+                if (reactor->Id() != 0) {
+                    reactor->Break();
+                }
+            }
+        }
+        void Break(const IResource& resource)
+        {
+            ResourceMonitorBase* reactor = _reactors[Slot(resource)];
+
+            if (reactor->Id() != 0) {
+                reactor->Break();
+            }
+        }
+
+    private:
+        uint8_t Slot(const IResource& resource) const
+        {
+            // Fibonacci hashing, resources are often allocated at a fixed stride.
+            return (_reactors.size() == 1 ? 0 : static_cast<uint8_t>(((static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&resource)) * 0x9E3779B97F4A7C15ULL) >> 32) % _reactors.size()));
+        }
+
+    private:
+        std::vector<ResourceMonitorBase*> _reactors;
+
+        static uint8_t _reactorCount;
+        static bool _affinity;
     };
 }
 } // namespace WPEFramework::Core
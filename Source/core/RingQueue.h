@@ -0,0 +1,536 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+#include "Sync.h"
+#include "Time.h"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <thread>
+
+#ifdef __LINUX__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#else
+#include <condition_variable>
+#include <mutex>
+#endif
+
+namespace WPEFramework {
+namespace Core {
+
+    // -------------------------------------------------------------------
+    // Bounded multi producer/multi consumer queue, a drop in for the
+    // QueueType. Posting and extracting entries is lock free (a ring of
+    // sequenced cells), threads waiting for an entry, or a free slot,
+    // are parked on a futex. Removing an entry turns its cell into a
+    // tombstone that is skipped by the consumer that runs into it.
+    // Post() should never block nor fail, so if the ring is full, entries
+    // spill over into a locked list, that is drained after the ring.
+    // -------------------------------------------------------------------
+    template <typename CONTEXT>
+    class RingQueueType {
+    private:
+        enum state : uint8_t {
+            EMPTY,
+            FULL,
+            CLAIMED,
+            REVOKING,
+            REVOKED
+        };
+
+        struct Cell {
+            Cell()
+                : Sequence(0)
+                , State(EMPTY)
+                , Data()
+            {
+            }
+
+            std::atomic<uint32_t> Sequence;
+            std::atomic<uint8_t> State;
+            CONTEXT Data;
+        };
+
+        class Parking {
+        public:
+            Parking(const Parking&) = delete;
+            Parking& operator=(const Parking&) = delete;
+
+            Parking()
+                : _sequence(0)
+                , _waiting(0)
+            {
+            }
+            ~Parking() = default;
+
+        public:
+            // Announce the wait, the condition must be checked once more
+            // after this, before actually going to sleep on the snapshot.
+            uint32_t Prepare()
+            {
+                _waiting.fetch_add(1);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                return (_sequence.load());
+            }
+            void Cancel()
+            {
+                _waiting.fetch_sub(1);
+            }
+            void Wait(const uint32_t snapshot, const uint32_t waitTime)
+            {
+#ifdef __LINUX__
+                if (waitTime == Core::infinite) {
+                    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_sequence), FUTEX_WAIT_PRIVATE, snapshot, nullptr, nullptr, 0);
+                } else {
+                    struct timespec timeout;
+                    timeout.tv_sec = waitTime / 1000;
+                    timeout.tv_nsec = (waitTime % 1000) * 1000000;
+                    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_sequence), FUTEX_WAIT_PRIVATE, snapshot, &timeout, nullptr, 0);
+                }
+#else
+                std::unique_lock<std::mutex> guard(_lock);
+                if (waitTime == Core::infinite) {
+                    _condition.wait(guard, [&]() { return (_sequence.load() != snapshot); });
+                } else {
+                    _condition.wait_for(guard, std::chrono::milliseconds(waitTime), [&]() { return (_sequence.load() != snapshot); });
+                }
+#endif
+                _waiting.fetch_sub(1);
+            }
+            void Wake(const bool all)
+            {
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                if (_waiting.load() != 0) {
+#ifdef __LINUX__
+                    _sequence.fetch_add(1);
+                    ::syscall(SYS_futex, reinterpret_cast<uint32_t*>(&_sequence), FUTEX_WAKE_PRIVATE, (all ? INT32_MAX : 1), nullptr, nullptr, 0);
+#else
+                    std::unique_lock<std::mutex> guard(_lock);
+                    _sequence.fetch_add(1);
+                    if (all == true) {
+                        _condition.notify_all();
+                    } else {
+                        _condition.notify_one();
+                    }
+#endif
+                }
+            }
+
+        private:
+            std::atomic<uint32_t> _sequence;
+            std::atomic<uint32_t> _waiting;
+#ifndef __LINUX__
+            std::mutex _lock;
+            std::condition_variable _condition;
+#endif
+        };
+
+        static constexpr uint8_t CacheLine = 64;
+
+        static uint32_t Capacity(const uint32_t highWaterMark)
+        {
+            uint32_t result = 2;
+
+            while (result < highWaterMark) {
+                result <<= 1;
+            }
+
+            return (result);
+        }
+
+    public:
+        RingQueueType() = delete;
+        RingQueueType(const RingQueueType<CONTEXT>&) = delete;
+        RingQueueType& operator=(const RingQueueType<CONTEXT>&) = delete;
+
+        explicit RingQueueType(const uint32_t highWaterMark)
+            : _maxSlots(highWaterMark)
+            , _mask(Capacity(highWaterMark) - 1)
+            , _cells(new Cell[_mask + 1])
+            , _disabled(false)
+            , _revoked(0)
+            , _overflowed(0)
+            , _overflow()
+            , _adminLock()
+            , _items()
+            , _space()
+        {
+            // A highwatermark of 0 is bullshit.
+            ASSERT(highWaterMark != 0);
+
+            for (uint32_t index = 0; index <= _mask; index++) {
+                _cells[index].Sequence.store(index, std::memory_order_relaxed);
+            }
+
+            _head.store(0, std::memory_order_relaxed);
+            _tail.store(0, std::memory_order_relaxed);
+        }
+        ~RingQueueType()
+        {
+            // Disable the queue and flush all entries.
+            Disable();
+            Flush();
+
+            delete[] _cells;
+        }
+
+    public:
+        bool Remove(const CONTEXT& entry)
+        {
+            // Removals are serialized, they are rare and it keeps Lock()
+            // meaningful for the ones that need to be atomic with a Remove.
+            _adminLock.Lock();
+
+            bool removed = ((_disabled == false) && (Find(entry, true) == true));
+
+            _adminLock.Unlock();
+
+            return (removed);
+        }
+        bool Post(const CONTEXT& entry)
+        {
+            bool result = false;
+
+            if (_disabled == false) {
+                result = true;
+
+                // Once spilled over, keep on spilling till the overflow is drained, to keep it FIFO.
+                if ((_overflowed.load() != 0) || (Push(entry) == false)) {
+                    _adminLock.Lock();
+                    _overflow.push_back(entry);
+                    _overflowed++;
+                    _adminLock.Unlock();
+                }
+
+                _items.Wake(false);
+            }
+
+            return (result);
+        }
+        // The ring is strictly FIFO, the class and flow of an entry are ignored.
+        bool Post(const CONTEXT& entry, const uint8_t /* level */, const uint32_t /* key */)
+        {
+            return (Post(entry));
+        }
+        bool Insert(const CONTEXT& entry, const uint32_t waitTime, const uint8_t /* level */, const uint32_t /* key */)
+        {
+            return (Insert(entry, waitTime));
+        }
+        bool Insert(const CONTEXT& entry, const uint32_t waitTime)
+        {
+            bool posted = false;
+            uint64_t deadline = Deadline(waitTime);
+
+            while ((_disabled == false) && ((posted = TryInsert(entry)) == false)) {
+                uint32_t remaining = Remaining(deadline);
+
+                if (remaining == 0) {
+                    break;
+                }
+
+                uint32_t snapshot = _space.Prepare();
+
+                if ((_disabled == true) || ((posted = TryInsert(entry)) == true)) {
+                    _space.Cancel();
+                    break;
+                }
+
+                _space.Wait(snapshot, remaining);
+            }
+
+            if (posted == true) {
+                _items.Wake(false);
+            }
+
+            return (posted);
+        }
+        bool Extract(CONTEXT& result, const uint32_t waitTime)
+        {
+            bool received = false;
+            uint64_t deadline = Deadline(waitTime);
+
+            while ((_disabled == false) && ((received = Pop(result)) == false)) {
+                uint32_t remaining = Remaining(deadline);
+
+                if (remaining == 0) {
+                    break;
+                }
+
+                uint32_t snapshot = _items.Prepare();
+
+                if ((_disabled == true) || ((received = Pop(result)) == true)) {
+                    _items.Cancel();
+                    break;
+                }
+
+                _items.Wait(snapshot, remaining);
+            }
+
+            if (received == true) {
+                _space.Wake(false);
+            }
+
+            return (received);
+        }
+        void Enable()
+        {
+            _disabled = false;
+        }
+        void Disable()
+        {
+            _disabled = true;
+
+            // Kick everyone that is parked, they will see the queue is disabled.
+            _items.Wake(true);
+            _space.Wake(true);
+        }
+        void Flush()
+        {
+            // Clear is only possible in a "DISABLED" state !!
+            ASSERT(_disabled == true);
+
+            CONTEXT entry;
+
+            while (Pop(entry) == true) {
+                entry = CONTEXT();
+            }
+        }
+        inline bool IsEmpty() const
+        {
+            return (Length() == 0);
+        }
+        inline bool IsFull() const
+        {
+            return (Length() >= _maxSlots);
+        }
+        inline uint32_t Length() const
+        {
+            // Not a snapshot, a consumer may be in the middle of taking a tombstone, do not go below 0.
+            int32_t length = static_cast<int32_t>(_tail.load() - _head.load() - _revoked.load());
+
+            return ((length > 0 ? static_cast<uint32_t>(length) : 0) + _overflowed.load());
+        }
+        inline bool HasEntry(const CONTEXT& element) const
+        {
+            _adminLock.Lock();
+
+            bool found = const_cast<RingQueueType<CONTEXT>*>(this)->Find(element, false);
+
+            _adminLock.Unlock();
+
+            return (found);
+        }
+        void Lock()
+        {
+            _adminLock.Lock();
+        }
+        void Unlock()
+        {
+            _adminLock.Unlock();
+        }
+
+    private:
+        static uint64_t Deadline(const uint32_t waitTime)
+        {
+            return (waitTime == Core::infinite ? 0 : Time::Now().Ticks() + (static_cast<uint64_t>(waitTime) * Time::TicksPerMillisecond));
+        }
+        static uint32_t Remaining(const uint64_t deadline)
+        {
+            uint32_t result = Core::infinite;
+
+            if (deadline != 0) {
+                uint64_t now = Time::Now().Ticks();
+
+                result = (now >= deadline ? 0 : std::max(static_cast<uint32_t>((deadline - now) / Time::TicksPerMillisecond), 1u));
+            }
+
+            return (result);
+        }
+        bool TryInsert(const CONTEXT& entry)
+        {
+            // Entries that spilled over go first, it is full until they are gone. The
+            // ring may be larger than the high water mark, that is only there for Post().
+            return ((_overflowed.load() == 0) && (IsFull() == false) && (Push(entry) == true));
+        }
+        bool Push(const CONTEXT& entry)
+        {
+            uint32_t position = _tail.load(std::memory_order_relaxed);
+            Cell* cell;
+
+            while (true) {
+                cell = &(_cells[position & _mask]);
+
+                int32_t delta = static_cast<int32_t>(cell->Sequence.load(std::memory_order_acquire) - position);
+
+                if (delta == 0) {
+                    if (_tail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+                        break;
+                    }
+                } else if (delta < 0) {
+                    // The ring is full.
+                    return (false);
+                } else {
+                    position = _tail.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->Data = entry;
+            cell->State.store(FULL, std::memory_order_release);
+            cell->Sequence.store(position + 1, std::memory_order_release);
+
+            return (true);
+        }
+        bool Pop(CONTEXT& result)
+        {
+            bool found = false;
+
+            while ((found == false) && (Take(result, found) == true)) {
+                // A tombstone was taken, try the next one.
+            }
+
+            if ((found == false) && (_overflowed.load() != 0)) {
+                _adminLock.Lock();
+
+                if (_overflow.empty() == false) {
+                    result = _overflow.front();
+                    _overflow.pop_front();
+                    _overflowed--;
+                    found = true;
+                }
+
+                _adminLock.Unlock();
+            }
+
+            return (found);
+        }
+        // Returns false if the ring is empty, found tells if the cell taken held a valid entry.
+        bool Take(CONTEXT& result, bool& found)
+        {
+            uint32_t position = _head.load(std::memory_order_relaxed);
+            Cell* cell;
+
+            while (true) {
+                cell = &(_cells[position & _mask]);
+
+                int32_t delta = static_cast<int32_t>(cell->Sequence.load(std::memory_order_acquire) - (position + 1));
+
+                if (delta == 0) {
+                    if (_head.compare_exchange_weak(position, position + 1, std::memory_order_relaxed) == true) {
+                        break;
+                    }
+                } else if (delta < 0) {
+                    // The ring is empty.
+                    return (false);
+                } else {
+                    position = _head.load(std::memory_order_relaxed);
+                }
+            }
+
+            uint8_t expected = FULL;
+
+            // Claim the cell, if someone is inspecting it for a Remove, wait for the verdict.
+            while (cell->State.compare_exchange_weak(expected, CLAIMED, std::memory_order_acquire) == false) {
+                if (expected == REVOKED) {
+                    break;
+                }
+                expected = FULL;
+                std::this_thread::yield();
+            }
+
+            if (expected == FULL) {
+                result = std::move(cell->Data);
+                cell->Data = CONTEXT();
+                found = true;
+            } else {
+                _revoked--;
+            }
+
+            cell->State.store(EMPTY, std::memory_order_relaxed);
+            cell->Sequence.store(position + _mask + 1, std::memory_order_release);
+
+            return (true);
+        }
+        bool Find(const CONTEXT& entry, const bool remove)
+        {
+            bool found = false;
+            uint32_t position = _head.load(std::memory_order_acquire);
+            const uint32_t tail = _tail.load(std::memory_order_acquire);
+
+            while ((found == false) && (position != tail)) {
+                Cell& cell(_cells[position & _mask]);
+                uint8_t expected = FULL;
+
+                // Lock the cell for inspection, so it can not be consumed and refilled while comparing.
+                if (cell.State.compare_exchange_strong(expected, REVOKING, std::memory_order_acquire) == true) {
+                    found = (cell.Data == entry);
+
+                    if ((found == true) && (remove == true)) {
+                        cell.Data = CONTEXT();
+                        _revoked++;
+                        cell.State.store(REVOKED, std::memory_order_release);
+                    } else {
+                        cell.State.store(FULL, std::memory_order_release);
+                    }
+                }
+
+                position++;
+            }
+
+            if ((found == false) && (_overflowed.load() != 0)) {
+                typename std::list<CONTEXT>::iterator index = std::find(_overflow.begin(), _overflow.end(), entry);
+
+                if (index != _overflow.end()) {
+                    found = true;
+
+                    if (remove == true) {
+                        _overflow.erase(index);
+                        _overflowed--;
+                    }
+                }
+            }
+
+            return (found);
+        }
+
+    private:
+        const uint32_t _maxSlots;
+        const uint32_t _mask;
+        Cell* _cells;
+        // Keep the consumer and producer positions on their own cache line.
+        uint8_t _padding1[CacheLine];
+        std::atomic<uint32_t> _head;
+        uint8_t _padding2[CacheLine - sizeof(std::atomic<uint32_t>)];
+        std::atomic<uint32_t> _tail;
+        uint8_t _padding3[CacheLine - sizeof(std::atomic<uint32_t>)];
+        std::atomic<bool> _disabled;
+        std::atomic<uint32_t> _revoked;
+        std::atomic<uint32_t> _overflowed;
+        std::list<CONTEXT> _overflow;
+        mutable CriticalSection _adminLock;
+        Parking _items;
+        Parking _space;
+    };
+}
+} // namespace Core
@@ -29,6 +29,8 @@
 #include <arpa/inet.h>
 #include <fcntl.h>
 #include <net/if.h>
+#include <netinet/tcp.h>
+#include <sys/uio.h>
 #define __ERRORRESULT__ errno
 #define __ERROR_AGAIN__ EAGAIN
 #define __ERROR_WOULDBLOCK__ EWOULDBLOCK
@@ -204,6 +206,28 @@ namespace Core {
 
 #else
 
+    // Pick the interface the datagram came in on from the control headers, if it was reported.
+    static void PacketInterface(struct msghdr& mh, const sa_family_t family, uint32_t& interfaceId) {
+        if ((mh.msg_flags & MSG_CTRUNC) == 0) {
+            for ( // iterate through the control headers
+                struct cmsghdr* cmsg = CMSG_FIRSTHDR(&mh);
+                cmsg != NULL;
+                cmsg = CMSG_NXTHDR(&mh, cmsg))
+            {
+                if ((cmsg->cmsg_level == IPPROTO_IP) && (cmsg->cmsg_type == IP_PKTINFO) && (family == AF_INET)) {
+                    const struct in_pktinfo* info = reinterpret_cast<const struct in_pktinfo*>CMSG_DATA(cmsg);
+                    interfaceId = info->ipi_ifindex;
+                    break;
+                }
+                else if ((cmsg->cmsg_level == IPPROTO_IPV6) && (cmsg->cmsg_type == IPV6_PKTINFO) && (family == AF_INET6)) {
+                    const struct in6_pktinfo* info = reinterpret_cast<const struct in6_pktinfo*>CMSG_DATA(cmsg);
+                    interfaceId = info->ipi6_ifindex;
+                    break;
+                }
+            }
+        }
+    }
+
     static uint32_t ReceiveFrom(SOCKET handle, char* buffer, int bufferSize, struct sockaddr* remote, socklen_t* remoteLength, uint32_t& interfaceId) {
         uint32_t result;
 
@@ -227,28 +251,150 @@ namespace Core {
         };
 
         result = recvmsg(handle, &mh, 0);
-        if ((static_cast<signed int>(result) != SOCKET_ERROR) && ((mh.msg_flags & MSG_CTRUNC) == 0)) {
-            for ( // iterate through the control headers
-                struct cmsghdr* cmsg = CMSG_FIRSTHDR(&mh);
-                cmsg != NULL;
-                cmsg = CMSG_NXTHDR(&mh, cmsg))
-            {
-                if ((cmsg->cmsg_level == IPPROTO_IP) && (cmsg->cmsg_type == IP_PKTINFO) && (remote->sa_family == AF_INET)) {
-                    const struct in_pktinfo* info = reinterpret_cast<const struct in_pktinfo*>CMSG_DATA(cmsg);
-                    interfaceId = info->ipi_ifindex;
-                    break;
-                }
-                else if ((cmsg->cmsg_level == IPPROTO_IPV6) && (cmsg->cmsg_type == IPV6_PKTINFO) && (remote->sa_family == AF_INET6)) {
-                    const struct in6_pktinfo* info = reinterpret_cast<const struct in6_pktinfo*>CMSG_DATA(cmsg);
-                    interfaceId = info->ipi6_ifindex;
-                    break;
-                }
-            }
+        if (static_cast<signed int>(result) != SOCKET_ERROR) {
+            PacketInterface(mh, remote->sa_family, interfaceId);
         }
 
         return (result);
     }
 
+#endif
+
+#ifdef __LINUX__
+
+    // The datagrams on their way in and out, with the address and control headers of each, laid out the way
+    // recvmmsg and sendmmsg want them. Slots [_head, _tail) still have to be sent.
+    class SocketPort::DatagramRing {
+    private:
+        static constexpr uint16_t ControlSize = 64;
+
+    public:
+        DatagramRing() = delete;
+        DatagramRing(const DatagramRing&) = delete;
+        DatagramRing& operator=(const DatagramRing&) = delete;
+
+        DatagramRing(const uint8_t slots, const uint16_t sendSize, const uint16_t receiveSize)
+            : _slots(slots)
+            , _sendSize(sendSize)
+            , _receiveSize(receiveSize)
+            , _buffer(slots * (sendSize + receiveSize))
+            , _send(slots)
+            , _receive(slots)
+            , _vectors(2 * slots)
+            , _addresses(2 * slots)
+            , _control(slots * (ControlSize / sizeof(uint64_t)))
+            , _head(0)
+            , _tail(0)
+        {
+            ::memset(_send.data(), 0, slots * sizeof(struct mmsghdr));
+            ::memset(_receive.data(), 0, slots * sizeof(struct mmsghdr));
+
+            for (uint8_t index = 0; index < slots; index++) {
+                _vectors[index].iov_base = SendBuffer(index);
+                _send[index].msg_hdr.msg_iov = &(_vectors[index]);
+                _send[index].msg_hdr.msg_iovlen = 1;
+
+                _vectors[slots + index].iov_base = ReceiveBuffer(index);
+                _receive[index].msg_hdr.msg_iov = &(_vectors[slots + index]);
+                _receive[index].msg_hdr.msg_iovlen = 1;
+                _receive[index].msg_hdr.msg_name = &(_addresses[slots + index]);
+                _receive[index].msg_hdr.msg_control = &(_control[index * (ControlSize / sizeof(uint64_t))]);
+            }
+        }
+        ~DatagramRing() = default;
+
+    public:
+        inline uint8_t Slots() const
+        {
+            return (_slots);
+        }
+        inline bool IsSent() const
+        {
+            return (_head == _tail);
+        }
+        inline uint8_t* SendBuffer(const uint8_t slot)
+        {
+            return (&(_buffer[slot * _sendSize]));
+        }
+        inline uint8_t* ReceiveBuffer(const uint8_t slot)
+        {
+            return (&(_buffer[(_slots * _sendSize) + (slot * _receiveSize)]));
+        }
+        inline void Clear()
+        {
+            _head = 0;
+            _tail = 0;
+        }
+        // Queue the datagram in the next free send slot.
+        void Load(const uint16_t length, const NodeId& destination)
+        {
+            ASSERT(_tail < _slots);
+
+            struct msghdr& message(_send[_tail].msg_hdr);
+
+            _vectors[_tail].iov_len = length;
+
+            if (destination.IsValid() == true) {
+                _addresses[_tail] = static_cast<const NodeId::SocketInfo&>(destination);
+                message.msg_name = &(_addresses[_tail]);
+                message.msg_namelen = destination.Size();
+            } else {
+                message.msg_name = nullptr;
+                message.msg_namelen = 0;
+            }
+
+            _tail++;
+        }
+        int Send(SOCKET socket)
+        {
+            const int result = ::sendmmsg(socket, &(_send[_head]), _tail - _head, 0);
+
+            if (result > 0) {
+                _head += static_cast<uint8_t>(result);
+            }
+
+            return (result);
+        }
+        int Receive(SOCKET socket)
+        {
+            for (uint8_t index = 0; index < _slots; index++) {
+                struct msghdr& message(_receive[index].msg_hdr);
+
+                _vectors[_slots + index].iov_len = _receiveSize;
+                message.msg_namelen = sizeof(NodeId::SocketInfo);
+                message.msg_controllen = ControlSize;
+                message.msg_flags = 0;
+            }
+
+            return (::recvmmsg(socket, _receive.data(), _slots, 0, nullptr));
+        }
+        inline uint32_t Received(const uint8_t slot) const
+        {
+            return (_receive[slot].msg_len);
+        }
+        inline const NodeId::SocketInfo& Origin(const uint8_t slot) const
+        {
+            return (_addresses[_slots + slot]);
+        }
+        inline void Interface(const uint8_t slot, uint32_t& interfaceId)
+        {
+            PacketInterface(_receive[slot].msg_hdr, _addresses[_slots + slot].FamilyType, interfaceId);
+        }
+
+    private:
+        const uint8_t _slots;
+        const uint16_t _sendSize;
+        const uint16_t _receiveSize;
+        std::vector<uint8_t> _buffer;
+        std::vector<struct mmsghdr> _send;
+        std::vector<struct mmsghdr> _receive;
+        std::vector<struct iovec> _vectors;
+        std::vector<NodeId::SocketInfo> _addresses;
+        std::vector<uint64_t> _control;
+        uint8_t _head;
+        uint8_t _tail;
+    };
+
 #endif
 
     //////////////////////////////////////////////////////////////////////
@@ -302,6 +448,16 @@ namespace Core {
 
         return (false);
     }
+    // Small messages, like JSON-RPC calls and their responses, go out as they are written. Waiting for the
+    // previous segment to be acknowledged only adds latency, certainly with several calls on their way.
+    void SetNoDelay(SOCKET socket)
+    {
+        int optval = 1;
+
+        if (::setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast<const char*>(&optval), sizeof(optval)) < 0) {
+            TRACE_L1("Error on setting TCP_NODELAY option. Error %d", __ERRORRESULT__);
+        }
+    }
     //////////////////////////////////////////////////////////////////////
     // Construction/Destruction
     //////////////////////////////////////////////////////////////////////
@@ -337,6 +493,14 @@ namespace Core {
         , m_ReceivedNode()
         , m_SendBuffer(nullptr)
         , m_ReceiveBuffer(nullptr)
+        , m_ReadBytes(0)
+        , m_SendBytes(0)
+        , m_SendOffset(0)
+        , m_SegmentCount(0)
+        , m_SegmentIndex(0)
+        , m_SegmentOffset(0)
+        , m_BatchSlots(0)
+        , m_Ring(nullptr)
         , m_Interface(~0)
         , m_SystemdSocket(false)
     {
@@ -374,6 +538,14 @@ namespace Core {
         , m_ReceivedNode()
         , m_SendBuffer(nullptr)
         , m_ReceiveBuffer(nullptr)
+        , m_ReadBytes(0)
+        , m_SendBytes(0)
+        , m_SendOffset(0)
+        , m_SegmentCount(0)
+        , m_SegmentIndex(0)
+        , m_SegmentOffset(0)
+        , m_BatchSlots(0)
+        , m_Ring(nullptr)
         , m_Interface(~0)
         , m_SystemdSocket(false)
     {
@@ -408,6 +580,10 @@ namespace Core {
             DestroySocket(m_Socket);
         }
 
+#ifdef __LINUX__
+        delete m_Ring;
+#endif
+
         ::free(m_SendBuffer);
     }
 
@@ -471,6 +647,9 @@ namespace Core {
         m_ReadBytes = 0;
         m_SendBytes = 0;
         m_SendOffset = 0;
+        m_SegmentCount = 0;
+        m_SegmentIndex = 0;
+        m_SegmentOffset = 0;
 
         if ((m_State & (SocketPort::LINK | SocketPort::OPEN | SocketPort::MONITOR)) == (SocketPort::LINK | SocketPort::OPEN)) {
             // Open up an accepted socket, but not yet added to the monitor.
@@ -493,6 +672,16 @@ namespace Core {
                 if ((m_SocketType == DATAGRAM) || ((m_SocketType == RAW) && (m_RemoteNode.IsValid() == false))) {
                     m_State = SocketPort::OPEN | SocketPort::READ;
 
+#ifdef __LINUX__
+                    // The buffer sizes are known by now, lay out the slots for them.
+                    delete m_Ring;
+                    m_Ring = nullptr;
+
+                    if ((m_BatchSlots > 1) && (m_SocketType == DATAGRAM) && (m_LocalNode.Type() != NodeId::TYPE_NETLINK)) {
+                        m_Ring = new DatagramRing(m_BatchSlots, m_SendBufferSize, m_ReceiveBufferSize);
+                    }
+#endif
+
                     nStatus = Core::ERROR_NONE;
                 } else if (m_SocketType == LISTEN) {
                     if (::listen(m_Socket, MAX_LISTEN_QUEUE) == SOCKET_ERROR) {
@@ -578,7 +767,7 @@ namespace Core {
 #endif
                 }
 
-                ResourceMonitor::Instance().Break();
+                ResourceMonitor::Instance().Break(*this);
             }
 
             if (waitTime > 0) {
@@ -590,7 +779,7 @@ namespace Core {
 
                     // We probably did not get a response from the otherside on the close
                     // sloppy but let's forcefully close it
-                    ResourceMonitor::Instance().Break();
+                    ResourceMonitor::Instance().Break(*this);
 
                     closed = (WaitForClosure(Core::infinite) == Core::ERROR_NONE);
 
@@ -611,7 +800,7 @@ namespace Core {
         if ((m_State & (SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) {
 
             m_State |= SocketPort::WRITESLOT;
-            ResourceMonitor::Instance().Break();
+            ResourceMonitor::Instance().Break(*this);
         }
         m_syncAdmin.Unlock();
     }
@@ -750,6 +939,10 @@ namespace Core {
             if (::setsockopt(l_Result, SOL_SOCKET, SO_REUSEADDR, (const char*)&optval, optionLength) < 0) {
                 TRACE_L1("Error on setting SO_REUSEADDR option. Error %d: %s", __ERRORRESULT__, strerror(__ERRORRESULT__));
             }
+
+            if (SocketMode() == SOCK_STREAM) {
+                SetNoDelay(l_Result);
+            }
         }
 
 #ifndef __WINDOWS__
@@ -853,7 +1046,7 @@ namespace Core {
         // Right, a wait till connection is closed is requested..
         while ((waiting > 0) && (IsOpen() == false)) {
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id(*this));
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -888,7 +1081,7 @@ namespace Core {
                 break;
             }
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id(*this));
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -917,7 +1110,7 @@ namespace Core {
         // Right, a wait till connection is closed is requested..
         while ((waiting > 0) && (IsClosed() == false)) {
             // Make sure we aren't in the monitor thread waiting for close completion.
-            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id());
+            ASSERT(Core::Thread::ThreadId() != ResourceMonitor::Instance().Id(*this));
 
             uint32_t sleepSlot = (waiting > SLEEPSLOT_TIME ? SLEEPSLOT_TIME : waiting);
 
@@ -1051,29 +1244,121 @@ namespace Core {
         return (::send(m_Socket, reinterpret_cast<const char*>(buffer), length, 0));
     }
 
+    /* virtual */ int32_t SocketPort::Write(const Segment segments[], const uint8_t count) {
+        int32_t result = 0;
+
+#ifdef __WINDOWS__
+        uint8_t index = 0;
+        bool completed = true;
+
+        while ((completed == true) && (index < count)) {
+            uint32_t offset = 0;
+
+            while ((completed == true) && (offset < segments[index].Length)) {
+                const uint16_t length = static_cast<uint16_t>(std::min(segments[index].Length - offset, static_cast<uint32_t>(0xFFFF)));
+                const int32_t sent = Write(&(segments[index].Data[offset]), length);
+
+                if (sent < 0) {
+                    result = (result == 0 ? sent : result);
+                    completed = false;
+                } else {
+                    result += sent;
+                    offset += sent;
+                    completed = (sent == length);
+                }
+            }
+            index++;
+        }
+#else
+        struct iovec vector[MaxSegments + 1];
+        struct msghdr message;
+
+        ASSERT(count <= (MaxSegments + 1));
+
+        for (uint8_t index = 0; index < count; index++) {
+            vector[index].iov_base = const_cast<uint8_t*>(segments[index].Data);
+            vector[index].iov_len = segments[index].Length;
+        }
+
+        ::memset(&message, 0, sizeof(message));
+        message.msg_iov = vector;
+        message.msg_iovlen = count;
+
+        // Unconnected datagram sockets need to know where to go.
+        if (((m_State & SocketPort::LINK) == 0) && (m_RemoteNode.IsValid() == true)) {
+            message.msg_name = const_cast<struct sockaddr*>(static_cast<const struct sockaddr*>(static_cast<const NodeId&>(m_RemoteNode)));
+            message.msg_namelen = m_RemoteNode.Size();
+        }
+
+        result = static_cast<int32_t>(::sendmsg(m_Socket, &message, 0));
+#endif
+
+        return (result);
+    }
+
     void SocketPort::Write()
     {
-        bool dataLeftToSend = true;
+        // With a ring, the datagrams are all sent in batches.
+        bool dataLeftToSend = (m_Ring == nullptr);
 
         m_syncAdmin.Lock();
 
         m_State &= (~(SocketPort::WRITE | SocketPort::WRITESLOT));
 
+#ifdef __LINUX__
+        if (m_Ring != nullptr) {
+            WriteBatch();
+        }
+#endif
+
         while (((m_State & (SocketPort::WRITE | SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) && (dataLeftToSend == true)) {
-            if (m_SendOffset == m_SendBytes) {
-                m_SendBytes = SendData(m_SendBuffer, m_SendBufferSize);
+            if ((m_SendOffset == m_SendBytes) && (m_SegmentIndex == m_SegmentCount)) {
+                uint8_t count = MaxSegments;
+
+                m_SendBytes = GatherData(m_SendBuffer, m_SendBufferSize, m_Segments, count);
                 m_SendOffset = 0;
-                dataLeftToSend = (m_SendOffset != m_SendBytes);
+                m_SegmentCount = 0;
+                m_SegmentIndex = 0;
+                m_SegmentOffset = 0;
 
                 ASSERT(m_SendBytes <= m_SendBufferSize);
+                ASSERT(count <= MaxSegments);
+
+                // Empty segments have nothing to add, drop them.
+                for (uint8_t index = 0; index < count; index++) {
+                    if (m_Segments[index].Length != 0) {
+                        m_Segments[m_SegmentCount++] = m_Segments[index];
+                    }
+                }
+
+                dataLeftToSend = ((m_SendOffset != m_SendBytes) || (m_SegmentCount != 0));
             }
 
             if (dataLeftToSend == true) {
                 int32_t sendSize;
 
-                // Sockets are non blocking the Send buffer size is equal to the buffer size. We only send
-                // if the buffer free (SEND flag) is active, so the buffer should always fit.
-                if (((m_State & SocketPort::LINK) == 0) && (m_RemoteNode.IsValid() == true)) {
+                if (m_SegmentIndex != m_SegmentCount) {
+                    // Whatever is left in the send buffer, followed by the segments, in one go.
+                    Segment segments[MaxSegments + 1];
+                    uint8_t count = 0;
+
+                    if (m_SendOffset != m_SendBytes) {
+                        segments[count].Data = &(m_SendBuffer[m_SendOffset]);
+                        segments[count].Length = m_SendBytes - m_SendOffset;
+                        count++;
+                    }
+                    for (uint8_t index = m_SegmentIndex; index < m_SegmentCount; index++, count++) {
+                        const uint32_t offset = (index == m_SegmentIndex ? m_SegmentOffset : 0);
+
+                        segments[count].Data = &(m_Segments[index].Data[offset]);
+                        segments[count].Length = m_Segments[index].Length - offset;
+                    }
+
+                    sendSize = Write(segments, count);
+
+                } else if (((m_State & SocketPort::LINK) == 0) && (m_RemoteNode.IsValid() == true)) {
+                    // Sockets are non blocking the Send buffer size is equal to the buffer size. We only send
+                    // if the buffer free (SEND flag) is active, so the buffer should always fit.
                     ASSERT(m_RemoteNode.IsValid() == true);
 
                     sendSize = ::sendto(m_Socket,
@@ -1087,7 +1372,30 @@ namespace Core {
                 }
 
                 if (sendSize >= 0) {
-                    m_SendOffset = ((m_State & SocketPort::LINK) != 0 ? m_SendOffset + sendSize : m_SendBytes);
+                    if ((m_State & SocketPort::LINK) == 0) {
+                        // A datagram goes as a whole, or not at all.
+                        m_SendOffset = m_SendBytes;
+                        m_SegmentIndex = m_SegmentCount;
+                    } else {
+                        uint32_t sent = static_cast<uint32_t>(sendSize);
+                        const uint16_t buffered = std::min(static_cast<uint32_t>(m_SendBytes - m_SendOffset), sent);
+
+                        m_SendOffset += buffered;
+                        sent -= buffered;
+
+                        while ((sent != 0) && (m_SegmentIndex < m_SegmentCount)) {
+                            const uint32_t left = m_Segments[m_SegmentIndex].Length - m_SegmentOffset;
+
+                            if (sent >= left) {
+                                sent -= left;
+                                m_SegmentIndex++;
+                                m_SegmentOffset = 0;
+                            } else {
+                                m_SegmentOffset += sent;
+                                sent = 0;
+                            }
+                        }
+                    }
                 } else {
                     uint32_t l_Result = __ERRORRESULT__;
 
@@ -1111,6 +1419,13 @@ namespace Core {
 
         m_State &= (~SocketPort::READ);
 
+#ifdef __LINUX__
+        if (m_Ring != nullptr) {
+            // Only returns once all is read, the loop below has nothing left to do.
+            ReadBatch();
+        }
+#endif
+
         while ((m_State & (SocketPort::READ | SocketPort::EXCEPTION | SocketPort::OPEN)) == SocketPort::OPEN) {
             uint32_t l_Size;
 
@@ -1170,6 +1485,74 @@ namespace Core {
         m_syncAdmin.Unlock();
     }
 
+#ifdef __LINUX__
+
+    void SocketPort::WriteBatch()
+    {
+        bool dataLeftToSend = true;
+
+        while (((m_State & (SocketPort::WRITE | SocketPort::SHUTDOWN | SocketPort::OPEN | SocketPort::EXCEPTION)) == SocketPort::OPEN) && (dataLeftToSend == true)) {
+            if (m_Ring->IsSent() == true) {
+                // Fill up the slots with what is waiting, each datagram to where the RemoteNode points at that time.
+                uint16_t size;
+
+                m_Ring->Clear();
+
+                for (uint8_t slot = 0; (slot < m_Ring->Slots()) && ((size = SendData(m_Ring->SendBuffer(slot), m_SendBufferSize)) != 0); slot++) {
+                    ASSERT(size <= m_SendBufferSize);
+
+                    m_Ring->Load(size, m_RemoteNode);
+                }
+
+                dataLeftToSend = (m_Ring->IsSent() == false);
+            }
+
+            if ((dataLeftToSend == true) && (m_Ring->Send(m_Socket) < 0)) {
+                uint32_t l_Result = __ERRORRESULT__;
+
+                if ((l_Result == __ERROR_WOULDBLOCK__) || (l_Result == __ERROR_AGAIN__) || (l_Result == __ERROR_INPROGRESS__)) {
+                    m_State |= SocketPort::WRITE;
+                } else {
+                    printf("Write exception %d: %s\n", l_Result, strerror(__ERRORRESULT__));
+                    m_State |= SocketPort::EXCEPTION;
+                    StateChange();
+                }
+            }
+        }
+    }
+
+    void SocketPort::ReadBatch()
+    {
+        while ((m_State & (SocketPort::READ | SocketPort::EXCEPTION | SocketPort::OPEN)) == SocketPort::OPEN) {
+            const int count = m_Ring->Receive(m_Socket);
+
+            if (count >= 0) {
+                for (uint8_t slot = 0; slot < static_cast<uint8_t>(count); slot++) {
+                    const uint16_t size = static_cast<uint16_t>(m_Ring->Received(slot));
+
+                    m_ReceivedNode = m_Ring->Origin(slot);
+                    m_Ring->Interface(slot, m_Interface);
+
+                    if (size != 0) {
+                        ReceiveData(m_Ring->ReceiveBuffer(slot), size);
+                    }
+                }
+            } else {
+                uint32_t l_Result = __ERRORRESULT__;
+
+                if ((l_Result == __ERROR_WOULDBLOCK__) || (l_Result == __ERROR_AGAIN__) || (l_Result == __ERROR_INPROGRESS__) || (l_Result == 0)) {
+                    m_State |= SocketPort::READ;
+                } else if (l_Result != 0) {
+                    printf("Read exception %d: %s\n", l_Result, strerror(__ERRORRESULT__));
+                    m_State |= SocketPort::EXCEPTION;
+                    StateChange();
+                }
+            }
+        }
+    }
+
+#endif
+
     bool SocketPort::Closed()
     {
         bool result = true;
@@ -1238,6 +1621,10 @@ namespace Core {
             // Align the buffer to what is requested
             BufferAlignment(result);
 
+            if ((address.FamilyType == AF_INET) || (address.FamilyType == AF_INET6)) {
+                SetNoDelay(result);
+            }
+
             remoteId = address;
         } else {
             int error = __ERRORRESULT__;
@@ -81,6 +81,14 @@ namespace Core {
 
         } enumType;
 
+        // A block of data, owned by the implementation, that is sent as is, following the data in the send buffer.
+        struct Segment {
+            const uint8_t* Data;
+            uint32_t Length;
+        };
+
+        static constexpr uint8_t MaxSegments = 4;
+
     public:
         SocketPort(const enumType socketType,
             const NodeId& localNode,
@@ -214,12 +222,31 @@ namespace Core {
             m_ReadBytes = 0;
             m_SendBytes = 0;
             m_SendOffset = 0;
+            m_SegmentCount = 0;
+            m_SegmentIndex = 0;
+            m_SegmentOffset = 0;
             m_syncAdmin.Unlock();
         }
 
         uint32_t TTL() const;
         uint32_t TTL(const uint8_t value);
 
+        // Datagram sockets only: move up to slots datagrams per system call (recvmmsg/sendmmsg), through a ring of
+        // datagram slots the size of the send and receive buffer. Each datagram is still produced by its own SendData
+        // call, sent to the RemoteNode set at that moment, and handed to ReceiveData on its own, with its ReceivedNode.
+        // What ReceiveData does not consume of a datagram is dropped. Set it before opening the socket. Platforms
+        // without these calls move one datagram at a time.
+        inline void Batch(const uint8_t slots)
+        {
+            ASSERT(IsOpen() == false);
+
+            m_BatchSlots = slots;
+        }
+        inline uint8_t Batch() const
+        {
+            return (m_BatchSlots);
+        }
+
         bool Broadcast(const bool enabled);
 
         bool Join(const NodeId& multicastAddress);
@@ -238,6 +265,16 @@ namespace Core {
         virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
         virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
 
+        // Gather output. Next to what is put in the send buffer, up to count (MaxSegments) segments can be handed out
+        // that are sent right after it, in one go, without copying them in the send buffer first. The data they refer
+        // to must stay as is until the next call to GatherData, or until the socket is closed. By default, all goes
+        // through the send buffer.
+        virtual uint16_t GatherData(uint8_t* dataFrame, const uint16_t maxSendSize, Segment[] /* segments */, uint8_t& count)
+        {
+            count = 0;
+            return (SendData(dataFrame, maxSendSize));
+        }
+
         // Signal a state change, Opened, Closed or Accepted
         virtual void StateChange() = 0;
 
@@ -254,8 +291,11 @@ namespace Core {
         virtual uint32_t Initialize();
         virtual int32_t Read(uint8_t buffer[], const uint16_t length) const;
         virtual int32_t Write(const uint8_t buffer[], const uint16_t length);
+        virtual int32_t Write(const Segment segments[], const uint8_t count);
 
     private:
+        class DatagramRing;
+
         virtual IResource::handle Descriptor() const override
         {
             return (static_cast<IResource::handle>(m_Socket));
@@ -271,6 +311,8 @@ namespace Core {
         void Accepted();
         void Read();
         void Write();
+        void ReadBatch();
+        void WriteBatch();
         void BufferAlignment(SOCKET socket);
         SOCKET ConstructSocket(NodeId& localNode, const string& interfaceName);
         uint32_t WaitForOpen(const uint32_t time) const;
@@ -294,6 +336,12 @@ namespace Core {
         uint16_t m_ReadBytes;
         uint16_t m_SendBytes;
         uint16_t m_SendOffset;
+        Segment m_Segments[MaxSegments];
+        uint8_t m_SegmentCount;
+        uint8_t m_SegmentIndex;
+        uint32_t m_SegmentOffset;
+        uint8_t m_BatchSlots;
+        DatagramRing* m_Ring;
         uint32_t m_Interface;
         bool m_SystemdSocket;
     };
@@ -21,7 +21,11 @@
 
 #include "Thread.h"
 #include "ResourceMonitor.h"
+#include "FairQueue.h"
 #include "Number.h"
+#include "RingQueue.h"
+
+#include <deque>
 
 namespace WPEFramework {
 
@@ -29,6 +33,25 @@ namespace Core {
 
     class EXTERNAL ThreadPool {
     public:
+        // SHARED: all minions pull from the one queue.
+        // STEALING: each minion has its own deque as well, jobs submitted from a minion go
+        // to its own deque, idle minions steal from their siblings. Jobs submitted from
+        // other threads still go through the shared queue.
+        enum scheduling : uint8_t {
+            SHARED,
+            STEALING
+        };
+
+        // Jobs of a higher priority are always extracted first from the shared queue.
+        // Within a priority, jobs are served round robin per key (e.g. per plugin).
+        // Jobs that go to the local deque of a minion (STEALING) or through the lock
+        // free queue, are served in order.
+        enum priority : uint8_t {
+            HIGH,
+            MEDIUM,
+            LOW
+        };
+
         struct EXTERNAL IJob : public IDispatch {
             ~IJob() override = default;
 
@@ -111,9 +134,19 @@ namespace Core {
             ProxyType<IDispatch> _job;
             uint64_t _time;
         };
-        typedef QueueType< MeasurableJob > MessageQueue;
+        #ifdef __CORE_THREADPOOL_LOCKFREE_QUEUE__
+        typedef RingQueueType< MeasurableJob > MessageQueue;
         #else
-        typedef QueueType< ProxyType<IDispatch> > MessageQueue;
+        typedef FairQueueType< MeasurableJob > MessageQueue;
+        #endif
+        typedef MeasurableJob Request;
+        #else
+        #ifdef __CORE_THREADPOOL_LOCKFREE_QUEUE__
+        typedef RingQueueType< ProxyType<IDispatch> > MessageQueue;
+        #else
+        typedef FairQueueType< ProxyType<IDispatch> > MessageQueue;
+        #endif
+        typedef ProxyType<IDispatch> Request;
         #endif
 
     public:   
@@ -311,6 +344,12 @@ POP_WARNING()
                 , _interestCount(0)
                 , _currentRequest()
                 , _runs(0)
+                , _threadId(0)
+                , _dequeLock()
+                , _deque()
+                , _localRuns(0)
+                , _globalRuns(0)
+                , _stolenRuns(0)
             {
 		ASSERT(dispatcher != nullptr);
             }
@@ -320,6 +359,18 @@ POP_WARNING()
             uint32_t Runs() const {
                 return (_runs);
             }
+            uint32_t LocalRuns() const {
+                return (_localRuns);
+            }
+            uint32_t GlobalRuns() const {
+                return (_globalRuns);
+            }
+            uint32_t StolenRuns() const {
+                return (_stolenRuns);
+            }
+            ::ThreadId Id() const {
+                return (_threadId);
+            }
             bool IsActive() const {
                 return (_currentRequest.IsValid());
             }
@@ -342,9 +393,12 @@ POP_WARNING()
             }
             void Process()
             {
+                // Thread::Id() is not what Thread::ThreadId() reports on all platforms, keep our own.
+                _threadId = Thread::ThreadId();
+
 		_dispatcher->Initialize();
 
-                while (_parent._queue.Extract(_currentRequest, infinite) == true) {
+                while (Next() == true) {
 
                     ASSERT(_currentRequest.IsValid() == true);
 
@@ -391,18 +445,127 @@ POP_WARNING()
 		_dispatcher->Deinitialize();
             }
 
+        private:
+            friend class ThreadPool;
+
+            // The own deque is used LIFO by the owner, for locality, and FIFO by thieves.
+            void Push(const ProxyType<IDispatch>& job) {
+                _dequeLock.Lock();
+                _deque.emplace_back(job);
+                _dequeLock.Unlock();
+            }
+            bool Pop(Request& request) {
+                bool result = false;
+                _dequeLock.Lock();
+                if (_deque.empty() == false) {
+                    request = _deque.back();
+                    _deque.pop_back();
+                    result = true;
+                }
+                _dequeLock.Unlock();
+                return (result);
+            }
+            bool Steal(Request& request) {
+                bool result = false;
+                _dequeLock.Lock();
+                if (_deque.empty() == false) {
+                    request = _deque.front();
+                    _deque.pop_front();
+                    result = true;
+                }
+                _dequeLock.Unlock();
+                return (result);
+            }
+            bool Remove(const ProxyType<IDispatch>& job) {
+                _dequeLock.Lock();
+                std::deque<Request>::iterator index = std::find(_deque.begin(), _deque.end(), Request(job));
+                bool result = (index != _deque.end());
+                if (result == true) {
+                    _deque.erase(index);
+                }
+                _dequeLock.Unlock();
+                return (result);
+            }
+            uint32_t Length() const {
+                _dequeLock.Lock();
+                uint32_t result = static_cast<uint32_t>(_deque.size());
+                _dequeLock.Unlock();
+                return (result);
+            }
+            bool Next() {
+                bool result = false;
+
+                if (_parent._mode == SHARED) {
+                    result = _parent._queue.Extract(_currentRequest, infinite);
+                    _globalRuns += (result ? 1 : 0);
+                }
+                else {
+                    bool parked = false;
+
+                    while ((result == false) && (parked == false)) {
+                        if (Pop(_currentRequest) == true) {
+                            _localRuns++;
+                            result = true;
+                        }
+                        else if (_parent._queue.Extract(_currentRequest, 0) == true) {
+                            result = Received();
+                        }
+                        else if (_parent.Steal(*this, _currentRequest) == true) {
+                            _stolenRuns++;
+                            result = true;
+                        }
+                        else {
+                            // Announce we are going idle and look once more, whoever pushes on its own
+                            // deque from now on, sees us idle and nudges us through the shared queue.
+                            _parent._idle++;
+
+                            if (_parent.Steal(*this, _currentRequest) == true) {
+                                _stolenRuns++;
+                                result = true;
+                            }
+                            else if (_parent._queue.Extract(_currentRequest, infinite) == true) {
+                                result = Received();
+                            }
+                            else {
+                                // The queue is disabled, time to stop.
+                                parked = true;
+                            }
+
+                            _parent._idle--;
+                        }
+                    }
+                }
+
+                return (result);
+            }
+            bool Received() {
+                bool result = _currentRequest.IsValid();
+
+                if (result == true) {
+                    _globalRuns++;
+                }
+                else {
+                    // Just a nudge to go and look for work at our siblings.
+                    _parent._nudges--;
+                }
+
+                return (result);
+            }
+
         private:
             ThreadPool& _parent;
             IDispatcher* _dispatcher;
             CriticalSection _adminLock;
             Event _signal;
             std::atomic<uint32_t> _interestCount;
-            #ifdef __CORE_WARNING_REPORTING__
-            MeasurableJob _currentRequest;
-            #else
-            ProxyType<IDispatch> _currentRequest;
-            #endif
+            Request _currentRequest;
             uint32_t _runs;
+            ::ThreadId _threadId;
+            mutable CriticalSection _dequeLock;
+            std::deque<Request> _deque;
+            std::atomic<uint32_t> _localRuns;
+            std::atomic<uint32_t> _globalRuns;
+            std::atomic<uint32_t> _stolenRuns;
         };
 
     private:
@@ -439,6 +602,9 @@ POP_WARNING()
             Minion& Me() {
                 return (_minion);
             }
+            const Minion& Me() const {
+                return (_minion);
+            }
 
         private:
             uint32_t Worker() override
@@ -456,9 +622,12 @@ POP_WARNING()
         ThreadPool(const ThreadPool& a_Copy) = delete;
         ThreadPool& operator=(const ThreadPool& a_RHS) = delete;
 
-        ThreadPool(const uint8_t count, const uint32_t stackSize, const uint32_t queueSize, IDispatcher* dispatcher, IScheduler* scheduler) 
+        ThreadPool(const uint8_t count, const uint32_t stackSize, const uint32_t queueSize, IDispatcher* dispatcher, IScheduler* scheduler, const scheduling mode = SHARED) 
             : _queue(queueSize)
             , _scheduler(scheduler)
+            , _mode(mode)
+            , _idle(0)
+            , _nudges(0)
         {
             const TCHAR* name = _T("WorkerPool::Thread");
             for (uint8_t index = 0; index < count; index++) {
@@ -475,9 +644,26 @@ POP_WARNING()
         {
             return (static_cast<uint8_t>(_units.size()));
         }
+        scheduling Mode() const
+        {
+            return (_mode);
+        }
         uint32_t Pending() const
         {
-            return (_queue.Length());
+            // Nudges are no real work, they just wake up an idle minion.
+            uint32_t nudges = _nudges;
+            uint32_t length = _queue.Length();
+            uint32_t result = (length > nudges ? length - nudges : 0);
+
+            if (_mode == STEALING) {
+                std::list<Executor>::const_iterator ptr = _units.cbegin();
+                while (ptr != _units.cend()) {
+                    result += ptr->Me().Length();
+                    ptr++;
+                }
+            }
+
+            return (result);
         }
         void Runs(const uint8_t length, uint32_t* counters) const 
         {
@@ -489,6 +675,18 @@ POP_WARNING()
                 count++; 
             }
         }
+        void Origins(const uint8_t length, uint32_t* local, uint32_t* global, uint32_t* stolen) const
+        {
+            uint8_t count = 0;
+            std::list<Executor>::const_iterator ptr = _units.cbegin();
+            while ((count < length) && (ptr != _units.cend())) {
+                local[count] = ptr->Me().LocalRuns();
+                global[count] = ptr->Me().GlobalRuns();
+                stolen[count] = ptr->Me().StolenRuns();
+                ptr++;
+                count++;
+            }
+        }
         uint8_t Active() const
         {
             uint8_t count = 0;
@@ -514,15 +712,25 @@ POP_WARNING()
             return (ptr != _units.cend() ? ptr->Id() : 0);
         }
         void Submit(const ProxyType<IDispatch>& job, const uint32_t waitTime)
+        {
+            Submit(job, waitTime, MEDIUM, 0);
+        }
+        void Submit(const ProxyType<IDispatch>& job, const uint32_t waitTime, const priority level, const uint32_t key)
         {
             ASSERT(job.IsValid() == true);
             ASSERT(_queue.HasEntry(job) == false);
 
-            if (Thread::ThreadId() == ResourceMonitor::Instance().Id()) {
-                _queue.Post(job);
+            Minion* local = Local();
+
+            if (local != nullptr) {
+                local->Push(job);
+                Nudge();
+            }
+            else if (ResourceMonitor::Instance().IsReactor(Thread::ThreadId()) == true) {
+                _queue.Post(job, level, key);
             }
             else {
-                _queue.Insert(job, waitTime);
+                _queue.Insert(job, waitTime, level, key);
             }
 
         }
@@ -532,7 +740,19 @@ POP_WARNING()
 
             ASSERT(job.IsValid() == true);
 
-            if (_queue.Remove(job) == true) {
+            _queue.Lock();
+            bool removed = (_queue.Remove(job) == true);
+
+            if (_mode == STEALING) {
+                std::list<Executor>::iterator index = _units.begin();
+                while ((removed == false) && (index != _units.end())) {
+                    removed = index->Me().Remove(job);
+                    index++;
+                }
+            }
+            _queue.Unlock();
+
+            if (removed == true) {
                 result = ERROR_NONE;
             }
             else {
@@ -583,7 +803,16 @@ POP_WARNING()
             ProxyType<IDispatch> resubmit = job.Resubmit(scheduleTime);
             if (resubmit.IsValid() == true) {
                 if ((scheduleTime.IsValid() == false) || (_scheduler == nullptr) || (scheduleTime < Time::Now()) ) {
-                    _queue.Post(resubmit);
+                    Minion* local = Local();
+
+                    if (local != nullptr) {
+                        // Keep it on this minion, it is still hot in its cache.
+                        local->Push(resubmit);
+                        Nudge();
+                    }
+                    else {
+                        _queue.Post(resubmit);
+                    }
                 }
                 else {
                     // See if we have a hook that can process scheduled entries :-)
@@ -593,10 +822,58 @@ POP_WARNING()
             _queue.Unlock();
         }
 
+        // The minion of the calling thread, if we are running on one of ours in STEALING mode.
+        Minion* Local() {
+            Minion* result = nullptr;
+
+            if (_mode == STEALING) {
+                std::list<Executor>::iterator index = _units.begin();
+                while ((index != _units.end()) && (index->Me().Id() != Thread::ThreadId())) {
+                    index++;
+                }
+                if (index != _units.end()) {
+                    result = &(index->Me());
+                }
+            }
+
+            return (result);
+        }
+        bool Steal(Minion& thief, Request& request) {
+            bool result = false;
+
+            // Start looking at the sibling next to the thief, to spread the thefts.
+            std::list<Executor>::iterator start = _units.begin();
+            while ((start != _units.end()) && (&(start->Me()) != &thief)) {
+                start++;
+            }
+
+            std::list<Executor>::iterator index = start;
+            for (uint8_t count = 0; (result == false) && (count < _units.size()); count++) {
+                if ((index == _units.end()) || (++index == _units.end())) {
+                    index = _units.begin();
+                }
+                if (&(index->Me()) != &thief) {
+                    result = index->Me().Steal(request);
+                }
+            }
+
+            return (result);
+        }
+        void Nudge() {
+            // If minions are parked on the shared queue, wake one, so it can come and steal.
+            if (_idle > _nudges) {
+                _nudges++;
+                _queue.Post(Request());
+            }
+        }
+
     private:
         MessageQueue _queue;
         std::list<Executor> _units;
         IScheduler* _scheduler;
+        const scheduling _mode;
+        std::atomic<uint32_t> _idle;
+        std::atomic<uint32_t> _nudges;
     };
 
 }
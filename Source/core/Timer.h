@@ -27,7 +27,9 @@
 #include "Sync.h"
 #include "Thread.h"
 #include "Time.h"
+#include <list>
 #include <utility>
+#include <vector>
 
 // ---- Referenced classes and types ----
 
@@ -44,7 +46,573 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
 //
 namespace WPEFramework {
 namespace Core {
-    template <typename CONTENT>
+    //
+    // Storage policies for the TimerType. A policy owns the pending entries, keeps them
+    // ordered on their schedule time and hands out a handle per entry, so an entry can
+    // be revoked without knowing (or searching for) its content.
+    //
+    // The TimedListType keeps a sorted list, inserting is O(n) but the next entry to
+    // expire is always known exactly. This is the default.
+    //
+    template <typename ELEMENT>
+    class TimedListType {
+    private:
+        struct Entry {
+            Entry(const uint64_t handle, ELEMENT&& element)
+                : Handle(handle)
+                , Element(std::move(element))
+            {
+            }
+
+            uint64_t Handle;
+            ELEMENT Element;
+        };
+
+        typedef std::list<Entry> EntryList;
+
+    public:
+        typedef uint64_t handle;
+
+        TimedListType(const TimedListType&) = delete;
+        TimedListType& operator=(const TimedListType&) = delete;
+
+        TimedListType()
+            : _entries()
+            , _sequence(0)
+        {
+        }
+        ~TimedListType() = default;
+
+    public:
+        inline bool IsEmpty() const
+        {
+            return (_entries.empty());
+        }
+        inline uint32_t Count() const
+        {
+            return (static_cast<uint32_t>(_entries.size()));
+        }
+        inline uint64_t NextTime()
+        {
+            ASSERT(_entries.empty() == false);
+
+            return (_entries.front().Element.ScheduleTime());
+        }
+        inline bool HasExpired(const uint64_t now)
+        {
+            return ((_entries.empty() == false) && (_entries.front().Element.ScheduleTime() <= now));
+        }
+        handle Insert(ELEMENT&& element)
+        {
+            // Zero is never handed out, it can be used as "no entry".
+            handle result = ++_sequence;
+
+            Insert(result, std::move(element));
+
+            return (result);
+        }
+        void Insert(const handle entry, ELEMENT&& element)
+        {
+            typename EntryList::iterator index = _entries.begin();
+
+            while ((index != _entries.end()) && (element.ScheduleTime() >= index->Element.ScheduleTime())) {
+                ++index;
+            }
+
+            _entries.emplace(index, entry, std::move(element));
+        }
+        ELEMENT Extract(handle& entry)
+        {
+            ASSERT(_entries.empty() == false);
+
+            entry = _entries.front().Handle;
+            ELEMENT result(std::move(_entries.front().Element));
+            _entries.pop_front();
+
+            return (result);
+        }
+        void Release(const handle /* entry */)
+        {
+        }
+        bool Remove(const handle entry)
+        {
+            typename EntryList::iterator index = _entries.begin();
+
+            while ((index != _entries.end()) && (index->Handle != entry)) {
+                ++index;
+            }
+
+            bool found = (index != _entries.end());
+
+            if (found == true) {
+                _entries.erase(index);
+            }
+
+            return (found);
+        }
+        template <typename KEY>
+        uint32_t Remove(const KEY& key)
+        {
+            uint32_t removed = 0;
+            typename EntryList::iterator index = _entries.begin();
+
+            while (index != _entries.end()) {
+                if (index->Element == key) {
+                    index = _entries.erase(index);
+                    removed++;
+                } else {
+                    ++index;
+                }
+            }
+
+            return (removed);
+        }
+        template <typename KEY>
+        bool Contains(const KEY& key) const
+        {
+            typename EntryList::const_iterator index = _entries.cbegin();
+
+            while ((index != _entries.cend()) && (index->Element != key)) {
+                ++index;
+            }
+
+            return (index != _entries.cend());
+        }
+        void Clear()
+        {
+            _entries.clear();
+        }
+
+    private:
+        EntryList _entries;
+        handle _sequence;
+    };
+
+    //
+    // The TimingWheelType is a hashed hierarchical timing wheel with a millisecond
+    // resolution. The first level has a slot per millisecond for the next 256ms, every
+    // next level covers 64 slots of the level below it, up to ~49 days. Entries further
+    // out are parked in the last level and re-evaluated each time they cascade.
+    // Inserting and revoking an entry is O(1), the wheel is advanced, and higher levels
+    // cascade into lower ones, as time passes. Entries that are due are moved to a small
+    // sorted list, so they are still handed out in the order of their exact time.
+    // Nodes live in a vector, linked by index, and are recycled, a handle carries the
+    // node index and a generation to detect a handle of an entry that is already gone.
+    //
+    template <typename ELEMENT>
+    class TimingWheelType {
+    private:
+        static constexpr uint8_t FirstBits = 8;
+        static constexpr uint8_t LevelBits = 6;
+        static constexpr uint8_t Levels = 5;
+        static constexpr uint32_t FirstSlots = (1 << FirstBits);
+        static constexpr uint32_t LevelSlots = (1 << LevelBits);
+        static constexpr uint32_t Due = FirstSlots + ((Levels - 1) * LevelSlots);
+        static constexpr uint32_t Lists = Due + 1;
+        static constexpr uint32_t Nil = static_cast<uint32_t>(~0);
+        static constexpr uint32_t Resolution = Time::TicksPerMillisecond;
+
+        struct Node {
+            Node()
+                : Element()
+                , Previous(Nil)
+                , Next(Nil)
+                , List(Nil)
+                , Generation(1)
+            {
+            }
+
+            ELEMENT Element;
+            uint32_t Previous;
+            uint32_t Next;
+            uint32_t List;
+            uint32_t Generation;
+        };
+
+    public:
+        typedef uint64_t handle;
+
+        TimingWheelType(const TimingWheelType&) = delete;
+        TimingWheelType& operator=(const TimingWheelType&) = delete;
+
+        TimingWheelType()
+            : _nodes()
+            , _free(Nil)
+            , _current(Time::Now().Ticks() / Resolution)
+            , _count(0)
+        {
+            for (uint32_t index = 0; index < Lists; index++) {
+                _heads[index] = Nil;
+                _tails[index] = Nil;
+            }
+            for (uint8_t level = 0; level < Levels; level++) {
+                _levelCount[level] = 0;
+            }
+        }
+        ~TimingWheelType() = default;
+
+    public:
+        inline bool IsEmpty() const
+        {
+            return (_count == 0);
+        }
+        inline uint32_t Count() const
+        {
+            return (_count);
+        }
+        // Returns the time the first entry is due. For entries that are not yet in the
+        // due list this is a lower bound, the moment their slot is reached.
+        uint64_t NextTime()
+        {
+            ASSERT(_count != 0);
+
+            if (_heads[Due] != Nil) {
+                return (_nodes[_heads[Due]].Element.ScheduleTime());
+            }
+
+            uint64_t result = NUMBER_MAX_UNSIGNED(uint64_t);
+
+            if (_levelCount[0] != 0) {
+                uint32_t distance = 1;
+
+                while ((distance < FirstSlots) && (_heads[(_current + distance) & (FirstSlots - 1)] == Nil)) {
+                    distance++;
+                }
+
+                ASSERT(distance < FirstSlots);
+
+                result = _current + distance;
+            }
+
+            for (uint8_t level = 1; level < Levels; level++) {
+                if (_levelCount[level] != 0) {
+                    uint64_t index = (_current >> Shift(level)) + 1;
+                    uint64_t last = index + LevelSlots;
+
+                    while ((index < last) && (_heads[Slot(level, index)] == Nil)) {
+                        index++;
+                    }
+
+                    ASSERT(index < last);
+
+                    result = std::min(result, (index << Shift(level)));
+                }
+            }
+
+            return (result * Resolution);
+        }
+        inline bool HasExpired(const uint64_t now)
+        {
+            Advance(now / Resolution);
+
+            return ((_heads[Due] != Nil) && (_nodes[_heads[Due]].Element.ScheduleTime() <= now));
+        }
+        handle Insert(ELEMENT&& element)
+        {
+            uint32_t index = _free;
+
+            if (index != Nil) {
+                _free = _nodes[index].Next;
+            } else {
+                index = static_cast<uint32_t>(_nodes.size());
+                _nodes.emplace_back();
+            }
+
+            Insert(Handle(index), std::move(element));
+
+            return (Handle(index));
+        }
+        void Insert(const handle entry, ELEMENT&& element)
+        {
+            uint32_t index = static_cast<uint32_t>(entry & Nil);
+
+            ASSERT(index < _nodes.size());
+            ASSERT(_nodes[index].List == Nil);
+
+            if (_count == 0) {
+                // Nothing is ticking on the wheel, resync it with the current time.
+                _current = std::max(_current, Time::Now().Ticks() / Resolution);
+            }
+
+            Assign(_nodes[index], std::move(element));
+            Link(index);
+            _count++;
+        }
+        ELEMENT Extract(handle& entry)
+        {
+            uint32_t index = _heads[Due];
+
+            ASSERT(index != Nil);
+
+            Unlink(index);
+            _count--;
+            entry = Handle(index);
+
+            // The node stays reserved for this handle till it is inserted or released.
+            return (std::move(_nodes[index].Element));
+        }
+        void Release(const handle entry)
+        {
+            uint32_t index = static_cast<uint32_t>(entry & Nil);
+
+            ASSERT(index < _nodes.size());
+            ASSERT(_nodes[index].List == Nil);
+
+            Free(index);
+        }
+        bool Remove(const handle entry)
+        {
+            uint32_t index = static_cast<uint32_t>(entry & Nil);
+            bool found = ((index < _nodes.size()) && (Handle(index) == entry) && (_nodes[index].List != Nil));
+
+            if (found == true) {
+                Unlink(index);
+                Free(index);
+                _count--;
+            }
+
+            return (found);
+        }
+        template <typename KEY>
+        uint32_t Remove(const KEY& key)
+        {
+            uint32_t removed = 0;
+
+            for (uint32_t index = 0; index < _nodes.size(); index++) {
+                if ((_nodes[index].List != Nil) && (_nodes[index].Element == key)) {
+                    Unlink(index);
+                    Free(index);
+                    removed++;
+                }
+            }
+
+            _count -= removed;
+
+            return (removed);
+        }
+        template <typename KEY>
+        bool Contains(const KEY& key) const
+        {
+            uint32_t index = 0;
+
+            while ((index < _nodes.size()) && ((_nodes[index].List == Nil) || (_nodes[index].Element != key))) {
+                index++;
+            }
+
+            return (index < _nodes.size());
+        }
+        void Clear()
+        {
+            for (uint32_t index = 0; index < _nodes.size(); index++) {
+                if (_nodes[index].List != Nil) {
+                    Unlink(index);
+                    Free(index);
+                }
+            }
+
+            _count = 0;
+        }
+
+    private:
+        static constexpr uint8_t Shift(const uint8_t level)
+        {
+            return (level == 0 ? 0 : FirstBits + ((level - 1) * LevelBits));
+        }
+        static constexpr uint32_t Slot(const uint8_t level, const uint64_t index)
+        {
+            return (level == 0 ? static_cast<uint32_t>(index & (FirstSlots - 1)) : FirstSlots + ((level - 1) * LevelSlots) + static_cast<uint32_t>(index & (LevelSlots - 1)));
+        }
+        static constexpr uint8_t Level(const uint32_t list)
+        {
+            return (list < FirstSlots ? 0 : 1 + ((list - FirstSlots) / LevelSlots));
+        }
+        static void Assign(Node& node, ELEMENT&& element)
+        {
+            // Reconstruct in place, the content is not required to be assignable.
+            node.Element.~ELEMENT();
+            new (&(node.Element)) ELEMENT(std::move(element));
+        }
+        inline handle Handle(const uint32_t index) const
+        {
+            return ((static_cast<uint64_t>(_nodes[index].Generation) << 32) | index);
+        }
+        void Free(const uint32_t index)
+        {
+            Node& node(_nodes[index]);
+
+            Assign(node, ELEMENT());
+            node.List = Nil;
+            node.Previous = Nil;
+            node.Next = _free;
+
+            // Invalidate all outstanding handles to this node, skip 0 so a handle is never 0.
+            if (++node.Generation == 0) {
+                node.Generation = 1;
+            }
+
+            _free = index;
+        }
+        void Link(const uint32_t index)
+        {
+            uint64_t tick = _nodes[index].Element.ScheduleTime() / Resolution;
+
+            if (tick <= _current) {
+                LinkDue(index);
+            } else {
+                uint64_t delta = tick - _current;
+                uint8_t level = 0;
+
+                while ((level < (Levels - 1)) && (delta >= (1ULL << Shift(level + 1)))) {
+                    level++;
+                }
+
+                if ((level == (Levels - 1)) && (delta >= (1ULL << (Shift(level) + LevelBits)))) {
+                    // Beyond the reach of the wheel, park it in the furthest slot.
+                    tick = _current + (1ULL << (Shift(level) + LevelBits)) - 1;
+                }
+
+                Append(Slot(level, tick >> Shift(level)), index);
+            }
+        }
+        void LinkDue(const uint32_t index)
+        {
+            // Keep the due list sorted, an equal time goes after the ones already there.
+            uint64_t time = _nodes[index].Element.ScheduleTime();
+            uint32_t after = _tails[Due];
+
+            while ((after != Nil) && (_nodes[after].Element.ScheduleTime() > time)) {
+                after = _nodes[after].Previous;
+            }
+
+            Node& node(_nodes[index]);
+
+            node.List = Due;
+            node.Previous = after;
+
+            if (after == Nil) {
+                node.Next = _heads[Due];
+                _heads[Due] = index;
+            } else {
+                node.Next = _nodes[after].Next;
+                _nodes[after].Next = index;
+            }
+
+            if (node.Next == Nil) {
+                _tails[Due] = index;
+            } else {
+                _nodes[node.Next].Previous = index;
+            }
+        }
+        void Append(const uint32_t list, const uint32_t index)
+        {
+            Node& node(_nodes[index]);
+
+            node.List = list;
+            node.Next = Nil;
+            node.Previous = _tails[list];
+
+            if (_tails[list] == Nil) {
+                _heads[list] = index;
+            } else {
+                _nodes[_tails[list]].Next = index;
+            }
+
+            _tails[list] = index;
+            _levelCount[Level(list)]++;
+        }
+        void Unlink(const uint32_t index)
+        {
+            Node& node(_nodes[index]);
+            uint32_t list = node.List;
+
+            ASSERT(list != Nil);
+
+            if (node.Previous == Nil) {
+                _heads[list] = node.Next;
+            } else {
+                _nodes[node.Previous].Next = node.Next;
+            }
+            if (node.Next == Nil) {
+                _tails[list] = node.Previous;
+            } else {
+                _nodes[node.Next].Previous = node.Previous;
+            }
+
+            if (list != Due) {
+                _levelCount[Level(list)]--;
+            }
+
+            node.List = Nil;
+            node.Previous = Nil;
+            node.Next = Nil;
+        }
+        void Relink(const uint32_t list)
+        {
+            uint32_t index = _heads[list];
+
+            while (index != Nil) {
+                uint32_t next = _nodes[index].Next;
+
+                Unlink(index);
+                Link(index);
+
+                index = next;
+            }
+        }
+        void Advance(const uint64_t tick)
+        {
+            while (_current < tick) {
+                uint32_t ticking = 0;
+
+                for (uint8_t level = 0; level < Levels; level++) {
+                    ticking += _levelCount[level];
+                }
+
+                if (ticking == 0) {
+                    _current = tick;
+                } else {
+                    if (_levelCount[0] != 0) {
+                        _current++;
+                    } else {
+                        // Nothing on the first level, skip ahead to the next cascade.
+                        uint64_t boundary = ((_current >> FirstBits) + 1) << FirstBits;
+
+                        if (boundary > tick) {
+                            _current = tick;
+                            break;
+                        }
+
+                        _current = boundary;
+                    }
+
+                    if ((_current & (FirstSlots - 1)) == 0) {
+                        // Cascade top down, so what comes down lands in a slot that is cascaded next.
+                        uint8_t top = 1;
+
+                        while ((top < (Levels - 1)) && (((_current >> Shift(top)) & (LevelSlots - 1)) == 0)) {
+                            top++;
+                        }
+                        for (uint8_t level = top; level > 0; level--) {
+                            Relink(Slot(level, _current >> Shift(level)));
+                        }
+                    }
+
+                    Relink(Slot(0, _current));
+                }
+            }
+        }
+
+    private:
+        std::vector<Node> _nodes;
+        uint32_t _free;
+        uint64_t _current;
+        uint32_t _count;
+        uint32_t _heads[Lists];
+        uint32_t _tails[Lists];
+        uint32_t _levelCount[Levels];
+    };
+
+    template <typename CONTENT, template <typename> class STORAGE = TimedListType>
     class TimerType {
 
     private:
@@ -149,13 +717,15 @@ namespace Core {
             }
 
         private:
-            TimerType<CONTENT>& m_Parent;
+            TimerType& m_Parent;
         };
 
         using TimeInfoBlocks = TimedInfo<CONTENT>;
-        using SubscriberList = typename std::list<TimeInfoBlocks>;
+        using SubscriberList = STORAGE<TimeInfoBlocks>;
 
     public:
+        typedef typename SubscriberList::handle handle;
+
         TimerType(const TimerType&) = delete;
         TimerType& operator=(const TimerType&) = delete;
 
@@ -166,6 +736,7 @@ namespace Core {
             , _nextTrigger(NUMBER_MAX_UNSIGNED(uint64_t))
             , _waitForCompletion(true, true)
             , _executing(nullptr)
+            , _executingHandle(0)
 
         {
             // Everything is initialized, go...
@@ -178,31 +749,31 @@ namespace Core {
             _timerThread.Stop();
 
             // Force kill on all pending stuff...
-            _pendingQueue.clear();
+            _pendingQueue.Clear();
 
             _adminLock.Unlock();
 
             _timerThread.Wait(Thread::STOPPED, Core::infinite);
         }
 
-        inline void Schedule(const Time& time, CONTENT&& info)
+        inline handle Schedule(const Time& time, CONTENT&& info)
         {
-            Schedule(time.Ticks(), std::move(info));
+            return (Schedule(time.Ticks(), std::move(info)));
         }
 
-        inline void Schedule(const Time& time, const CONTENT& info)
+        inline handle Schedule(const Time& time, const CONTENT& info)
         {
-            Schedule(time.Ticks(), info);
+            return (Schedule(time.Ticks(), info));
         }
 
-        inline void Schedule(const uint64_t& time, CONTENT&& info)
+        inline handle Schedule(const uint64_t& time, CONTENT&& info)
         {
-            Schedule(TimedInfo<CONTENT>(time, std::move(info)));
+            return (Schedule(TimedInfo<CONTENT>(time, std::move(info))));
         }
 
-        inline void Schedule(const uint64_t& time, const CONTENT& info)
+        inline handle Schedule(const uint64_t& time, const CONTENT& info)
         {
-            Schedule(std::move(TimedInfo<CONTENT>(time, info)));
+            return (Schedule(std::move(TimedInfo<CONTENT>(time, info))));
         }
 
         inline void Flush() {
@@ -211,7 +782,8 @@ namespace Core {
             _timerThread.Block();
 
             // Force kill on all pending stuff...
-            _pendingQueue.clear();
+            _pendingQueue.Clear();
+            _nextTrigger = NUMBER_MAX_UNSIGNED(uint64_t);
             _adminLock.Unlock();
 
             _timerThread.Wait(Thread::BLOCKED, Core::infinite);
@@ -222,14 +794,7 @@ namespace Core {
             // This needs to be atomic. Make sure it is.
             _adminLock.Lock();
 
-            typename SubscriberList::const_iterator index = _pendingQueue.cbegin();
-
-            // Clear all entries !!
-            while ((index != _pendingQueue.cend()) && (*index != element)) {
-                index++;
-            }
-
-            bool found = (index != _pendingQueue.cend());
+            bool found = _pendingQueue.Contains(element);
 
             // Done with the administration. Release the lock.
             _adminLock.Unlock();
@@ -238,45 +803,35 @@ namespace Core {
         }
 
     private:
-        void Schedule(TimedInfo<CONTENT>&& timeInfo)
+        handle Schedule(TimedInfo<CONTENT>&& timeInfo)
         {
             _adminLock.Lock();
 
-            if (ScheduleEntry(std::move(timeInfo)) == true) {
-                _timerThread.Run();
-            }
+            handle result = ScheduleEntry(std::move(timeInfo));
 
             _adminLock.Unlock();
+
+            return (result);
         }
 
     public:
-        void Trigger(const uint64_t& time, const CONTENT& info)
+        handle Trigger(const uint64_t& time, const CONTENT& info)
         {
             TimedInfo<CONTENT> newEntry(time, info);
 
             _adminLock.Lock();
 
-            typename SubscriberList::iterator index = _pendingQueue.begin();
+            _pendingQueue.Remove(info);
 
-            while ((index != _pendingQueue.end()) && ((*index).Content() != info)) {
-                ++index;
-            }
-
-            if (index != _pendingQueue.end()) {
-                _pendingQueue.erase(index);
-            }
-
-            if (ScheduleEntry(std::move(newEntry)) == true) {
-                _timerThread.Run();
-            }
+            handle result = ScheduleEntry(std::move(newEntry));
 
             _adminLock.Unlock();
+
+            return (result);
         }
 
         bool Revoke(const CONTENT& info)
         {
-            bool foundElement = false;
-
             _adminLock.Lock();
 
             if (&info == _executing) {
@@ -291,28 +846,35 @@ namespace Core {
                 _adminLock.Lock();
             }
 
-            typename SubscriberList::iterator index = _pendingQueue.begin();
+            // If the head got removed, the scheduler wakes up on the old time, finds nothing
+            // to do and recalculates. No need to retrigger it.
+            bool foundElement = (_pendingQueue.Remove(info) != 0);
 
-            bool changedHead = false;
+            _adminLock.Unlock();
 
-            while (index != _pendingQueue.end()) {
-                if (index->Content() == info) {
-                    changedHead |= (index == _pendingQueue.begin());
-                    foundElement = true;
+            return (foundElement);
+        }
 
-                    // Remove this... Found it, remove it.
-                    index = _pendingQueue.erase(index);
-                }
-                else {
-                    ++index;
-                }
-            }
+        // Revoke the entry a Schedule or Trigger returned the handle for, without a search.
+        // The handle stays valid as long as the entry keeps rescheduling itself.
+        bool Revoke(const handle entry)
+        {
+            _adminLock.Lock();
 
-            if (changedHead == true) {
-                // If we added the new time up front, retrigger the scheduler.
-                _timerThread.Run();
+            if ((entry == _executingHandle) && (_executing != nullptr)) {
+
+                // Currently executing, wait till it is completed and signal that it should not reschedule !!!
+                _executing = nullptr;
+
+                _adminLock.Unlock();
+
+                _waitForCompletion.Lock();
+
+                _adminLock.Lock();
             }
 
+            bool foundElement = _pendingQueue.Remove(entry);
+
             _adminLock.Unlock();
 
             return (foundElement);
@@ -325,7 +887,7 @@ namespace Core {
 
         uint32_t Pending() const
         {
-            return (_pendingQueue.size());
+            return (_pendingQueue.Count());
         }
 
         ::ThreadId ThreadId() const
@@ -345,12 +907,14 @@ namespace Core {
             // Ranging from 0-Core::infinite
             _timerThread.Block();
 
-            while ((_pendingQueue.empty() == false) && (_pendingQueue.front().ScheduleTime() <= now)) {
-                TimedInfo<CONTENT> info(std::move(_pendingQueue.front()));
-                _executing = &(info.Content());
+            while (_pendingQueue.HasExpired(now) == true) {
+                handle entry;
 
                 // Make sure we loose the current one before we do the call, that one might add ;-)
-                _pendingQueue.pop_front();
+                TimedInfo<CONTENT> info(_pendingQueue.Extract(entry));
+                _executing = &(info.Content());
+                _executingHandle = entry;
+
                 _waitForCompletion.ResetEvent();
 
                 _adminLock.Unlock();
@@ -362,28 +926,33 @@ namespace Core {
                 if ((_executing != nullptr) && (reschedule != 0)) {
                     ASSERT(reschedule > now);
 
+                    // Reuse the handle, so it can still be used to revoke it.
                     info.ScheduleTime(reschedule);
-                    ScheduleEntry(std::move(info));
+                    _pendingQueue.Insert(entry, std::move(info));
+                } else {
+                    _pendingQueue.Release(entry);
                 }
 
                 _waitForCompletion.SetEvent();
                 _executing = nullptr;
+                _executingHandle = 0;
             }
 
             // Calculate the delay...
-            if (_pendingQueue.empty() == true) {
+            if (_pendingQueue.IsEmpty() == true) {
                 _nextTrigger = NUMBER_MAX_UNSIGNED(uint64_t);
             } else {
                 // Refresh the time, just to be on the safe side...
                 uint64_t delta = Time::Now().Ticks();
+                uint64_t next = _pendingQueue.NextTime();
 
-                if (delta >= _pendingQueue.front().ScheduleTime()) {
+                if (delta >= next) {
                     _nextTrigger = delta;
                     delayTime = 0;
                 } else {
                     // The windows counter is in 100ns intervals dus we mmoeten even delen door  1000 (us) * 10 ns = 10.000
                     // om de waarde in ms te krijgen.
-                    _nextTrigger = _pendingQueue.front().ScheduleTime();
+                    _nextTrigger = next;
                     delayTime = static_cast<uint32_t>((_nextTrigger - delta) / Time::TicksPerMillisecond);
                 }
             }
@@ -394,27 +963,18 @@ namespace Core {
         }
 
     private:
-        bool ScheduleEntry(TimedInfo<CONTENT>&& infoBlock)
+        handle ScheduleEntry(TimedInfo<CONTENT>&& infoBlock)
         {
-            bool reevaluate = false;
-            typename SubscriberList::iterator index = _pendingQueue.begin();
-
-            while ((index != _pendingQueue.end()) && (infoBlock.ScheduleTime() >= (*index).ScheduleTime())) {
-                ++index;
-            }
+            uint64_t time = infoBlock.ScheduleTime();
 
-            if (index == _pendingQueue.begin()) {
-                _pendingQueue.push_front(std::move(infoBlock));
+            handle result = _pendingQueue.Insert(std::move(infoBlock));
 
+            if (time < _nextTrigger) {
                 // If we added the new time up front, retrigger the scheduler.
-                reevaluate = true;
-            } else if (index == _pendingQueue.end()) {
-                _pendingQueue.push_back(std::move(infoBlock));
-            } else {
-                _pendingQueue.insert(index, std::move(infoBlock));
+                _timerThread.Run();
             }
 
-            return (reevaluate);
+            return (result);
         }
 
     private:
@@ -424,6 +984,7 @@ namespace Core {
         uint64_t _nextTrigger;
         Core::Event _waitForCompletion;
         CONTENT* _executing;
+        handle _executingHandle;
     };
 
     template <typename HANDLER>
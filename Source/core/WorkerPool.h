@@ -97,6 +97,10 @@ namespace Core {
             uint32_t Occupation;
             uint8_t Slots;
             uint32_t* Slot;
+            // Per slot, where the jobs came from: the own deque, the shared queue or a sibling.
+            uint32_t* Local;
+            uint32_t* Global;
+            uint32_t* Stolen;
         };
 
         static void Assign(IWorkerPool* instance);
@@ -105,6 +109,8 @@ namespace Core {
 
         virtual ::ThreadId Id(const uint8_t index) const = 0;
         virtual void Submit(const Core::ProxyType<IDispatch>& job) = 0;
+        // Jobs with the same key, in the same priority, are served fairly against other keys.
+        virtual void Submit(const Core::ProxyType<IDispatch>& job, const ThreadPool::priority level, const uint32_t key) = 0;
         virtual void Schedule(const Core::Time& time, const Core::ProxyType<IDispatch>& job) = 0;
         virtual bool Reschedule(const Core::Time& time, const Core::ProxyType<IDispatch>& job) = 0;
         virtual uint32_t Revoke(const Core::ProxyType<IDispatch>& job, const uint32_t waitTime = Core::infinite) = 0;
@@ -165,7 +171,7 @@ namespace Core {
             Scheduler(const Scheduler&) = delete;
             Scheduler& operator=(const Scheduler&) = delete;
 
-            Scheduler(IWorkerPool* pool, Core::TimerType<Timer>& timer) : _pool(pool), _timer(timer) {
+            Scheduler(IWorkerPool* pool, Core::TimerType<Timer, Core::TimingWheelType>& timer) : _pool(pool), _timer(timer) {
             }
             ~Scheduler() override = default;
 
@@ -177,7 +183,7 @@ namespace Core {
 
         private:
             IWorkerPool* _pool;
-            Core::TimerType<Timer>& _timer;
+            Core::TimerType<Timer, Core::TimingWheelType>& _timer;
         };
 
     public:
@@ -185,9 +191,9 @@ namespace Core {
         WorkerPool& operator=(const WorkerPool&) = delete;
 
 PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
-        WorkerPool(const uint8_t threadCount, const uint32_t stackSize, const uint32_t queueSize, ThreadPool::IDispatcher* dispatcher)
+        WorkerPool(const uint8_t threadCount, const uint32_t stackSize, const uint32_t queueSize, ThreadPool::IDispatcher* dispatcher, const ThreadPool::scheduling mode = ThreadPool::SHARED)
             : _scheduler(this, _timer)
-            , _threadPool(threadCount, stackSize, queueSize, dispatcher, &_scheduler)
+            , _threadPool(threadCount, stackSize, queueSize, dispatcher, &_scheduler, mode)
             , _external(_threadPool, dispatcher)
             , _timer(1024 * 1024, _T("WorkerPoolType::Timer"))
             , _metadata()
@@ -195,6 +201,9 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
         {
             _metadata.Slots = threadCount + 1;
             _metadata.Slot = new uint32_t[threadCount + 1];
+            _metadata.Local = new uint32_t[threadCount + 1];
+            _metadata.Global = new uint32_t[threadCount + 1];
+            _metadata.Stolen = new uint32_t[threadCount + 1];
         }
 POP_WARNING()
 
@@ -202,6 +211,9 @@ POP_WARNING()
         {
             _threadPool.Stop();
             delete[] _metadata.Slot;
+            delete[] _metadata.Local;
+            delete[] _metadata.Global;
+            delete[] _metadata.Stolen;
         }
 
     public:
@@ -212,6 +224,12 @@ POP_WARNING()
 
             _threadPool.Submit(job, Core::infinite);
         }
+        void Submit(const Core::ProxyType<IDispatch>& job, const ThreadPool::priority level, const uint32_t key) override
+        {
+            ASSERT(_timer.HasEntry(Timer(this, job)) == false);
+
+            _threadPool.Submit(job, Core::infinite, level, key);
+        }
         void Schedule(const Core::Time& time, const Core::ProxyType<IDispatch>& job) override
         {
             if (time > Core::Time::Now()) {
@@ -274,8 +292,12 @@ POP_WARNING()
             _metadata.Pending = _threadPool.Pending();
             _metadata.Occupation = _threadPool.Active() + _external.IsActive();
             _metadata.Slot[0] = _external.Runs();
+            _metadata.Local[0] = _external.LocalRuns();
+            _metadata.Global[0] = _external.GlobalRuns();
+            _metadata.Stolen[0] = _external.StolenRuns();
 
             _threadPool.Runs(_threadPool.Count(), &(_metadata.Slot[1]));
+            _threadPool.Origins(_threadPool.Count(), &(_metadata.Local[1]), &(_metadata.Global[1]), &(_metadata.Stolen[1]));
 
             return (_metadata);
         }
@@ -292,7 +314,7 @@ POP_WARNING()
         Scheduler _scheduler;
         ThreadPool _threadPool;
         ThreadPool::Minion _external;
-        Core::TimerType<Timer> _timer;
+        Core::TimerType<Timer, Core::TimingWheelType> _timer;
         mutable Metadata _metadata;
         ::ThreadId _joined;
     };
@@ -51,6 +51,7 @@
 #include "DataElementFile.h"
 #include "Enumerate.h"
 #include "Factory.h"
+#include "FairQueue.h"
 #include "FileSystem.h"
 #include "Frame.h"
 #include "IPCMessage.h"
@@ -79,6 +80,7 @@
 #include "Rectangle.h"
 #include "ReadWriteLock.h"
 #include "ResourceMonitor.h"
+#include "RingQueue.h"
 #include "SerialPort.h"
 #include "Serialization.h"
 #include "Services.h"
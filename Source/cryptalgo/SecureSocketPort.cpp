@@ -79,6 +79,34 @@ int32_t SecureSocketPort::Handler::Write(const uint8_t buffer[], const uint16_t
     return (SSL_write(static_cast<SSL*>(_ssl), buffer, length));
 }
 
+int32_t SecureSocketPort::Handler::Write(const Segment segments[], const uint8_t count) {
+    int32_t result = 0;
+    uint8_t index = 0;
+    bool completed = true;
+
+    // There is no gathering write for TLS records, write them one by one, until one does not go completely.
+    while ((completed == true) && (index < count)) {
+        uint32_t offset = 0;
+
+        while ((completed == true) && (offset < segments[index].Length)) {
+            const uint16_t length = static_cast<uint16_t>(std::min(segments[index].Length - offset, static_cast<uint32_t>(0xFFFF)));
+            const int32_t written = Write(&(segments[index].Data[offset]), length);
+
+            if (written <= 0) {
+                result = (result == 0 ? written : result);
+                completed = false;
+            } else {
+                result += written;
+                offset += written;
+                completed = (written == length);
+            }
+        }
+        index++;
+    }
+
+    return (result);
+}
+
 uint32_t SecureSocketPort::Handler::Close(const uint32_t waitTime) {
     if (_ssl != nullptr) {
         SSL_shutdown(static_cast<SSL*>(_ssl));
@@ -53,6 +53,7 @@ namespace Crypto {
 
             int32_t Read(uint8_t buffer[], const uint16_t length) const override;
             int32_t Write(const uint8_t buffer[], const uint16_t length) override;
+            int32_t Write(const Segment segments[], const uint8_t count) override;
 
             uint32_t Close(const uint32_t waitTime);
 
@@ -61,6 +62,10 @@ namespace Crypto {
                 return (_parent.SendData(dataFrame, maxSendSize));
             }
 
+            uint16_t GatherData(uint8_t* dataFrame, const uint16_t maxSendSize, Segment segments[], uint8_t& count) override {
+                return (_parent.GatherData(dataFrame, maxSendSize, segments, count));
+            }
+
             uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override {
                 return (_parent.ReceiveData(dataFrame, receivedSize));
             }
@@ -145,6 +150,13 @@ namespace Crypto {
         virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) = 0;
         virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) = 0;
 
+        // Gather output, see Core::SocketPort. The segments are encrypted one after the other.
+        virtual uint16_t GatherData(uint8_t* dataFrame, const uint16_t maxSendSize, Core::SocketPort::Segment[] /* segments */, uint8_t& count)
+        {
+            count = 0;
+            return (SendData(dataFrame, maxSendSize));
+        }
+
         // Signal a state change, Opened, Closed or Accepted
         virtual void StateChange() = 0;
 
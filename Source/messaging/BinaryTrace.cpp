@@ -0,0 +1,403 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BinaryTrace.h"
+
+namespace WPEFramework {
+namespace Messaging {
+
+    namespace {
+
+        std::atomic<uint32_t> _lastId(0);
+
+        class ArgumentReader {
+        public:
+            ArgumentReader() = delete;
+            ArgumentReader(const ArgumentReader&) = delete;
+            ArgumentReader& operator=(const ArgumentReader&) = delete;
+
+            ArgumentReader(const string& signature, const uint8_t data[], const uint16_t length)
+                : _signature(signature)
+                , _data(data)
+                , _length(length)
+                , _index(0)
+                , _offset(0)
+            {
+            }
+            ~ArgumentReader() = default;
+
+        public:
+            // Tag of the next argument, '\0' if there is none (left).
+            char Peek() const
+            {
+                return (_index < _signature.length() ? _signature[_index] : '\0');
+            }
+            bool Integer(int64_t& value, uint8_t& size)
+            {
+                bool result = false;
+                const char tag = Peek();
+
+                switch (tag) {
+                case 'b': result = Signed<int8_t>(value); size = 1; break;
+                case 'B': result = Unsigned<uint8_t>(value); size = 1; break;
+                case 'h': result = Signed<int16_t>(value); size = 2; break;
+                case 'H': result = Unsigned<uint16_t>(value); size = 2; break;
+                case 'i': result = Signed<int32_t>(value); size = 4; break;
+                case 'I': result = Unsigned<uint32_t>(value); size = 4; break;
+                case 'q': result = Signed<int64_t>(value); size = 8; break;
+                case 'Q':
+                case 'p': result = Unsigned<uint64_t>(value); size = 8; break;
+                default: Skip(); break;
+                }
+
+                return (result);
+            }
+            bool Float(double& value)
+            {
+                bool result = false;
+
+                if (Peek() == 'd') {
+                    result = Read(value);
+                } else {
+                    Skip();
+                }
+
+                return (result);
+            }
+            bool Text(string& value)
+            {
+                bool result = false;
+                uint16_t length;
+
+                if (Peek() != 's') {
+                    Skip();
+                } else if (Read(length) == true) {
+                    if ((_offset + length) <= _length) {
+                        value.assign(reinterpret_cast<const char*>(&_data[_offset]), length);
+                        _offset += length;
+                        result = true;
+                    } else {
+                        _offset = _length;
+                    }
+                }
+
+                return (result);
+            }
+
+        private:
+            template <typename TYPE>
+            bool Read(TYPE& value)
+            {
+                bool result = false;
+
+                _index++;
+
+                if ((_offset + sizeof(TYPE)) <= _length) {
+                    ::memcpy(&value, &_data[_offset], sizeof(TYPE));
+                    _offset += sizeof(TYPE);
+                    result = true;
+                } else {
+                    _offset = _length;
+                }
+
+                return (result);
+            }
+            template <typename TYPE>
+            bool Signed(int64_t& value)
+            {
+                TYPE read;
+                bool result = Read(read);
+                value = static_cast<int64_t>(read);
+                return (result);
+            }
+            template <typename TYPE>
+            bool Unsigned(int64_t& value)
+            {
+                TYPE read;
+                bool result = Read(read);
+                value = static_cast<int64_t>(static_cast<uint64_t>(read));
+                return (result);
+            }
+            // An argument of another type than the format expects: step over it, so the rest stays in line.
+            void Skip()
+            {
+                switch (Peek()) {
+                case 'b': case 'B': { uint8_t value; Read(value); break; }
+                case 'h': case 'H': { uint16_t value; Read(value); break; }
+                case 'i': case 'I': { uint32_t value; Read(value); break; }
+                case 'q': case 'Q': case 'p': { uint64_t value; Read(value); break; }
+                case 'd': { double value; Read(value); break; }
+                case 's': { uint16_t length; if (Read(length) == true) { _offset = static_cast<uint16_t>(std::min(static_cast<uint32_t>(_offset) + length, static_cast<uint32_t>(_length))); } break; }
+                default: break;
+                }
+            }
+
+        private:
+            const string& _signature;
+            const uint8_t* _data;
+            const uint16_t _length;
+            uint16_t _index;
+            uint16_t _offset;
+        };
+
+        template <typename TYPE>
+        void Append(string& text, const string& specification, const TYPE value)
+        {
+            char buffer[64];
+            const int length = ::snprintf(buffer, sizeof(buffer), specification.c_str(), value);
+
+            if (length >= static_cast<int>(sizeof(buffer))) {
+                std::vector<char> larger(length + 1);
+                ::snprintf(larger.data(), larger.size(), specification.c_str(), value);
+                text.append(larger.data(), length);
+            } else if (length > 0) {
+                text.append(buffer, length);
+            }
+        }
+    }
+
+    CallSite::CallSite(const string& category, const char module[], const char file[], const uint16_t line, const char format[])
+        : _category(category)
+        , _module(module)
+        , _file(file)
+        , _line(line)
+        , _format(format)
+        , _id(_lastId++)
+        , _generation(~0)
+    {
+    }
+
+    /* static */ uint16_t CallSite::Text(uint8_t buffer[], const uint16_t size, const char value[], const size_t length)
+    {
+        uint16_t result = 0;
+
+        if (size >= sizeof(uint16_t)) {
+            const uint16_t stored = static_cast<uint16_t>(std::min(length, static_cast<size_t>(size - sizeof(uint16_t))));
+            ::memcpy(buffer, &stored, sizeof(stored));
+            ::memcpy(&buffer[sizeof(stored)], value, stored);
+            result = sizeof(stored) + stored;
+        }
+
+        return (result);
+    }
+
+    void CallSite::Announce(const uint32_t generation, const char signature[])
+    {
+        string record;
+
+        record.reserve(MaxRecordSize);
+        record.push_back(static_cast<char>(ANNOUNCEMENT));
+        record.append(reinterpret_cast<const char*>(&_id), sizeof(_id));
+        record.append(reinterpret_cast<const char*>(&_line), sizeof(_line));
+        record.append(_category.c_str(), _category.length() + 1);
+        record.append(_module, ::strlen(_module) + 1);
+        record.append(_file, ::strlen(_file) + 1);
+        record.append(_format, ::strlen(_format) + 1);
+        record.append(signature, ::strlen(signature) + 1);
+
+        if (record.length() <= Core::Messaging::MessageUnit::DataSize) {
+            Core::Messaging::MessageUnit::Instance().Push(static_cast<uint16_t>(record.length()), reinterpret_cast<const uint8_t*>(record.c_str()));
+        } else {
+            TRACE_L1(_T("Call site %s:%u does not fit the buffer!"), _file, _line);
+        }
+
+        // Other threads that see this generation, find the announcement before their trace.
+        _generation.store(generation, std::memory_order_release);
+    }
+
+    bool CallSites::Decode(const uint8_t buffer[], const uint16_t length, Core::Messaging::Information& info, string& text)
+    {
+        bool result = false;
+        uint32_t id;
+
+        if ((buffer[0] == CallSite::ANNOUNCEMENT) && (length > (sizeof(uint8_t) + sizeof(id) + sizeof(uint16_t)))) {
+            const char* strings[5];
+            const char* position = reinterpret_cast<const char*>(&buffer[sizeof(uint8_t) + sizeof(id) + sizeof(uint16_t)]);
+            const char* end = reinterpret_cast<const char*>(&buffer[length]);
+            uint8_t index = 0;
+
+            while ((index < 5) && (position < end)) {
+                const char* terminator = static_cast<const char*>(::memchr(position, '\0', end - position));
+
+                if (terminator != nullptr) {
+                    strings[index++] = position;
+                    position = terminator + 1;
+                } else {
+                    position = end;
+                }
+            }
+
+            if (index == 5) {
+                ::memcpy(&id, &buffer[1], sizeof(id));
+
+                Site& site(_sites[id]);
+
+                ::memcpy(&site.Line, &buffer[sizeof(uint8_t) + sizeof(id)], sizeof(site.Line));
+                site.Category = strings[0];
+                site.Module = strings[1];
+                site.File = strings[2];
+                site.Format = strings[3];
+                site.Signature = strings[4];
+            }
+        } else if ((buffer[0] == CallSite::TRACE) && (length >= CallSite::HeaderSize)) {
+            uint64_t timestamp;
+
+            ::memcpy(&id, &buffer[1], sizeof(id));
+            ::memcpy(&timestamp, &buffer[1 + sizeof(id)], sizeof(timestamp));
+
+            std::unordered_map<uint32_t, Site>::const_iterator site(_sites.find(id));
+
+            if (site != _sites.end()) {
+                info = Core::Messaging::Information(Core::Messaging::MetaData::MessageType::TRACING, site->second.Category, site->second.Module, site->second.File, site->second.Line, timestamp);
+                Render(site->second.Format, site->second.Signature, &buffer[CallSite::HeaderSize], length - CallSite::HeaderSize, text);
+            } else {
+                // Its announcement got lost, the call site will announce itself again shortly.
+                info = Core::Messaging::Information(Core::Messaging::MetaData::MessageType::TRACING, _T("Unknown"), _T(""), _T(""), 0, timestamp);
+                text = _T("<unannounced call site ") + Core::NumberType<uint32_t>(id).Text() + _T(">");
+            }
+
+            result = true;
+        }
+
+        return (result);
+    }
+
+    /* static */ void CallSites::Render(const string& format, const string& signature, const uint8_t data[], const uint16_t length, string& text)
+    {
+        static const TCHAR Mismatch[] = _T("<?>");
+        ArgumentReader arguments(signature, data, length);
+        string::size_type index = 0;
+
+        text.clear();
+
+        while (index < format.length()) {
+            if (format[index] != '%') {
+                string::size_type next = format.find('%', index);
+                if (next == string::npos) {
+                    next = format.length();
+                }
+                text.append(format, index, next - index);
+                index = next;
+            } else if ((index + 1) < format.length() && (format[index + 1] == '%')) {
+                text.push_back('%');
+                index += 2;
+            } else {
+                // Rebuild the specification without its length modifiers and with the '*'s filled in, the argument
+                // gets printed at its full width anyway.
+                string specification(1, '%');
+                bool valid = true;
+                index++;
+
+                while ((index < format.length()) && (::strchr("-+ #0", format[index]) != nullptr)) {
+                    specification.push_back(format[index++]);
+                }
+                for (uint8_t part = 0; part < 2; part++) {
+                    if ((part == 1) && (index < format.length()) && (format[index] == '.')) {
+                        specification.push_back(format[index++]);
+                    }
+                    if ((index < format.length()) && (format[index] == '*')) {
+                        int64_t value;
+                        uint8_t size;
+                        if (arguments.Integer(value, size) == true) {
+                            specification += Core::NumberType<int32_t>(static_cast<int32_t>(value)).Text();
+                        } else {
+                            valid = false;
+                        }
+                        index++;
+                    } else {
+                        while ((index < format.length()) && (::isdigit(format[index]) != 0)) {
+                            specification.push_back(format[index++]);
+                        }
+                    }
+                }
+                while ((index < format.length()) && (::strchr("hlLqjzt", format[index]) != nullptr)) {
+                    index++;
+                }
+
+                const char conversion = (index < format.length() ? format[index++] : '\0');
+
+                switch (conversion) {
+                case 'd':
+                case 'i':
+                case 'u':
+                case 'o':
+                case 'x':
+                case 'X':
+                case 'c': {
+                    int64_t value;
+                    uint8_t size;
+                    if ((arguments.Integer(value, size) == true) && (valid == true)) {
+                        if (conversion == 'c') {
+                            Append(text, specification + conversion, static_cast<int>(value));
+                        } else {
+                            // Unsigned conversions print what the original type printed: a negative int is 32 bits of ones.
+                            if ((conversion != 'd') && (conversion != 'i') && (size < 8)) {
+                                value = static_cast<int64_t>(static_cast<uint64_t>(value) & ((1ull << (size * 8)) - 1));
+                            }
+                            Append(text, specification + "ll" + conversion, static_cast<long long>(value));
+                        }
+                    } else {
+                        text.append(Mismatch);
+                    }
+                    break;
+                }
+                case 'f':
+                case 'F':
+                case 'e':
+                case 'E':
+                case 'g':
+                case 'G':
+                case 'a':
+                case 'A': {
+                    double value;
+                    if ((arguments.Float(value) == true) && (valid == true)) {
+                        Append(text, specification + conversion, value);
+                    } else {
+                        text.append(Mismatch);
+                    }
+                    break;
+                }
+                case 's': {
+                    string value;
+                    if ((arguments.Text(value) == true) && (valid == true)) {
+                        Append(text, specification + conversion, value.c_str());
+                    } else {
+                        text.append(Mismatch);
+                    }
+                    break;
+                }
+                case 'p': {
+                    int64_t value;
+                    uint8_t size;
+                    if ((arguments.Integer(value, size) == true) && (valid == true)) {
+                        Append(text, specification + conversion, reinterpret_cast<const void*>(static_cast<uintptr_t>(value)));
+                    } else {
+                        text.append(Mismatch);
+                    }
+                    break;
+                }
+                default:
+                    // %n and friends, or a format that just ends: nothing to print.
+                    break;
+                }
+            }
+        }
+    }
+}
+}
@@ -0,0 +1,235 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "Module.h"
+
+namespace WPEFramework {
+namespace Messaging {
+
+    /**
+     * @brief Binary traces. Where TRACE formats its text on the spot, a binary trace only stores the identifier of the
+     *        place it is called from, a timestamp and the bytes of its arguments. Everything that does not change from
+     *        call to call (category, module, file, line and the printf-like format) is announced once per call site
+     *        and the text is put together on the reading side, by the MessageClient.
+     *
+     *        Layout of the records in the data buffer, all numbers in the byte order of the host:
+     *        announcement: [ANNOUNCEMENT][id:4][line:2][category\0][module\0][file\0][format\0][signature\0]
+     *        trace:        [TRACE][id:4][timestamp:8][arguments]
+     *
+     *        The signature has a character per argument, telling how it is stored:
+     *        b/B h/H i/I q/Q: signed/unsigned integer of 1, 2, 4 or 8 bytes
+     *        d: double, p: pointer (8 bytes), s: text as [length:2][characters]
+     */
+    class EXTERNAL CallSite {
+    public:
+        enum record : uint8_t {
+            // Far away from the MetaData::MessageType values, so the first byte tells them apart. Next to
+            // MessageUnit::InternedRecord (0x82).
+            ANNOUNCEMENT = 0x80,
+            TRACE = 0x81
+        };
+
+        static constexpr uint16_t MaxRecordSize = 1024;
+        static constexpr uint8_t HeaderSize = sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint64_t);
+
+    private:
+        template <typename TYPE, typename ENABLE = void>
+        struct Argument;
+
+        template <typename TYPE>
+        struct Argument<TYPE, typename std::enable_if<std::is_integral<TYPE>::value || std::is_enum<TYPE>::value>::type> {
+            static constexpr char Tag = (sizeof(TYPE) == 1 ? 'b' : sizeof(TYPE) == 2 ? 'h' : sizeof(TYPE) == 4 ? 'i' : 'q') - (std::is_signed<TYPE>::value ? 0 : ('a' - 'A'));
+            static uint16_t Encode(uint8_t buffer[], const uint16_t size, const TYPE value)
+            {
+                uint16_t result = 0;
+                if (size >= sizeof(TYPE)) {
+                    ::memcpy(buffer, &value, sizeof(TYPE));
+                    result = sizeof(TYPE);
+                }
+                return (result);
+            }
+        };
+        template <typename TYPE>
+        struct Argument<TYPE, typename std::enable_if<std::is_floating_point<TYPE>::value>::type> {
+            static constexpr char Tag = 'd';
+            static uint16_t Encode(uint8_t buffer[], const uint16_t size, const TYPE value)
+            {
+                uint16_t result = 0;
+                if (size >= sizeof(double)) {
+                    const double converted = static_cast<double>(value);
+                    ::memcpy(buffer, &converted, sizeof(double));
+                    result = sizeof(double);
+                }
+                return (result);
+            }
+        };
+        template <typename TYPE>
+        struct Argument<TYPE*, typename std::enable_if<!std::is_same<typename std::remove_cv<TYPE>::type, char>::value>::type> {
+            static constexpr char Tag = 'p';
+            static uint16_t Encode(uint8_t buffer[], const uint16_t size, const TYPE* value)
+            {
+                return (Argument<uint64_t>::Encode(buffer, size, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value))));
+            }
+        };
+        template <typename TYPE>
+        struct Argument<TYPE*, typename std::enable_if<std::is_same<typename std::remove_cv<TYPE>::type, char>::value>::type> {
+            static constexpr char Tag = 's';
+            static uint16_t Encode(uint8_t buffer[], const uint16_t size, const char* value)
+            {
+                return (value == nullptr ? Text(buffer, size, "(null)", 6) : Text(buffer, size, value, ::strlen(value)));
+            }
+        };
+        template <typename TYPE>
+        struct Argument<TYPE, typename std::enable_if<std::is_same<TYPE, string>::value>::type> {
+            static constexpr char Tag = 's';
+            static uint16_t Encode(uint8_t buffer[], const uint16_t size, const string& value)
+            {
+                return (Text(buffer, size, value.c_str(), value.length()));
+            }
+        };
+
+        template <typename... ARGS>
+        struct Signature {
+            static const char* Text()
+            {
+                static const char signature[] = { Argument<typename std::decay<ARGS>::type>::Tag..., '\0' };
+                return (signature);
+            }
+        };
+
+    public:
+        CallSite() = delete;
+        CallSite(const CallSite&) = delete;
+        CallSite& operator=(const CallSite&) = delete;
+
+        CallSite(const string& category, const char module[], const char file[], const uint16_t line, const char format[]);
+        ~CallSite() = default;
+
+    public:
+        inline uint32_t Id() const
+        {
+            return (_id);
+        }
+
+        template <typename... ARGS>
+        void Push(const ARGS&... args)
+        {
+            Core::Messaging::MessageUnit& unit(Core::Messaging::MessageUnit::Instance());
+            const uint32_t generation = unit.Generation();
+            uint8_t buffer[MaxRecordSize];
+
+            // The reader may have missed (or never seen) the announcement, say it (again) before the trace itself.
+            if (_generation.load(std::memory_order_acquire) != generation) {
+                Announce(generation, Signature<ARGS...>::Text());
+            }
+
+            buffer[0] = TRACE;
+            ::memcpy(&buffer[1], &_id, sizeof(_id));
+            const uint64_t timestamp = Core::Time::Now().Ticks();
+            ::memcpy(&buffer[1 + sizeof(_id)], &timestamp, sizeof(timestamp));
+
+            unit.Push(Pack(buffer, HeaderSize, args...), buffer);
+        }
+
+    private:
+        inline uint16_t Pack(uint8_t[], const uint16_t length) const
+        {
+            return (length);
+        }
+        template <typename TYPE, typename... ARGS>
+        uint16_t Pack(uint8_t buffer[], const uint16_t length, const TYPE& value, const ARGS&... args) const
+        {
+            // Whatever does not fit, is dropped. The reading side tells what is missing.
+            const uint16_t added = Argument<typename std::decay<TYPE>::type>::Encode(&buffer[length], MaxRecordSize - length, value);
+            return (Pack(buffer, length + added, args...));
+        }
+
+        static uint16_t Text(uint8_t buffer[], const uint16_t size, const char value[], const size_t length);
+
+        void Announce(const uint32_t generation, const char signature[]);
+
+    private:
+        const string _category;
+        const char* _module;
+        const char* _file;
+        const uint16_t _line;
+        const char* _format;
+        const uint32_t _id;
+        std::atomic<uint32_t> _generation;
+    };
+
+    /**
+     * @brief The reading side of the binary traces: remembers what the call sites of one process announced and turns
+     *        their traces back into text.
+     */
+    class EXTERNAL CallSites {
+    private:
+        struct Site {
+            string Category;
+            string Module;
+            string File;
+            uint16_t Line;
+            string Format;
+            string Signature;
+        };
+
+    public:
+        CallSites(const CallSites&) = delete;
+        CallSites& operator=(const CallSites&) = delete;
+
+        CallSites() = default;
+        ~CallSites() = default;
+
+    public:
+        static inline bool IsBinary(const uint8_t buffer[], const uint16_t length)
+        {
+            return ((length > 0) && ((buffer[0] == CallSite::ANNOUNCEMENT) || (buffer[0] == CallSite::TRACE)));
+        }
+
+        // False for a trace of a call site that did not announce itself (yet).
+        bool IsKnown(const uint8_t buffer[], const uint16_t length) const
+        {
+            uint32_t id;
+            bool result = true;
+
+            if ((buffer[0] == CallSite::TRACE) && (length >= CallSite::HeaderSize)) {
+                ::memcpy(&id, &buffer[1], sizeof(id));
+                result = (_sites.find(id) != _sites.end());
+            }
+
+            return (result);
+        }
+
+        // Returns true if the record was a trace, in which case info and text describe it.
+        bool Decode(const uint8_t buffer[], const uint16_t length, Core::Messaging::Information& info, string& text);
+        void Clear()
+        {
+            _sites.clear();
+        }
+
+        static void Render(const string& format, const string& signature, const uint8_t data[], const uint16_t length, string& text);
+
+    private:
+        std::unordered_map<uint32_t, Site> _sites;
+    };
+
+}
+}
@@ -58,6 +58,8 @@ namespace Messaging {
     {
         Core::SafeSyncType<Core::CriticalSection> guard(_adminLock);
         _clients.erase(id);
+        _callSites.erase(id);
+        _interned.erase(id);
     }
 
     /**
@@ -67,6 +69,8 @@ namespace Messaging {
     void MessageClient::ClearInstances()
     {
         _clients.clear();
+        _callSites.clear();
+        _interned.clear();
     }
 
     /**
@@ -180,30 +184,114 @@ namespace Messaging {
 
         Core::Messaging::Information information;
         Core::ProxyType<Core::Messaging::IEvent> message;
+        string text;
+        std::list<std::vector<uint8_t>> parked;
+
+        // Binary traces are turned into text here, and handed over as if they were traced as text.
+        auto decode = [&](CallSites& sites, const uint8_t buffer[], const uint16_t length) {
+            if (sites.Decode(buffer, length, information, text) == true) {
+                auto factory = _factories.find(Core::Messaging::MetaData::MessageType::TRACING);
+                if (factory != _factories.end()) {
+                    message = factory->second->Create();
+                    message->Deserialize(reinterpret_cast<uint8_t*>(&text[0]), static_cast<uint16_t>(text.length() + 1));
+                    function(information, message);
+                }
+            }
+        };
 
         for (auto& client : _clients) {
+            CallSites& sites(_callSites[client.first]);
+
             while (client.second.PopData(size, _readBuffer) != Core::ERROR_READ_ERROR) {
-                auto length = information.Deserialize(_readBuffer, size);
-
-                if (length > sizeof(Core::Messaging::MetaData::MessageType) && length < sizeof(_readBuffer)) {
-                    auto factory = _factories.find(information.MessageMetaData().Type());
-                    if (factory != _factories.end()) {
-                        message = factory->second->Create();
-                        message->Deserialize(_readBuffer + length, size - length);
-                        function(information, message);
+                if (CallSites::IsBinary(_readBuffer, size) == true) {
+                    if (sites.IsKnown(_readBuffer, size) == true) {
+                        decode(sites, _readBuffer, size);
+                    } else {
+                        // Threads with a buffer of their own may be read before the thread that announced the
+                        // call site, keep it until everything that is there now has been read.
+                        parked.emplace_back(_readBuffer, _readBuffer + std::min(size, static_cast<uint16_t>(sizeof(_readBuffer))));
+                    }
+                } else if ((size >= Core::Messaging::MessageUnit::InternedHeaderSize) && (size <= sizeof(_readBuffer)) && (_readBuffer[0] == Core::Messaging::MessageUnit::InternedRecord)) {
+                    uint32_t id;
+                    uint64_t timestamp;
+
+                    ::memcpy(&id, &_readBuffer[sizeof(uint8_t)], sizeof(id));
+                    ::memcpy(&timestamp, &_readBuffer[sizeof(uint8_t) + sizeof(id)], sizeof(timestamp));
+
+                    const Core::Messaging::Information& interned(Interned(client.first, client.second, id));
+                    const Core::Messaging::MetaData& metaData(interned.MessageMetaData());
+
+                    if (metaData.Type() != Core::Messaging::MetaData::MessageType::INVALID) {
+                        auto factory = _factories.find(metaData.Type());
+                        if (factory != _factories.end()) {
+                            information = Core::Messaging::Information(metaData.Type(), metaData.Category(), metaData.Module(), interned.FileName(), interned.LineNumber(), timestamp);
+                            message = factory->second->Create();
+                            message->Deserialize(_readBuffer + Core::Messaging::MessageUnit::InternedHeaderSize, size - Core::Messaging::MessageUnit::InternedHeaderSize);
+                            function(information, message);
+                        }
+                    }
+                } else {
+                    auto length = information.Deserialize(_readBuffer, size);
+
+                    if (length > sizeof(Core::Messaging::MetaData::MessageType) && length < sizeof(_readBuffer)) {
+                        auto factory = _factories.find(information.MessageMetaData().Type());
+                        if (factory != _factories.end()) {
+                            message = factory->second->Create();
+                            message->Deserialize(_readBuffer + length, size - length);
+                            function(information, message);
+                        }
+                    }
+                    else {
+                        client.second.FlushDataBuffer();
                     }
                 }
-                else {
-                    client.second.FlushDataBuffer();
-                }
-                
+
                 size = sizeof(_readBuffer);
             }
+
+            for (const std::vector<uint8_t>& record : parked) {
+                decode(sites, record.data(), static_cast<uint16_t>(record.size()));
+            }
+            parked.clear();
         }
 
         _adminLock.Unlock();
     }
 
+    /**
+     * @brief What a number in the data buffer of an instance stands for. Only the first time it is asked for, over the
+     *        metadata channel, to the instance that gave out the number.
+     *
+     * @param instance id of the instance
+     * @param dispatcher buffers of that instance
+     * @param id number found in the data buffer
+     * @return const Information& of type INVALID if the instance could not tell
+     */
+    const Core::Messaging::Information& MessageClient::Interned(const uint32_t instance, Core::Messaging::MessageUnit::MessageDispatcher& dispatcher, const uint32_t id)
+    {
+        std::unordered_map<uint32_t, Core::Messaging::Information>& table(_interned[instance]);
+        std::unordered_map<uint32_t, Core::Messaging::Information>::iterator index(table.find(id));
+
+        if (index == table.end()) {
+            Core::Messaging::Information info;
+
+            _writeBuffer[0] = Core::Messaging::MessageUnit::InternedRecord;
+            ::memcpy(&_writeBuffer[sizeof(uint8_t)], &id, sizeof(id));
+
+            const uint16_t length = dispatcher.PushMetadata(sizeof(uint8_t) + sizeof(id), _writeBuffer, sizeof(_writeBuffer));
+
+            if ((length == 0) || (length > sizeof(_writeBuffer)) || (info.Deserialize(_writeBuffer, length) != length)) {
+                // Remember it could not tell, so it is not asked again for every message.
+                TRACE_L1("Instance %u could not tell what %u stands for", instance, id);
+                info = Core::Messaging::Information();
+            }
+
+            index = table.emplace(id, info).first;
+        }
+
+        return (index->second);
+    }
+
     /**
      * @brief Register factory for a given message type. The factory will spawn a message suitable for deserializing received bytes
      * 
@@ -19,6 +19,7 @@
 
 #pragma once
 #include "Module.h"
+#include "BinaryTrace.h"
 
 namespace WPEFramework {
 namespace Messaging {
@@ -57,6 +58,9 @@ namespace Messaging {
         void AddFactory(Core::Messaging::MetaData::MessageType type, Core::Messaging::IEventFactory* factory);
         void RemoveFactory(Core::Messaging::MetaData::MessageType type);
 
+    private:
+        const Core::Messaging::Information& Interned(const uint32_t instance, Core::Messaging::MessageUnit::MessageDispatcher& dispatcher, const uint32_t id);
+
     private:
         using Clients = std::unordered_map<uint32_t, Core::Messaging::MessageUnit::MessageDispatcher>;
         mutable Core::CriticalSection _adminLock;
@@ -66,6 +70,8 @@ namespace Messaging {
         uint8_t _writeBuffer[Core::Messaging::MessageUnit::MetaDataSize];
 
         Clients _clients;
+        std::unordered_map<uint32_t, CallSites> _callSites;
+        std::unordered_map<uint32_t, std::unordered_map<uint32_t, Core::Messaging::Information>> _interned;
         Factories _factories;
         Core::Messaging::ControlList::InformationStorage _enabledCategories;
     };
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include "BinaryTrace.h"
 #include "Control.h"
 #include "Module.h"
 #include "TextMessage.h"
@@ -50,6 +51,29 @@
         WPEFramework::Core::Messaging::MessageUnit::Instance().Push(__info__, &__message__);                                                                                            \
     }
 
+// Like TRACE, but with a printf-like FORMAT that is only applied by whoever reads the trace. Only a call site
+// identifier, a timestamp and the arguments themselves are stored here, so tracing on hot paths costs next to nothing.
+// The arguments can be integers, enums, floating points, pointers, C strings and strings.
+#define TRACE_FORMAT(CATEGORY, FORMAT, ...)                                                                                                                                                \
+    if (WPEFramework::Messaging::ControlLifetime<CATEGORY, &WPEFramework::Core::System::MODULE_NAME, WPEFramework::Core::Messaging::MetaData::MessageType::TRACING>::IsEnabled() == true) { \
+        static WPEFramework::Messaging::CallSite __site__(WPEFramework::Core::ClassNameOnly(typeid(CATEGORY).name()).Text(),                                                               \
+            WPEFramework::Core::System::MODULE_NAME,                                                                                                                                        \
+            __FILE__,                                                                                                                                                                       \
+            __LINE__,                                                                                                                                                                       \
+            FORMAT);                                                                                                                                                                        \
+        __site__.Push(__VA_ARGS__);                                                                                                                                                         \
+    }
+
+#define TRACE_FORMAT_GLOBAL(CATEGORY, FORMAT, ...)                                                                                                                                         \
+    if (WPEFramework::Messaging::ControlLifetime<CATEGORY, &WPEFramework::Core::System::MODULE_NAME, WPEFramework::Core::Messaging::MetaData::MessageType::TRACING>::IsEnabled() == true) { \
+        static WPEFramework::Messaging::CallSite __site__(__FUNCTION__,                                                                                                                    \
+            WPEFramework::Core::System::MODULE_NAME,                                                                                                                                        \
+            __FILE__,                                                                                                                                                                       \
+            __LINE__,                                                                                                                                                                       \
+            FORMAT);                                                                                                                                                                        \
+        __site__.Push(__VA_ARGS__);                                                                                                                                                         \
+    }
+
 #define TRACE_DURATION(CODE, ...)                                     \
     WPEFramework::Core::Time start = WPEFramework::Core::Time::Now(); \
     CODE                                                              \
@@ -35,4 +35,5 @@
 #include "TraceControl.h"
 #include "Control.h"
 #include "TraceFactory.h"
+#include "BinaryTrace.h"
 #include "TextMessage.h"
\ No newline at end of file
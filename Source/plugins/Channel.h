@@ -113,15 +113,14 @@ namespace PluginHost {
                 if (_current.IsValid() == true) {
                     loaded = _current->Serialize(stream, length, _offset);
                     if ( (_offset == 0) || (loaded != length) ) {
-                        _current.Release();
-                    }
 #if THUNDER_PERFORMANCE
-                    else {
-			Core::ProxyType<const TrackingJSONRPC> tracking(_current);
-                        ASSERT (tracking.IsValid() == true);
-                        const_cast<TrackingJSONRPC&>(*tracking).Out(loaded);
-                    }
+                        Core::ProxyType<const TrackingJSONRPC> tracking(_current);
+                        if (tracking.IsValid() == true) {
+                            const_cast<TrackingJSONRPC&>(*tracking).Sent();
+                        }
 #endif
+                        _current.Release();
+                    }
                 }
 
                 return (loaded);
@@ -142,6 +141,9 @@ namespace PluginHost {
                 : _parent(parent)
                 , _current()
                 , _offset(0)
+#if THUNDER_PERFORMANCE
+                , _tracking()
+#endif
             {
             }
             ~DeserializerImpl()
@@ -161,20 +163,24 @@ namespace PluginHost {
                     if (_parent.IsOpen() == true) {
                         _current = _parent.Element(EMPTY_STRING);
                         _offset = 0;
+#if THUNDER_PERFORMANCE
+                        _tracking = Core::ProxyType<TrackingJSONRPC>(_current);
+#endif
                     }
                 } 
                 if (_current.IsValid() == true) {
                     loaded = _current->Deserialize(stream, length, _offset);
 #if THUNDER_PERFORMANCE
-		    Core::ProxyType<TrackingJSONRPC> tracking (_current);
-                    ASSERT (tracking.IsValid() == true);
-                    if(loaded > 0) {
-                        tracking->In(loaded);
+                    if ((_tracking.IsValid() == true) && (loaded > 0)) {
+                        _tracking->In(loaded);
                     }
 #endif
                     if ( (_offset == 0) || (loaded != length)) {
 #if THUNDER_PERFORMANCE
-                        tracking->In(0);
+                        if (_tracking.IsValid() == true) {
+                            _tracking->In(0);
+                            _tracking.Release();
+                        }
 #endif
                         _parent.Received(_current);
                         _current.Release();
@@ -188,6 +194,9 @@ namespace PluginHost {
             Channel& _parent;
             Core::ProxyType<Core::JSON::IElement> _current;
             uint32_t _offset;
+#if THUNDER_PERFORMANCE
+            Core::ProxyType<TrackingJSONRPC> _tracking;
+#endif
         };
 
     public:
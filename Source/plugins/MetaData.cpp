@@ -236,6 +236,65 @@ namespace PluginHost
     {
     }
 
+#if THUNDER_PERFORMANCE
+    MetaData::Histogram::Histogram()
+        : Core::JSON::Container()
+    {
+        Add(_T("count"), &Count);
+        Add(_T("average"), &Average);
+        Add(_T("maximum"), &Maximum);
+        Add(_T("buckets"), &Buckets);
+    }
+    MetaData::Histogram::Histogram(const Histogram& copy)
+        : Core::JSON::Container()
+        , Count(copy.Count)
+        , Average(copy.Average)
+        , Maximum(copy.Maximum)
+        , Buckets(copy.Buckets)
+    {
+        Add(_T("count"), &Count);
+        Add(_T("average"), &Average);
+        Add(_T("maximum"), &Maximum);
+        Add(_T("buckets"), &Buckets);
+    }
+    MetaData::Histogram::~Histogram()
+    {
+    }
+
+    MetaData::Performance::Performance()
+        : Core::JSON::Container()
+    {
+        Add(_T("method"), &Method);
+        Add(_T("deserialization"), &Deserialization);
+        Add(_T("queueing"), &Queueing);
+        Add(_T("waiting"), &Waiting);
+        Add(_T("execution"), &Execution);
+        Add(_T("communication"), &Communication);
+        Add(_T("total"), &Total);
+    }
+    MetaData::Performance::Performance(const Performance& copy)
+        : Core::JSON::Container()
+        , Method(copy.Method)
+        , Deserialization(copy.Deserialization)
+        , Queueing(copy.Queueing)
+        , Waiting(copy.Waiting)
+        , Execution(copy.Execution)
+        , Communication(copy.Communication)
+        , Total(copy.Total)
+    {
+        Add(_T("method"), &Method);
+        Add(_T("deserialization"), &Deserialization);
+        Add(_T("queueing"), &Queueing);
+        Add(_T("waiting"), &Waiting);
+        Add(_T("execution"), &Execution);
+        Add(_T("communication"), &Communication);
+        Add(_T("total"), &Total);
+    }
+    MetaData::Performance::~Performance()
+    {
+    }
+#endif
+
     MetaData::Server::Server()
     {
         Core::JSON::Container::Add(_T("threads"), &ThreadPoolRuns);
@@ -205,6 +205,44 @@ namespace PluginHost {
             SubSystemContainer _subSystems;
         };
 
+#if THUNDER_PERFORMANCE
+        class EXTERNAL Histogram : public Core::JSON::Container {
+        private:
+            Histogram& operator=(const Histogram&) = delete;
+
+        public:
+            Histogram();
+            Histogram(const Histogram& copy);
+            ~Histogram();
+
+        public:
+            Core::JSON::DecUInt32 Count;
+            Core::JSON::DecUInt32 Average;
+            Core::JSON::DecUInt32 Maximum;
+            // Counts per power of two microseconds: 1, 2, 4, ... and the last one the rest.
+            Core::JSON::ArrayType<Core::JSON::DecUInt32> Buckets;
+        };
+
+        class EXTERNAL Performance : public Core::JSON::Container {
+        private:
+            Performance& operator=(const Performance&) = delete;
+
+        public:
+            Performance();
+            Performance(const Performance& copy);
+            ~Performance();
+
+        public:
+            Core::JSON::String Method;
+            Histogram Deserialization;
+            Histogram Queueing;
+            Histogram Waiting;
+            Histogram Execution;
+            Histogram Communication;
+            Histogram Total;
+        };
+#endif
+
     public:
         MetaData();
         ~MetaData();
@@ -83,267 +83,310 @@ namespace PluginHost {
     };
 
 #if THUNDER_PERFORMANCE
-    class PerformanceAdministrator {
+    // Keeps track of how long the JSON-RPC requests take, per method, from the moment the first byte comes in, till the
+    // last byte of the response went out. The moments in between are stamped as the request passes by, so it can be
+    // told where the time went.
+    class EXTERNAL PerformanceAdministrator {
     public:
-        class Statistics {
-        public:
-            struct DataSet {
-                uint32_t Deserialization;
-                uint32_t ThreadPool;
-                uint32_t Execution;
-                uint32_t Communication;
-                uint32_t Serialization;
-                uint32_t Total;
-            };
-            class Tuple {
-            public:
-                Tuple() {
-                    Clear();
-                }
-                Tuple(const Tuple& copy) {
-                    _minimum = copy._minimum;
-                    _maximum = copy._maximum;
-                    _average = copy._average;
-                    _count = copy._count;
-                }
-                Tuple& operator= (const Tuple& rhs) {
-                    _minimum = rhs._minimum;
-                    _maximum = rhs._maximum;
-                    _average = rhs._average;
-                    _count = rhs._count;
+        enum measurement : uint8_t {
+            DESERIALIZATION, // First byte received, till the request is complete.
+            QUEUEING, // The request is complete, till it is queued for the thread pool.
+            WAITING, // Queued, till a thread of the pool picks it up.
+            EXECUTION, // Picked up, till the plugin is done with it.
+            COMMUNICATION, // Done, till the last byte of the response went out.
+            TOTAL
+        };
 
-                    return (*this);
-                }
-                ~Tuple() = default;
-
-            public:
-                void Clear() {
-                    _minimum = ~0;
-                    _maximum = 0;
-                    _average = 0;
-                    _count = 0;
-                }
-                void Measurement(const uint32_t data) {
-                    if (data < _minimum) { _minimum = data; }
-                    if (data > _maximum) { _maximum = data; }
-                    _average = ((_count * _average) + data) / (_count + 1);
-                    _count++;
-                }
-                uint32_t Minimum() const {
-                    return _minimum;
-                }
-                uint32_t Average() const {
-                    return _average;
-                }
-                uint32_t Maximum() const {
-                    return _maximum;
-                }
-                uint32_t Count() const {
-                    return _count;
-                }
+        static constexpr uint8_t Measurements = TOTAL + 1;
 
-            private:
-                uint32_t _minimum;
-                uint32_t _maximum;
-                uint32_t _average;
-                uint32_t _count;
-            };
+        // Durations, in microseconds, counted per power of two: bucket 0 holds those of 0 or 1 us, bucket n those up to
+        // 2^n us and the last one everything longer. Counting is lock free, so it can stay on.
+        class EXTERNAL Histogram {
+        public:
+            static constexpr uint8_t Buckets = 24;
 
         public:
-            Statistics() = delete;
-            Statistics(const Statistics& copy) = delete;
-            Statistics& operator= (const Statistics& rhs) = delete;
-
-            Statistics(const uint32_t uptill)
-                : _adminLock()
-                , _limit(uptill)
-		, _deserialization()
-                , _threadPool()
-                , _execution()
-                , _communication()
-                , _serialization()
-                , _total() {
+            Histogram(const Histogram&) = delete;
+            Histogram& operator=(const Histogram&) = delete;
+
+            Histogram()
+            {
+                Clear();
             }
-            ~Statistics() = default;
+            ~Histogram() = default;
 
         public:
-            void Clear() {
-                _deserialization.Clear();
-                _threadPool.Clear();
-                _execution.Clear();
-                _communication.Clear();
-                _serialization.Clear();
-                _total.Clear();
+            void Clear()
+            {
+                for (std::atomic<uint32_t>& bucket : _buckets) {
+                    bucket.store(0, std::memory_order_relaxed);
+                }
+                _count.store(0, std::memory_order_relaxed);
+                _total.store(0, std::memory_order_relaxed);
+                _maximum.store(0, std::memory_order_relaxed);
             }
-            void Add(const DataSet& data) {
-		_adminLock.Lock();
-                _deserialization.Measurement(data.Deserialization);
-                _threadPool.Measurement(data.ThreadPool);
-                _execution.Measurement(data.Execution);
-                _communication.Measurement(data.Communication);
-                _serialization.Measurement(data.Serialization);
-                _total.Measurement(data.Total);
-		_adminLock.Unlock();
+            void Measurement(const uint32_t duration)
+            {
+                uint32_t maximum = _maximum.load(std::memory_order_relaxed);
+
+                _buckets[Slot(duration)].fetch_add(1, std::memory_order_relaxed);
+                _count.fetch_add(1, std::memory_order_relaxed);
+                _total.fetch_add(duration, std::memory_order_relaxed);
+
+                while ((duration > maximum) && (_maximum.compare_exchange_weak(maximum, duration, std::memory_order_relaxed) == false)) {
+                }
             }
-            uint32_t Limit() const {
-                return (_limit);
+            uint32_t Count() const
+            {
+                return (_count.load(std::memory_order_relaxed));
             }
-            Tuple Deserialization() const {
-		Core::SafeSyncType<Core::CriticalSection> lock (_adminLock);
-                return _deserialization;
+            uint32_t Average() const
+            {
+                const uint32_t count = Count();
+
+                return (count == 0 ? 0 : static_cast<uint32_t>(_total.load(std::memory_order_relaxed) / count));
             }
-            Tuple ThreadPool() const {
-		Core::SafeSyncType<Core::CriticalSection> lock (_adminLock);
-                return _threadPool;
+            uint32_t Maximum() const
+            {
+                return (_maximum.load(std::memory_order_relaxed));
             }
-            Tuple Execution() const {
-		Core::SafeSyncType<Core::CriticalSection> lock (_adminLock);
-                return _execution;
+            uint32_t Bucket(const uint8_t index, uint32_t& upTo) const
+            {
+                ASSERT(index < Buckets);
+
+                upTo = (index == (Buckets - 1) ? Core::NumberType<uint32_t>::Max() : (1u << index));
+
+                return (_buckets[index].load(std::memory_order_relaxed));
             }
-            Tuple Communication() const {
-		Core::SafeSyncType<Core::CriticalSection> lock (_adminLock);
-                return _communication;
+
+        private:
+            static uint8_t Slot(uint32_t duration)
+            {
+                uint8_t result = 0;
+
+                if (duration > 1) {
+                    duration--;
+                    while ((duration != 0) && (result < (Buckets - 1))) {
+                        duration >>= 1;
+                        result++;
+                    }
+                }
+
+                return (result);
+            }
+
+        private:
+            std::atomic<uint32_t> _buckets[Buckets];
+            std::atomic<uint32_t> _count;
+            std::atomic<uint64_t> _total;
+            std::atomic<uint32_t> _maximum;
+        };
+
+        class EXTERNAL Statistics {
+        public:
+            Statistics(const Statistics&) = delete;
+            Statistics& operator=(const Statistics&) = delete;
+
+            Statistics() = default;
+            ~Statistics() = default;
+
+        public:
+            void Clear()
+            {
+                for (Histogram& histogram : _histograms) {
+                    histogram.Clear();
+                }
             }
-            Tuple Serialization() const {
-		Core::SafeSyncType<Core::CriticalSection> lock (_adminLock);
-                return _serialization;
+            // The moments the request passed by, in ticks, from receiving the first byte, till sending the last.
+            void Add(const uint64_t stamps[])
+            {
+                for (uint8_t index = 0; index < TOTAL; index++) {
+                    _histograms[index].Measurement(Duration(stamps[index], stamps[index + 1]));
+                }
+                _histograms[TOTAL].Measurement(Duration(stamps[0], stamps[TOTAL]));
             }
-            Tuple Total() const {
-		Core::SafeSyncType<Core::CriticalSection> lock (_adminLock);
-                return _total;
+            const Histogram& operator[](const measurement index) const
+            {
+                return (_histograms[index]);
             }
 
         private:
-            mutable Core::CriticalSection _adminLock;
-            uint32_t _limit;
-            Tuple _deserialization;
-            Tuple _threadPool;
-            Tuple _execution;
-            Tuple _communication;
-            Tuple _serialization;
-            Tuple _total;
+            static uint32_t Duration(const uint64_t from, const uint64_t till)
+            {
+                // A moment may be missing, if the request took a shortcut, count it as nothing.
+                return ((from == 0) || (till < from) ? 0 : static_cast<uint32_t>(std::min(till - from, static_cast<uint64_t>(Core::NumberType<uint32_t>::Max()))));
+            }
+
+        private:
+            Histogram _histograms[Measurements];
         };
 
-        using StatisticsList = std::list< Statistics >;
+        // Methods beyond this are not tracked separately, so clients calling whatever can not have us grow forever.
+        static constexpr uint16_t MaxMethods = 256;
 
     private:
+        using StatisticsMap = std::unordered_map<string, Statistics>;
+
         PerformanceAdministrator()
-            : _statistics() {
-            _statistics.emplace_back(100);
-            _statistics.emplace_back(200);
-            _statistics.emplace_back(400);
-            _statistics.emplace_back(800);
-            _statistics.emplace_back(1600);
-            _statistics.emplace_back(3200);
-            _statistics.emplace_back(6400);
-            _statistics.emplace_back(Core::NumberType<uint32_t>::Max());
+            : _adminLock()
+            , _statistics()
+        {
         }
 
     public:
         PerformanceAdministrator(const PerformanceAdministrator&) = delete;
-        PerformanceAdministrator& operator= (const PerformanceAdministrator&) = delete;
+        PerformanceAdministrator& operator=(const PerformanceAdministrator&) = delete;
 
-        static PerformanceAdministrator& Instance() {
+        static PerformanceAdministrator& Instance()
+        {
             static PerformanceAdministrator singleton;
             return (singleton);
         }
 
-        void Clear() {
-            StatisticsList::iterator index(_statistics.begin());
-            while (index != _statistics.end()) {
-                index->Clear();
-                index++;
+        void Clear()
+        {
+            _adminLock.Lock();
+
+            for (std::pair<const string, Statistics>& entry : _statistics) {
+                entry.second.Clear();
             }
+
+            _adminLock.Unlock();
         }
 
-        void Store(const uint32_t packageSize, const Statistics::DataSet& statistics) {
-            StatisticsList::iterator index(_statistics.begin());
-            while ( (index != _statistics.end()) && (packageSize > index->Limit()) ) {
-                index++;
+        // The statistics of the method the designator points to, the index, if any, is not taken into account. Entries
+        // are never removed, so the statistics stay where they are for as long as we run.
+        Statistics& Find(const string& designator)
+        {
+            const size_t index = designator.find_last_of('@');
+            const string method(index == string::npos ? designator : designator.substr(0, index));
+
+            _adminLock.Lock();
+
+            StatisticsMap::iterator entry(_statistics.find(method));
+
+            if ((entry == _statistics.end()) && (_statistics.size() >= MaxMethods)) {
+                entry = _statistics.find(_T("*"));
             }
-            ASSERT (index != _statistics.end());
-            index->Add(statistics);
+            if (entry == _statistics.end()) {
+                entry = _statistics.emplace(std::piecewise_construct,
+                    std::forward_as_tuple(_statistics.size() < MaxMethods ? method : string(_T("*"))),
+                    std::forward_as_tuple()).first;
+            }
+
+            Statistics& result(entry->second);
+
+            _adminLock.Unlock();
+
+            return (result);
         }
 
-        const Statistics& Retrieve(const uint32_t packageSize) const {
-            StatisticsList::const_iterator index (_statistics.cbegin());
-            while ( (index != _statistics.cend()) && (packageSize > index->Limit()) ) {
-                index++;
+        void Visit(const std::function<void(const string& method, const Statistics& statistics)>& visitor) const
+        {
+            _adminLock.Lock();
+
+            for (const std::pair<const string, Statistics>& entry : _statistics) {
+                visitor(entry.first, entry.second);
             }
-            ASSERT (index != _statistics.end());
-            return (*index);
+
+            _adminLock.Unlock();
         }
 
     private:
-        StatisticsList _statistics;
+        mutable Core::CriticalSection _adminLock;
+        StatisticsMap _statistics;
     };
 
-    class TrackingJSONRPC : public Web::JSONBodyType<Core::JSONRPC::Message> {
+    class EXTERNAL TrackingJSONRPC : public Web::JSONBodyType<Core::JSONRPC::Message> {
+    private:
+        enum stamp : uint8_t {
+            RECEIVED,
+            DESERIALIZED,
+            QUEUED,
+            DISPATCHED,
+            EXECUTED,
+            SENT
+        };
+
     public:
         TrackingJSONRPC(const TrackingJSONRPC&) = delete;
-        TrackingJSONRPC& operator= (const TrackingJSONRPC&) = delete;
+        TrackingJSONRPC& operator=(const TrackingJSONRPC&) = delete;
 
-        TrackingJSONRPC() = default;
+        TrackingJSONRPC()
+            : Web::JSONBodyType<Core::JSONRPC::Message>()
+            , _statistics(nullptr)
+        {
+            ::memset(_stamps, 0, sizeof(_stamps));
+        }
         ~TrackingJSONRPC() override = default;
 
     public:
-        void Clear() {
-            _in = 0;
-            _out = 0;
-            Web::JSONBodyType<Core::JSONRPC::Message>::Clear();
+        void Clear()
+        {
+            _statistics = nullptr;
+            ::memset(_stamps, 0, sizeof(_stamps));
 
+            Web::JSONBodyType<Core::JSONRPC::Message>::Clear();
         }
-	void In(const uint32_t data) {
+        // Bytes came in, or if there are none, the request is complete.
+        void In(const uint32_t data)
+        {
             if (data == 0) {
-                uint64_t now = Core::Time::Now().Ticks();
-                _statistics.Deserialization = static_cast<uint32_t>(now - _stamp);
-		_stamp = now;
+                Stamp(DESERIALIZED);
+            } else if (_stamps[RECEIVED] == 0) {
+                Stamp(RECEIVED);
             }
-            _in += data;
         }
-	void Out(const uint32_t data) {
-            if (data == 0) {
-                uint64_t now = Core::Time::Now().Ticks();
-                _statistics.Communication = static_cast<uint32_t>(now - _stamp);
-                _stamp = now;
-            }
-            _out += data;
+        void Queued()
+        {
+            Stamp(QUEUED);
         }
-        void Dispatch() {
-            uint64_t now = Core::Time::Now().Ticks();
-            _statistics.ThreadPool = static_cast<uint32_t>(now - _stamp);
-            _stamp = now;
+        void Dispatch()
+        {
+            Stamp(DISPATCHED);
+        }
+        // The request is handled, what is left is sending the response. The moments so far move along with the
+        // response. Without a response, the request is done here.
+        void Execution(const Core::ProxyType<Core::JSONRPC::Message>& response)
+        {
+            Core::ProxyType<TrackingJSONRPC> tracking(response);
+
+            Stamp(EXECUTED);
+
+            _statistics = &(PerformanceAdministrator::Instance().Find(Designator.Value()));
+
+            if (tracking.IsValid() == false) {
+                _stamps[SENT] = _stamps[EXECUTED];
+                Completed();
+            } else if (tracking.operator->() != this) {
+                ::memcpy(tracking->_stamps, _stamps, sizeof(_stamps));
+                tracking->_statistics = _statistics;
+                _statistics = nullptr;
+            }
         }
-	void Execution() {
-            uint64_t now = Core::Time::Now().Ticks();
-            _statistics.Execution = static_cast<uint32_t>(now - _stamp);
-            _stamp = now;
+        // The last byte of the response went out.
+        void Sent()
+        {
+            if (_statistics != nullptr) {
+                Stamp(SENT);
+                Completed();
+            }
         }
-        void Acquire() {
-            _stamp = Core::Time::Now().Ticks();
-	    _begin = _stamp;
+
+    private:
+        void Stamp(const stamp moment)
+        {
+            _stamps[moment] = Core::Time::Now().Ticks();
         }
-        void Relinquish() {
-            uint64_t now = Core::Time::Now().Ticks();
-            _statistics.Total = static_cast<uint32_t>(now - _begin);
-            _statistics.Serialization = static_cast<uint32_t>(now - _stamp);
-
-            // Time to register all data...We are completed, we got:
-            // _deserialisationTime = Time it took to receive the full message till completion and its size in _in (bytes)
-            // _threadPoolWait = Time it took for the deserialized message to be picked up by the workerpool to be executed.
-            // _execution = Time it took for the request to reach completion. Actual execution time of the request.
-            // _communicatorWait = Time it took after the response message was dropped for the resource monitor to pick it up for sending.
-            // _serializationTime = Time it took for the response to be fully serialized and send over the line. size is in _out (bytes)
-            // total = Time it took from entering the system and leaving the system. This should pretty mucch be the sum of all times.
-            PerformanceAdministrator::Instance().Store(_in, _statistics);
+        void Completed()
+        {
+            _statistics->Add(_stamps);
+            _statistics = nullptr;
         }
 
     private:
-        uint32_t _in;
-        uint32_t _out;
-        uint64_t _begin;
-        uint64_t _stamp;
-        PerformanceAdministrator::Statistics::DataSet _statistics;
+        PerformanceAdministrator::Statistics* _statistics;
+        uint64_t _stamps[SENT + 1];
     };
     using JSONRPCMessage = TrackingJSONRPC;
 #else
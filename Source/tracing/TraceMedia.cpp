@@ -54,37 +54,40 @@ POP_WARNING()
         uint64_t current = Core::Time::Now().Ticks();
         Core::TextFragment cleanClassName(Core::ClassNameOnly(className));
 
-        m_Output._traceBuffer[0] = 'T';
-        m_Output._traceBuffer[1] = (current >> 56) & 0xFF;
-        m_Output._traceBuffer[2] = (current >> 48) & 0xFF;
-        m_Output._traceBuffer[3] = (current >> 40) & 0xFF;
-        m_Output._traceBuffer[4] = (current >> 32) & 0xFF;
-        m_Output._traceBuffer[5] = (current >> 24) & 0xFF;
-        m_Output._traceBuffer[6] = (current >> 16) & 0xFF;
-        m_Output._traceBuffer[7] = (current >> 8) & 0xFF;
-        m_Output._traceBuffer[8] = (current >> 0) & 0xFF;
-        m_Output._traceBuffer[9] = (lineNumber >> 24) & 0xFF;
-        m_Output._traceBuffer[10] = (lineNumber >> 16) & 0xFF;
-        m_Output._traceBuffer[11] = (lineNumber >> 8) & 0xFF;
-        m_Output._traceBuffer[12] = (lineNumber >> 0) & 0xFF;
-
-        char* result = CopyText(&m_Output._traceBuffer[13], fileName, sizeof(m_Output._traceBuffer) - 13);
-
-        ASSERT(cleanClassName.Length() < (sizeof(m_Output._traceBuffer) - static_cast<uint32_t>(result - m_Output._traceBuffer)));
+        char line[Channel::LineSize];
+
+        line[0] = 'T';
+        line[1] = (current >> 56) & 0xFF;
+        line[2] = (current >> 48) & 0xFF;
+        line[3] = (current >> 40) & 0xFF;
+        line[4] = (current >> 32) & 0xFF;
+        line[5] = (current >> 24) & 0xFF;
+        line[6] = (current >> 16) & 0xFF;
+        line[7] = (current >> 8) & 0xFF;
+        line[8] = (current >> 0) & 0xFF;
+        line[9] = (lineNumber >> 24) & 0xFF;
+        line[10] = (lineNumber >> 16) & 0xFF;
+        line[11] = (lineNumber >> 8) & 0xFF;
+        line[12] = (lineNumber >> 0) & 0xFF;
+
+        char* result = CopyText(&line[13], fileName, sizeof(line) - 13);
+
+        ASSERT(cleanClassName.Length() < (sizeof(line) - static_cast<uint32_t>(result - line)));
 
         memcpy(result, cleanClassName.Data(), cleanClassName.Length());
         result = &(result[cleanClassName.Length()]);
         *result++ = '\0';
 
-        uint16_t length = static_cast<uint16_t>(result - m_Output._traceBuffer);
-        uint16_t bufferRemaining = sizeof(m_Output._traceBuffer) - length;
+        uint16_t length = static_cast<uint16_t>(result - line);
+        uint16_t bufferRemaining = sizeof(line) - length;
         uint16_t copiedBytes = (bufferRemaining > information->Length()) ? information->Length() : bufferRemaining;
 
         memcpy(result, information->Data(), copiedBytes);
 
-        m_Output._loaded = length + copiedBytes;
-
-        m_Output.Trigger();
+        // Lines that come in while the previous ones are still waiting go out with them, in one go.
+        if (m_Output.Load(line, length + copiedBytes) == true) {
+            m_Output.Trigger();
+        }
     }
 
     void TraceMedia::HandleMessage(const uint8_t* dataFrame, const uint16_t receivedSize)
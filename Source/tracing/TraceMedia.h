@@ -39,13 +39,22 @@ namespace Trace {
     class EXTERNAL TraceMedia : public ITraceMedia {
     private:
         class Channel : public Core::SocketDatagram {
+        public:
+            // Trace lines waiting to go out, they are sent in batches of up to BatchSize datagrams.
+            static constexpr uint8_t QueueSize = 32;
+            static constexpr uint8_t BatchSize = 16;
+            static constexpr uint16_t LineSize = 1500;
+
         public:
             Channel(TraceMedia& parent, const Core::NodeId& remoteNode)
                 : Core::SocketDatagram(false, remoteNode.Origin(), remoteNode, 2048, TRACINGBUFFERSIZE + 512)
+                , _adminLock()
+                , _head(0)
                 , _loaded(0)
                 , // 32 bytes for preamble
                 _parent(parent)
             {
+                Batch(BatchSize);
             }
             virtual ~Channel()
             {
@@ -53,15 +62,44 @@ namespace Trace {
             }
 
         public:
+            // Queue a line to be sent, if the queue is full, the line is dropped.
+            bool Load(const char line[], const uint16_t length)
+            {
+                bool loaded = false;
+
+                ASSERT(length <= LineSize);
+
+                _adminLock.Lock();
+
+                if (_loaded < QueueSize) {
+                    const uint8_t index = (_head + _loaded) % QueueSize;
+
+                    ::memcpy(_lines[index], line, length);
+                    _lengths[index] = length;
+                    _loaded++;
+                    loaded = true;
+                }
+
+                _adminLock.Unlock();
+
+                return (loaded);
+            }
+
             // Methods to extract and insert data into the socket buffers
             virtual uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize)
             {
-                // We used it all up..
-                // TODO: make thread safe.
+                uint16_t actualByteCount = 0;
+
+                _adminLock.Lock();
 
-                uint16_t actualByteCount = _loaded > maxSendSize ? maxSendSize : _loaded;
-                memcpy(dataFrame, _traceBuffer, actualByteCount);
-                _loaded = 0;
+                if (_loaded > 0) {
+                    actualByteCount = _lengths[_head] > maxSendSize ? maxSendSize : _lengths[_head];
+                    memcpy(dataFrame, _lines[_head], actualByteCount);
+                    _head = (_head + 1) % QueueSize;
+                    _loaded--;
+                }
+
+                _adminLock.Unlock();
 
                 return (actualByteCount);
             }
@@ -76,13 +114,12 @@ namespace Trace {
             {
             }
 
-            // TODO: lock to keep this consistent
-            char _traceBuffer[1500];
-            uint16_t _loaded;
-
-            // TODO: create message here, not in parent
-
         private:
+            Core::CriticalSection _adminLock;
+            char _lines[QueueSize][LineSize];
+            uint16_t _lengths[QueueSize];
+            uint8_t _head;
+            uint8_t _loaded;
             TraceMedia& _parent;
         };
 
@@ -127,8 +127,10 @@ namespace WPEFramework {
 					typedef Core::StreamJSONType<Web::WebSocketClientType<Core::SocketStream>, FactoryImpl&, INTERFACE> BaseClass;
 
 				public:
+					// The buffers of 256 bytes are ours, the kernel keeps its own sizes. Shrinking those as well closes the
+					// TCP window on anything bigger, and every such response then waits for the window to open again.
 					ChannelImpl(CommunicationChannel* parent, const Core::NodeId& remoteNode, const string& callsign, const string& query)
-						: BaseClass(5, FactoryImpl::Instance(), callsign, _T("JSON"), query, "", false, false, false, remoteNode.AnyInterface(), remoteNode, 256, 256)
+						: BaseClass(5, FactoryImpl::Instance(), callsign, _T("JSON"), query, "", false, false, false, remoteNode.AnyInterface(), remoteNode, 256, 256, static_cast<uint32_t>(~0), static_cast<uint32_t>(~0))
 						, _parent(*parent)
 					{
 					}
@@ -325,10 +327,12 @@ namespace WPEFramework {
 					ASynchronous(const uint32_t waitTime, const CallbackFunction& completed)
 						: _waitTime(Core::Time::Now().Add(waitTime).Ticks())
 						, _completed(completed)
+						, _submitted(false)
 					{
 					}
 					uint64_t _waitTime;
 					CallbackFunction _completed;
+					bool _submitted;
 				};
 
 			public:
@@ -373,6 +377,15 @@ namespace WPEFramework {
 				{
 					return (_info.async._waitTime);
 				}
+				bool IsSubmitted() const
+				{
+					return ((_synchronous == true) || (_info.async._submitted == true));
+				}
+				void Submitted()
+				{
+					ASSERT(_synchronous == false);
+					_info.async._submitted = true;
+				}
 				void Abort(const uint32_t id)
 				{
 					if (_synchronous == true) {
@@ -431,6 +444,77 @@ namespace WPEFramework {
 					ASynchronous async;
 				} _info;
 			};
+			// The pending a-sync calls, by the moment they expire. A call that expires more than a turn of the wheel
+			// ahead, comes by every turn, until it is due.
+			class TimeoutWheel {
+			private:
+				static constexpr uint16_t Slots = 256;
+				static constexpr uint64_t Resolution = 10 * Core::Time::TicksPerMillisecond;
+
+			public:
+				TimeoutWheel() = delete;
+				TimeoutWheel(const TimeoutWheel&) = delete;
+				TimeoutWheel& operator=(const TimeoutWheel&) = delete;
+
+				TimeoutWheel(const uint64_t start)
+					: _slots(Slots)
+					, _current(start / Resolution)
+					, _count(0)
+				{
+				}
+				~TimeoutWheel() = default;
+
+			public:
+				void Insert(const uint32_t id, const uint64_t expiry)
+				{
+					// A slot holds what expires up to and including its tick.
+					const uint64_t tick = std::max((expiry + Resolution - 1) / Resolution, _current);
+
+					_slots[tick % Slots].push_back(id);
+					_count++;
+				}
+				// Take out all that is due by now, and those of a later turn that share a slot with them.
+				void Expired(const uint64_t now, std::vector<uint32_t>& due)
+				{
+					const uint64_t last = now / Resolution;
+
+					for (uint64_t tick = _current; (tick <= last) && (tick < (_current + Slots)) && (_count != 0); tick++) {
+						std::vector<uint32_t>& slot(_slots[tick % Slots]);
+
+						due.insert(due.end(), slot.begin(), slot.end());
+						_count -= static_cast<uint32_t>(slot.size());
+						slot.clear();
+					}
+
+					_current = std::max(_current, last + 1);
+				}
+				// The moment the first non empty slot comes by, 0 if there is none.
+				uint64_t Next() const
+				{
+					uint64_t result = 0;
+
+					for (uint64_t tick = _current; (result == 0) && (_count != 0) && (tick < (_current + Slots)); tick++) {
+						if (_slots[tick % Slots].empty() == false) {
+							result = tick * Resolution;
+						}
+					}
+
+					return (result);
+				}
+				void Clear()
+				{
+					for (std::vector<uint32_t>& slot : _slots) {
+						slot.clear();
+					}
+					_count = 0;
+				}
+
+			private:
+				std::vector<std::vector<uint32_t>> _slots;
+				uint64_t _current;
+				uint32_t _count;
+			};
+
 			static Core::NodeId RemoteNodeId()
 			{
 				Core::NodeId result;
@@ -449,8 +533,88 @@ namespace WPEFramework {
 			using PendingMap = std::unordered_map<uint32_t, Entry>;
 			using InvokeFunction = Core::JSONRPC::InvokeFunction;
 
+		public:
+			// The response to an a-sync call, to collect whenever it suits the caller.
+			class Future {
+			private:
+				class State {
+				public:
+					State(const State&) = delete;
+					State& operator=(const State&) = delete;
+
+					State()
+						: _signal(false, true)
+						, _result(Core::ERROR_UNAVAILABLE)
+						, _response()
+					{
+					}
+					~State() = default;
+
+				public:
+					void Completed(const Core::JSONRPC::Message& response)
+					{
+						if (response.Error.IsSet() == true) {
+							_result = response.Error.Code.Value();
+							_response = response.Error.Text.Value();
+						}
+						else {
+							_result = Core::ERROR_NONE;
+							_response = response.Result.Value();
+						}
+						_signal.SetEvent();
+					}
+					void Completed(const uint32_t result)
+					{
+						_result = result;
+						_signal.SetEvent();
+					}
+
+				public:
+					Core::Event _signal;
+					uint32_t _result;
+					string _response;
+				};
+
+			public:
+				Future()
+					: _state(Core::ProxyType<State>::Create())
+				{
+				}
+				Future(const Future&) = default;
+				Future& operator=(const Future&) = default;
+				~Future() = default;
+
+			public:
+				// Core::ERROR_NONE once the call completed, whatever the outcome.
+				uint32_t Wait(const uint32_t waitTime) const
+				{
+					return (_state->_signal.Lock(waitTime));
+				}
+				bool IsCompleted() const
+				{
+					return (_state->_signal.IsSet());
+				}
+				// The error code the call came back with, or Core::ERROR_TIMEDOUT/Core::ERROR_ASYNC_ABORTED
+				// if it did not come back at all.
+				uint32_t Result() const
+				{
+					return (_state->_result);
+				}
+				// The result, or the error text if it failed.
+				const string& Response() const
+				{
+					return (_state->_response);
+				}
+
+			private:
+				friend class LinkType<INTERFACE>;
+
+				Core::ProxyType<State> _state;
+			};
+
 		protected:
 			static constexpr uint32_t DefaultWaitTime = 10000;
+			static constexpr uint16_t DefaultWindow = 64;
 
 			LinkType(const string& callsign, const string connectingCallsign, const TCHAR* localCallsign, const string& query)
 				: _adminLock()
@@ -462,6 +626,10 @@ namespace WPEFramework {
 				, _pendingQueue()
 				, _scheduledTime(0)
 				, _versionstring()
+				, _timeouts(Core::Time::Now().Ticks())
+				, _waiting()
+				, _window(DefaultWindow)
+				, _inflight(0)
 			{
 				if (localCallsign == nullptr) {
 					static uint32_t sequence;
@@ -513,6 +681,25 @@ namespace WPEFramework {
 			{
 				return (_handler.Events());
 			}
+			// The number of a-sync calls that can be on their way at the same time, the rest waits for them to
+			// complete before being sent.
+			uint16_t Window() const
+			{
+				return (_window);
+			}
+			void Window(const uint16_t calls)
+			{
+				std::list<Core::ProxyType<Core::JSONRPC::Message>> ready;
+
+				ASSERT(calls != 0);
+
+				_adminLock.Lock();
+				_window = calls;
+				Release(ready);
+				_adminLock.Unlock();
+
+				Submit(ready);
+			}
 			template <typename INBOUND, typename METHOD>
 			void Assign(const string& eventName, const METHOD& method)
 			{
@@ -740,6 +927,32 @@ namespace WPEFramework {
 				return (Send(waitTime, method, parameters, response));
 			}
 
+			// Pipelined a-sync calls, the response message is handed over as it came in, or an error message
+			// if it did not come in time, or the connection dropped. Calls beyond the Window() wait their turn.
+			template <typename PARAMETERS>
+			uint32_t Post(const uint32_t waitTime, const string& method, const PARAMETERS& parameters, const std::function<void(const Core::JSONRPC::Message&)>& completed)
+			{
+				CallbackFunction implementation(completed);
+
+				return (Send(waitTime, method, parameters, implementation));
+			}
+			template <typename PARAMETERS>
+			Future Post(const uint32_t waitTime, const string& method, const PARAMETERS& parameters)
+			{
+				Future future;
+				Core::ProxyType<typename Future::State> state(future._state);
+
+				uint32_t result = Post(waitTime, method, parameters, [state](const Core::JSONRPC::Message& response) {
+					state->Completed(response);
+				});
+
+				if (result != Core::ERROR_NONE) {
+					state->Completed(result);
+				}
+
+				return (future);
+			}
+
 			// Generic JSONRPC methods.
 			// Anything goes!
 			// these objects have no type chacking, will consume more memory and processing takes more time
@@ -779,25 +992,43 @@ namespace WPEFramework {
 			{
 				uint64_t result = ~0;
 				uint64_t currentTime = Core::Time::Now().Ticks();
+				std::vector<uint32_t> due;
+				std::list<Core::ProxyType<Core::JSONRPC::Message>> ready;
 
 				// Lets see if some callback are expire. If so trigger and remove...
 				_adminLock.Lock();
 
-				typename PendingMap::iterator index = _pendingQueue.begin();
+				_timeouts.Expired(currentTime, due);
 
-				while (index != _pendingQueue.end()) {
+				for (const uint32_t id : due) {
+					typename PendingMap::iterator index = _pendingQueue.find(id);
 
-					if (index->second.Expired(index->first, currentTime, result) == true) {
-						index = _pendingQueue.erase(index);
-					}
-					else {
-						index++;
+					// Answered calls are not taken out of the wheel, they are just no longer pending.
+					if (index != _pendingQueue.end()) {
+						const bool submitted = index->second.IsSubmitted();
+
+						if (index->second.Expired(index->first, currentTime, result) == false) {
+							_timeouts.Insert(id, index->second.Expiry());
+						}
+						else {
+							_pendingQueue.erase(index);
+
+							if (submitted == true) {
+								ASSERT(_inflight > 0);
+								_inflight--;
+							}
+						}
 					}
 				}
-				_scheduledTime = (result != static_cast<uint64_t>(~0) ? result : 0);
+
+				Release(ready);
+
+				_scheduledTime = _timeouts.Next();
 
 				_adminLock.Unlock();
 
+				Submit(ready);
+
 				return (_scheduledTime);
 			}
 			template <typename PARAMETERS, typename RESPONSE>
@@ -920,6 +1151,10 @@ namespace WPEFramework {
 					_pendingQueue.erase(_pendingQueue.begin());
 				}
 
+				_waiting.clear();
+				_timeouts.Clear();
+				_inflight = 0;
+
 				_adminLock.Unlock();
 			}
 			template <typename PARAMETERS>
@@ -1018,14 +1253,28 @@ namespace WPEFramework {
 
 					if (newElement.second == true) {
 						uint64_t expiry = newElement.first->second.Expiry();
-						_adminLock.Unlock();
 
-						_channel->Submit(Core::ProxyType<INTERFACE>(message));
+						_timeouts.Insert(id, expiry);
+
+						if ((_inflight < _window) && (_waiting.empty() == true)) {
+							newElement.first->second.Submitted();
+							_inflight++;
+
+							_adminLock.Unlock();
+
+							_channel->Submit(Core::ProxyType<INTERFACE>(message));
+
+							_adminLock.Lock();
+						}
+						else {
+							// Enough on its way already, this one goes as soon as one of those completes.
+							_waiting.push_back(message);
+						}
 
 						result = Core::ERROR_NONE;
 
 						message.Release();
-						_adminLock.Lock();
+
 						if ((_scheduledTime == 0) || (_scheduledTime > expiry)) {
 							_scheduledTime = expiry;
 							CommunicationChannel::Trigger(_scheduledTime, this);
@@ -1045,6 +1294,8 @@ namespace WPEFramework {
 
 				if ((inbound->Id.IsSet() == true) && (inbound->Result.IsSet() || inbound->Error.IsSet())) {
 					// Looks like this is a response..
+					std::list<Core::ProxyType<Core::JSONRPC::Message>> ready;
+
 					ASSERT(inbound->Parameters.IsSet() == false);
 					ASSERT(inbound->Designator.IsSet() == false);
 
@@ -1057,12 +1308,19 @@ namespace WPEFramework {
 
 						if (index->second.Signal(inbound) == true) {
 							_pendingQueue.erase(index);
+
+							ASSERT(_inflight > 0);
+							_inflight--;
+
+							Release(ready);
 						}
 
 						result = Core::ERROR_NONE;
 					}
 
 					_adminLock.Unlock();
+
+					Submit(ready);
 				}
 				else {
 					// check if we understand this message (correct callsign?)
@@ -1081,6 +1339,29 @@ namespace WPEFramework {
 			}
 
 		private:
+			// Move the calls waiting for the window to open up to the ready list, in order. Calls that timed out
+			// while waiting, are left out.
+			void Release(std::list<Core::ProxyType<Core::JSONRPC::Message>>& ready)
+			{
+				while ((_inflight < _window) && (_waiting.empty() == false)) {
+					typename PendingMap::iterator index = _pendingQueue.find(_waiting.front()->Id.Value());
+
+					if (index != _pendingQueue.end()) {
+						index->second.Submitted();
+						_inflight++;
+						ready.push_back(_waiting.front());
+					}
+
+					_waiting.pop_front();
+				}
+			}
+			void Submit(std::list<Core::ProxyType<Core::JSONRPC::Message>>& ready)
+			{
+				for (Core::ProxyType<Core::JSONRPC::Message>& message : ready) {
+					_channel->Submit(Core::ProxyType<INTERFACE>(message));
+				}
+				ready.clear();
+			}
 			void ToMessage(const string& parameters, Core::ProxyType<Core::JSONRPC::Message>& message) const
 			{
 				if (parameters.empty() != true) {
@@ -1133,6 +1414,10 @@ namespace WPEFramework {
 			PendingMap _pendingQueue;
 			uint64_t _scheduledTime;
 			string _versionstring;
+			TimeoutWheel _timeouts;
+			std::list<Core::ProxyType<Core::JSONRPC::Message>> _waiting;
+			uint16_t _window;
+			uint16_t _inflight;
 		};
 
 		// This is for backward compatibility. Please use the template and not the typedef below!!!
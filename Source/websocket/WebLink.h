@@ -198,6 +198,11 @@ namespace Web {
                 _activity = true;
                 return (_parent.SendData( dataFrame, maxSendSize));
             }
+            uint16_t GatherData(uint8_t* dataFrame, const uint16_t maxSendSize, Core::SocketPort::Segment segments[], uint8_t& count) override
+            {
+                _activity = true;
+                return (_parent.GatherData(dataFrame, maxSendSize, segments, count));
+            }
             uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
             {
                 _activity = true;
@@ -351,6 +356,27 @@ POP_WARNING()
             return (_serializerImpl.Serialize(dataFrame, receivedSize));
         }
 
+        // A transformer needs to see all that is sent, only without one the body can be gathered.
+        template <typename CLASSNAME = TRANSFORM>
+        inline typename Core::TypeTraits::enable_if<hasTransform<CLASSNAME, uint16_t, BaseSerializer&, uint8_t*, const uint16_t>::value, uint16_t>::type
+        GatherData(uint8_t* dataFrame, const uint16_t maxSendSize, Core::SocketPort::Segment[] /* segments */, uint8_t& count)
+        {
+            count = 0;
+            return (_transformer.Transform(_serializerImpl, dataFrame, maxSendSize));
+        }
+
+        template <typename CLASSNAME = TRANSFORM>
+        inline typename Core::TypeTraits::enable_if<!hasTransform<CLASSNAME, uint16_t, BaseSerializer&, uint8_t*, const uint16_t>::value, uint16_t>::type
+        GatherData(uint8_t* dataFrame, const uint16_t maxSendSize, Core::SocketPort::Segment segments[], uint8_t& count)
+        {
+            ASSERT(count >= 1);
+
+            uint16_t result = _serializerImpl.Serialize(dataFrame, maxSendSize, segments[0]);
+            count = (segments[0].Length != 0 ? 1 : 0);
+
+            return (result);
+        }
+
     private:
         SerializerImpl _serializerImpl;
         DeserializerImpl _deserialiserImpl;
@@ -97,6 +97,13 @@ namespace Web {
         // The Serialize and Deserialize methods allow the content to be serialized/deserialized.
         virtual uint16_t Serialize(uint8_t[] /* stream*/, const uint16_t /* maxLength */) const = 0;
         virtual uint16_t Deserialize(const uint8_t[] /* stream*/, const uint16_t /* maxLength */) = 0;
+
+        // If what is left to serialize is available in memory as is, it can be sent from there, in stead of being
+        // copied by the Serialize above. Returns nullptr if it is not.
+        virtual const uint8_t* Serialized() const
+        {
+            return (nullptr);
+        }
     };
 
     class EXTERNAL Signature {
@@ -309,6 +316,7 @@ namespace Web {
                 , _buffer(nullptr)
                 , _lock()
                 , _current()
+                , _segment(nullptr)
             {
             }
             virtual ~Serializer() = default;
@@ -341,6 +349,10 @@ namespace Web {
 
             uint16_t Serialize(uint8_t stream[], const uint16_t maxLength);
 
+            // As the above, but a body that is available in memory is not copied behind the header, it is handed out
+            // as a segment to send right after the stream. It remains valid until the next call to Serialize.
+            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, Core::SocketPort::Segment& body);
+
         private:
             uint16_t _state;
             uint16_t _offset;
@@ -350,6 +362,7 @@ namespace Web {
             const TCHAR* _buffer;
             Core::CriticalSection _lock;
             Request* _current;
+            Core::SocketPort::Segment* _segment;
         };
         class EXTERNAL Deserializer {
         private:
@@ -95,6 +95,7 @@ namespace Web {
             ALLOW,
             WEBSOCKET_ACCEPT,
             WEBSOCKET_PROTOCOL,
+            WEBSOCKET_EXTENSIONS,
             LOCATION,
             WAKEUP,
             U_S_N,
@@ -143,6 +144,7 @@ namespace Web {
                 , _buffer(nullptr)
                 , _lock()
                 , _current()
+                , _segment(nullptr)
             {
             }
             virtual ~Serializer() = default;
@@ -175,6 +177,10 @@ namespace Web {
 
             uint16_t Serialize(uint8_t stream[], const uint16_t maxLength);
 
+            // As the above, but a body that is available in memory is not copied behind the header, it is handed out
+            // as a segment to send right after the stream. It remains valid until the next call to Serialize.
+            uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, Core::SocketPort::Segment& body);
+
         private:
             uint16_t _state;
             uint16_t _offset;
@@ -184,6 +190,7 @@ namespace Web {
             const TCHAR* _buffer;
             Core::CriticalSection _lock;
             Response* _current;
+            Core::SocketPort::Segment* _segment;
         };
         class EXTERNAL Deserializer {
         private:
@@ -392,6 +399,8 @@ POP_WARNING()
             ContentLength.Clear();
             ContentEncoding.Clear();
             WebSocketAccept.Clear();
+            WebSocketProtocol.Clear();
+            WebSocketExtensions.Clear();
             AccessControlOrigin.Clear();
             AccessControlMethod.Clear();
             AccessControlHeaders.Clear();
@@ -440,6 +449,7 @@ POP_WARNING()
         Core::OptionalType<string> WakeUp;
         Core::OptionalType<string> ETag;
         Core::OptionalType<string> WebSocketProtocol;
+        Core::OptionalType<string> WebSocketExtensions;
         Core::OptionalType<string> CacheControl;
         Core::OptionalType<Core::URL> ApplicationURL;
 
@@ -71,6 +71,10 @@ namespace Web {
 
             return size;
         }
+        const uint8_t* Serialized() const override
+        {
+            return (&(reinterpret_cast<const uint8_t*>(string::c_str())[_lastPosition]));
+        }
         uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength) override
         {
             uint16_t index = 0;
@@ -357,6 +361,10 @@ namespace Web {
             }
             return size;
         }
+        const uint8_t* Serialized() const override
+        {
+            return (&(reinterpret_cast<const uint8_t*>(_body.c_str())[_lastPosition]));
+        }
         uint16_t Deserialize(const uint8_t stream[], const uint16_t maxLength) override
         {
             return static_cast<Core::JSON::IElement&>(*this).Deserialize(reinterpret_cast<const char*>(stream), maxLength, _offset);
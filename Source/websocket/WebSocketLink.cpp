@@ -19,6 +19,14 @@
 
 #include "WebSocketLink.h"
 
+#if defined(__GNUC__) && defined(__SSE2__)
+#include <emmintrin.h>
+#define __WEBSOCKET_MASK_SSE2__
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <arm_neon.h>
+#define __WEBSOCKET_MASK_NEON__
+#endif
+
 namespace WPEFramework {
 namespace Web {
     namespace WebSocket {
@@ -40,8 +48,128 @@ namespace Web {
         static const uint8_t TYPE_FRAME = 0x0F;
         static const uint8_t MASKING_FRAME = 0x80;
         static const uint8_t CONTROL_FRAME = 0x08;
+        static const uint8_t COMPRESSED_FRAME = 0x40;
         static const uint8_t HandShakeKey[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
 
+        namespace {
+
+            // The key is rotated such that its first byte applies to the first byte to mask, from there
+            // on, every block that starts at a multiple of 4 starts with the first byte of the key again.
+            inline void XorWord(uint8_t destination[], const uint8_t source[], const uint64_t key)
+            {
+                uint64_t word;
+
+                ::memcpy(&word, source, sizeof(word));
+                word ^= key;
+                ::memcpy(destination, &word, sizeof(word));
+            }
+
+#if defined(__WEBSOCKET_MASK_SSE2__)
+            typedef __m128i Block;
+
+            inline Block BlockKey(const uint32_t key)
+            {
+                return (_mm_set1_epi32(static_cast<int>(key)));
+            }
+            inline void XorBlock(uint8_t destination[], const uint8_t source[], const Block key)
+            {
+                // Load the whole block before storing, so overlapping ranges are handled properly.
+                const Block block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), _mm_xor_si128(block, key));
+            }
+#elif defined(__WEBSOCKET_MASK_NEON__)
+            typedef uint8x16_t Block;
+
+            inline Block BlockKey(const uint32_t key)
+            {
+                return (vreinterpretq_u8_u32(vdupq_n_u32(key)));
+            }
+            inline void XorBlock(uint8_t destination[], const uint8_t source[], const Block key)
+            {
+                const Block block = vld1q_u8(source);
+                vst1q_u8(destination, veorq_u8(block, key));
+            }
+#endif
+
+            void MaskForward(uint8_t destination[], const uint8_t source[], const uint32_t length, const uint8_t key[4])
+            {
+                uint32_t word32;
+                ::memcpy(&word32, key, sizeof(word32));
+                const uint64_t word64 = (static_cast<uint64_t>(word32) << 32) | word32;
+                uint32_t index = 0;
+
+#if defined(__WEBSOCKET_MASK_SSE2__) || defined(__WEBSOCKET_MASK_NEON__)
+                const Block block = BlockKey(word32);
+
+                while ((index + 16) <= length) {
+                    XorBlock(&(destination[index]), &(source[index]), block);
+                    index += 16;
+                }
+#endif
+                while ((index + 8) <= length) {
+                    XorWord(&(destination[index]), &(source[index]), word64);
+                    index += 8;
+                }
+                while (index < length) {
+                    destination[index] = source[index] ^ key[index & 0x3];
+                    index++;
+                }
+            }
+
+            // If the destination lies beyond the source, the bytes at the end have to be moved first.
+            void MaskBackward(uint8_t destination[], const uint8_t source[], const uint32_t length, const uint8_t key[4])
+            {
+                uint32_t word32;
+                ::memcpy(&word32, key, sizeof(word32));
+                const uint64_t word64 = (static_cast<uint64_t>(word32) << 32) | word32;
+                uint32_t index = length;
+
+                while ((index & 0x7) != 0) {
+                    index--;
+                    destination[index] = source[index] ^ key[index & 0x3];
+                }
+#if defined(__WEBSOCKET_MASK_SSE2__) || defined(__WEBSOCKET_MASK_NEON__)
+                const Block block = BlockKey(word32);
+
+                if ((index & 0xF) != 0) {
+                    index -= 8;
+                    XorWord(&(destination[index]), &(source[index]), word64);
+                }
+                while (index != 0) {
+                    index -= 16;
+                    XorBlock(&(destination[index]), &(source[index]), block);
+                }
+#else
+                while (index != 0) {
+                    index -= 8;
+                    XorWord(&(destination[index]), &(source[index]), word64);
+                }
+#endif
+            }
+        }
+
+        /* static */ void Protocol::Mask(uint8_t destination[], const uint8_t source[], const uint32_t length, const uint8_t key[4], const uint8_t offset)
+        {
+            const uint8_t rotated[4] = { key[offset & 0x3], key[(offset + 1) & 0x3], key[(offset + 2) & 0x3], key[(offset + 3) & 0x3] };
+
+            if (destination > source) {
+                MaskBackward(destination, source, length, rotated);
+            } else {
+                MaskForward(destination, source, length, rotated);
+            }
+        }
+
+        /* static */ const TCHAR* Protocol::MaskImplementation()
+        {
+#if defined(__WEBSOCKET_MASK_SSE2__)
+            return (_T("SSE2"));
+#elif defined(__WEBSOCKET_MASK_NEON__)
+            return (_T("NEON"));
+#else
+            return (_T("64 bits"));
+#endif
+        }
+
         std::string Protocol::RequestKey() const
         {
             string baseEncodedKey;
@@ -77,18 +205,18 @@ namespace Web {
  *  %xA denotes a pong
  *  %xB-F are reserved for further control frames
  */
-        uint16_t Protocol::Encoder(uint8_t* dataFrame, const uint16_t maxSendSize, const uint16_t usedSize)
+        uint32_t Protocol::Encoder(uint8_t* dataFrame, const uint32_t maxSendSize, const uint32_t usedSize)
         {
             uint32_t result = 0;
 
             if ((usedSize != 0) || (SendInProgress() == true)) {
-                result = (usedSize <= 125 ? 2 : 4);
+                result = (usedSize <= 125 ? 2 : (usedSize <= 0xFFFF ? 4 : 10));
 
                 if ((_setFlags & MASKING_FRAME) == 0) {
-                    // Only if this is a smallFrame, we need to "flush" 2 bytes..
-                    if ((result == 2) && (usedSize != 0)) {
+                    // Only if the header is not 4 bytes, we need to "flush" the payload..
+                    if ((result != 4) && (usedSize != 0)) {
                         // No masking, so just move and insert the header up front..
-                        ::memmove(&dataFrame[2], &(dataFrame[4]), usedSize);
+                        ::memmove(&dataFrame[result], &(dataFrame[4]), usedSize);
                     }
                 } else {
                     uint32_t value;
@@ -101,15 +229,7 @@ namespace Web {
                     maskKey[3] = (value >> 24) & 0xFF;
 
                     // Mask and insert the bytes on the right spots
-                    uint8_t* source = &dataFrame[usedSize - 1 + 4];
-                    uint8_t* destination = &dataFrame[usedSize - 1 + 4 + result];
-                    uint32_t bytesToMove = usedSize;
-
-                    while (bytesToMove != 0) {
-                        bytesToMove--;
-                        *destination-- = (*source ^ maskKey[(bytesToMove & 0x3)]);
-                        source--;
-                    }
+                    Mask(&dataFrame[4 + result], &dataFrame[4], usedSize, maskKey, 0);
 
                     // Now there is space again, write down the encryption key.
                     ::memcpy(&dataFrame[result], &maskKey, 4);
@@ -117,21 +237,31 @@ namespace Web {
                 }
 
                 if (usedSize <= 125) {
-                    dataFrame[1] = ((_setFlags & MASKING_FRAME) | usedSize);
-                } else {
-                    // We only allows uin1t 16 so no need to go beyond two bytes..
+                    dataFrame[1] = static_cast<uint8_t>((_setFlags & MASKING_FRAME) | usedSize);
+                } else if (usedSize <= 0xFFFF) {
                     dataFrame[1] = ((_setFlags & MASKING_FRAME) | 126);
-                    dataFrame[2] = (usedSize >> 8);
-                    dataFrame[3] = (usedSize & 0xFF);
+                    dataFrame[2] = static_cast<uint8_t>(usedSize >> 8);
+                    dataFrame[3] = static_cast<uint8_t>(usedSize & 0xFF);
+                } else {
+                    // The 64 bits extended length, in network byte order. We never go beyond 32 bits.
+                    dataFrame[1] = ((_setFlags & MASKING_FRAME) | 127);
+                    dataFrame[2] = 0;
+                    dataFrame[3] = 0;
+                    dataFrame[4] = 0;
+                    dataFrame[5] = 0;
+                    dataFrame[6] = static_cast<uint8_t>(usedSize >> 24);
+                    dataFrame[7] = static_cast<uint8_t>((usedSize >> 16) & 0xFF);
+                    dataFrame[8] = static_cast<uint8_t>((usedSize >> 8) & 0xFF);
+                    dataFrame[9] = static_cast<uint8_t>(usedSize & 0xFF);
                 }
 
                 if (usedSize < maxSendSize) {
                     // Seems like not all available space is used, so I guess we are ready..
-                    dataFrame[0] = FINISHING_FRAME | (SendInProgress() == true ? CONTINUATION_FRAME : TYPE_FRAME & _setFlags);
+                    dataFrame[0] = FINISHING_FRAME | (SendInProgress() == true ? CONTINUATION_FRAME : (COMPRESSED_FRAME | TYPE_FRAME) & _setFlags);
                     _progressInfo &= (~0x40);
                 } else {
                     // There is more to come, this is just part of a bigger picture
-                    dataFrame[0] = (SendInProgress() == true ? CONTINUATION_FRAME : TYPE_FRAME & _setFlags);
+                    dataFrame[0] = (SendInProgress() == true ? CONTINUATION_FRAME : (COMPRESSED_FRAME | TYPE_FRAME) & _setFlags);
                     _progressInfo |= (0x40);
                 }
 
@@ -159,7 +289,7 @@ namespace Web {
             return (result);
         }
 
-        uint16_t Protocol::Decoder(uint8_t* dataFrame, uint16_t& receivedSize)
+        uint16_t Protocol::Decoder(uint8_t* dataFrame, uint32_t& receivedSize)
         {
             uint16_t actualHeader = 0;
 
@@ -172,20 +302,18 @@ namespace Web {
                     uint8_t* source = dataFrame;
 
                     if (_pendingReceiveBytes < receivedSize) {
-                        receivedSize = _pendingReceiveBytes;
+                        receivedSize = static_cast<uint32_t>(_pendingReceiveBytes);
                     }
 
-                    for (uint16_t tmp = receivedSize; _pendingReceiveBytes != 0 && tmp != 0; --tmp) {
-                        *source = (*source ^ _scrambleKey[(_progressInfo & 0x3)]);
-                        source++;
-                        _progressInfo = ((_progressInfo + 1) & 0x03) | (_progressInfo & 0xFC);
-                        _pendingReceiveBytes--;
-                    }
+                    Mask(source, source, receivedSize, _scrambleKey, (_progressInfo & 0x3));
+
+                    _progressInfo = static_cast<uint8_t>(((_progressInfo + receivedSize) & 0x03) | (_progressInfo & 0xFC));
+                    _pendingReceiveBytes -= receivedSize;
                 } else {
                     if (_pendingReceiveBytes > receivedSize) {
                         _pendingReceiveBytes -= receivedSize;
                     } else {
-                        receivedSize = _pendingReceiveBytes;
+                        receivedSize = static_cast<uint32_t>(_pendingReceiveBytes);
                         _pendingReceiveBytes = 0;
                     }
                 }
@@ -206,6 +334,11 @@ namespace Web {
                 } else {
                     _frameType = static_cast<frameType>(dataFrame[0] & TYPE_FRAME);
 
+                    // The first frame of a message tells if the message is compressed (RSV1).
+                    if ((_frameType != 0) && ((_frameType & CONTROL_FRAME) == 0)) {
+                        _progressInfo = ((dataFrame[0] & COMPRESSED_FRAME) != 0 ? (_progressInfo | 0x10) : (_progressInfo & (~0x10)));
+                    }
+
                     // Continuation frame is only allowed if a receive is in progress...
                     if (ReceiveInProgress() == true) {
                         if (_frameType == 0) {
@@ -236,13 +369,16 @@ namespace Web {
                         if (bytesToMove == 126) {
                             bytesToMove = ((dataFrame[2] << 8) + dataFrame[3]);
                         } else if (bytesToMove == 127) {
-                            bytesToMove = dataFrame[9];
-                            for (int i=8; i>=2; i--) bytesToMove = (bytesToMove << 8) + dataFrame[i];
+                            // The 64 bits extended length is in network byte order as well.
+                            bytesToMove = 0;
+                            for (uint8_t index = 2; index < 10; index++) {
+                                bytesToMove = (bytesToMove << 8) | dataFrame[index];
+                            }
                         }
 
-                        // We might not have the full body yet...
+                        // We might not have the full body yet, the rest will be handed over as it comes in.
                         if ((actualHeader + bytesToMove) > receivedSize) {
-                            _pendingReceiveBytes = static_cast<uint32_t>(actualHeader + bytesToMove - receivedSize);
+                            _pendingReceiveBytes = (actualHeader + bytesToMove - receivedSize);
                             bytesToMove = receivedSize - actualHeader;
                             _progressInfo &= (~0x20);
                         }
@@ -261,13 +397,12 @@ namespace Web {
                             _progressInfo |= 0x20;
                             _progressInfo &= (~0x03);
 
-                            uint8_t* source = &dataFrame[actualHeader];
+                            if (bytesToMove != 0) {
+                                uint8_t* source = &dataFrame[actualHeader];
+
+                                Mask(source, source, static_cast<uint32_t>(bytesToMove), _scrambleKey, 0);
 
-                            while (bytesToMove != 0) {
-                                *source = (*source ^ _scrambleKey[(_progressInfo & 0x3)]);
-                                source++;
-                                bytesToMove--;
-                                _progressInfo = ((_progressInfo + 1) & 0xF3);
+                                _progressInfo = static_cast<uint8_t>((_progressInfo & 0xF0) | (bytesToMove & 0x03));
                             }
                         }
                     }
@@ -276,6 +411,324 @@ namespace Web {
 
             return (actualHeader);
         }
+
+        namespace {
+
+            const TCHAR PerMessageDeflate[] = _T("permessage-deflate");
+            const uint8_t DeflateTrailer[] = { 0x00, 0x00, 0xFF, 0xFF };
+
+            inline string Trim(const string& text)
+            {
+                const size_t begin = text.find_first_not_of(_T(" \t"));
+                const size_t end = text.find_last_not_of(_T(" \t"));
+
+                return (begin == string::npos ? string() : text.substr(begin, end - begin + 1));
+            }
+
+            // Split an extension (or a list of them) on the given delimiter, trimmed.
+            inline std::list<string> Split(const string& text, const TCHAR delimiter)
+            {
+                std::list<string> result;
+                size_t begin = 0;
+
+                while (begin <= text.length()) {
+                    size_t end = text.find(delimiter, begin);
+
+                    if (end == string::npos) {
+                        end = text.length();
+                    }
+
+                    result.push_back(Trim(text.substr(begin, end - begin)));
+                    begin = end + 1;
+                }
+
+                return (result);
+            }
+
+            // The window bits of a parameter, 0 if it has no value, ~0 if it is not valid.
+            inline uint8_t WindowBits(const string& value)
+            {
+                uint8_t result = static_cast<uint8_t>(~0);
+                string number(value);
+
+                if ((number.length() >= 2) && (number[0] == '\"') && (number[number.length() - 1] == '\"')) {
+                    number = number.substr(1, number.length() - 2);
+                }
+
+                if (number.empty() == true) {
+                    result = 0;
+                } else if ((number.length() <= 2) && (number.find_first_not_of(_T("0123456789")) == string::npos)) {
+                    const uint8_t bits = static_cast<uint8_t>(std::stoul(number));
+
+                    if ((bits >= 8) && (bits <= 15)) {
+                        result = bits;
+                    }
+                }
+
+                return (result);
+            }
+        }
+
+        Deflate::Deflate()
+            : _deflate()
+            , _inflate()
+            , _enabled(false)
+            , _sendTakeover(true)
+            , _receiveTakeover(true)
+            , _sendBits(MAX_WBITS)
+            , _tailSize(0)
+            , _trailerSize(0)
+            , _ended(false)
+        {
+            ::memset(&_deflate, 0, sizeof(_deflate));
+            ::memset(&_inflate, 0, sizeof(_inflate));
+        }
+
+        Deflate::~Deflate()
+        {
+            Disable();
+        }
+
+        /* static */ string Deflate::Offer()
+        {
+            // We can handle any window the server likes to use, and let the server limit ours.
+            return (string(PerMessageDeflate) + _T("; client_max_window_bits"));
+        }
+
+        bool Deflate::Accept(const string& offers, string& response)
+        {
+            bool accepted = false;
+            std::list<string> extensions(Split(offers, ','));
+            std::list<string>::const_iterator index(extensions.begin());
+
+            Disable();
+
+            while ((accepted == false) && (index != extensions.end())) {
+                std::list<string> parameters(Split(*index, ';'));
+
+                if (parameters.front() == PerMessageDeflate) {
+                    bool valid = true;
+                    bool sendTakeover = true;
+                    bool receiveTakeover = true;
+                    uint8_t sendBits = MAX_WBITS;
+                    string agreed(PerMessageDeflate);
+
+                    parameters.pop_front();
+
+                    for (const string& parameter : parameters) {
+                        const size_t equal = parameter.find('=');
+                        const string name(Trim(parameter.substr(0, equal)));
+                        const uint8_t bits = (equal == string::npos ? 0 : WindowBits(Trim(parameter.substr(equal + 1))));
+
+                        if ((name == _T("server_no_context_takeover")) && (equal == string::npos)) {
+                            sendTakeover = false;
+                            agreed += _T("; server_no_context_takeover");
+                        } else if ((name == _T("client_no_context_takeover")) && (equal == string::npos)) {
+                            receiveTakeover = false;
+                            agreed += _T("; client_no_context_takeover");
+                        } else if ((name == _T("server_max_window_bits")) && (bits != 0) && (bits != static_cast<uint8_t>(~0))) {
+                            // zlib can not produce a raw deflate stream with a window of 8 bits, skip such an offer.
+                            valid = valid && (bits > 8);
+                            sendBits = bits;
+                            agreed += _T("; server_max_window_bits=") + Core::NumberType<uint8_t>(bits).Text();
+                        } else if ((name == _T("client_max_window_bits")) && (bits != static_cast<uint8_t>(~0))) {
+                            // We always inflate with the largest window, so whatever the client uses will do.
+                        } else {
+                            valid = false;
+                        }
+                    }
+
+                    if (valid == true) {
+                        accepted = Enable(sendTakeover, receiveTakeover, sendBits);
+                        response = agreed;
+                    }
+                }
+
+                index++;
+            }
+
+            return (accepted);
+        }
+
+        bool Deflate::Agreed(const string& response)
+        {
+            bool valid = false;
+            std::list<string> extensions(Split(response, ','));
+
+            Disable();
+
+            if ((extensions.size() == 1) && (extensions.front().empty() == false)) {
+                std::list<string> parameters(Split(extensions.front(), ';'));
+
+                if (parameters.front() == PerMessageDeflate) {
+                    bool sendTakeover = true;
+                    bool receiveTakeover = true;
+                    uint8_t sendBits = MAX_WBITS;
+
+                    valid = true;
+                    parameters.pop_front();
+
+                    for (const string& parameter : parameters) {
+                        const size_t equal = parameter.find('=');
+                        const string name(Trim(parameter.substr(0, equal)));
+                        const uint8_t bits = (equal == string::npos ? 0 : WindowBits(Trim(parameter.substr(equal + 1))));
+
+                        if ((name == _T("server_no_context_takeover")) && (equal == string::npos)) {
+                            receiveTakeover = false;
+                        } else if ((name == _T("client_no_context_takeover")) && (equal == string::npos)) {
+                            sendTakeover = false;
+                        } else if ((name == _T("server_max_window_bits")) && (bits != 0) && (bits != static_cast<uint8_t>(~0))) {
+                            // We always inflate with the largest window.
+                        } else if ((name == _T("client_max_window_bits")) && (bits > 8) && (bits != static_cast<uint8_t>(~0))) {
+                            sendBits = bits;
+                        } else {
+                            valid = false;
+                        }
+                    }
+
+                    valid = valid && Enable(sendTakeover, receiveTakeover, sendBits);
+                }
+            }
+
+            if (valid == false) {
+                TRACE_L1("WebSocket extensions not accepted: %s", response.c_str());
+            }
+
+            return (valid);
+        }
+
+        void Deflate::Disable()
+        {
+            if (_enabled == true) {
+                deflateEnd(&_deflate);
+                inflateEnd(&_inflate);
+                ::memset(&_deflate, 0, sizeof(_deflate));
+                ::memset(&_inflate, 0, sizeof(_inflate));
+                _enabled = false;
+            }
+
+            _tailSize = 0;
+            _trailerSize = 0;
+            _ended = false;
+        }
+
+        bool Deflate::Enable(const bool sendTakeover, const bool receiveTakeover, const uint8_t sendBits)
+        {
+            ASSERT(_enabled == false);
+
+            // Negative window bits select the raw deflate format, without a zlib header or trailer.
+            if (deflateInit2(&_deflate, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -sendBits, 8, Z_DEFAULT_STRATEGY) == Z_OK) {
+                if (inflateInit2(&_inflate, -MAX_WBITS) == Z_OK) {
+                    _enabled = true;
+                    _sendTakeover = sendTakeover;
+                    _receiveTakeover = receiveTakeover;
+                    _sendBits = sendBits;
+                } else {
+                    deflateEnd(&_deflate);
+                }
+            }
+
+            return (_enabled);
+        }
+
+        uint32_t Deflate::Compress(const uint8_t input[], uint32_t& length, uint8_t output[], const uint32_t room, const bool last, bool& completed)
+        {
+            uint32_t produced = _tailSize;
+
+            ASSERT(_enabled == true);
+            ASSERT(room > sizeof(_tail));
+
+            // What was held back from the previous frame goes first.
+            ::memcpy(output, _tail, _tailSize);
+            _tailSize = 0;
+
+            _deflate.next_in = const_cast<uint8_t*>(input);
+            _deflate.avail_in = length;
+            _deflate.next_out = &output[produced];
+            _deflate.avail_out = room - produced;
+
+            deflate(&_deflate, (last == true ? Z_SYNC_FLUSH : Z_NO_FLUSH));
+
+            length -= _deflate.avail_in;
+            produced = room - _deflate.avail_out;
+            completed = ((last == true) && (_deflate.avail_in == 0) && (_deflate.avail_out != 0));
+
+            if (completed == true) {
+                if (produced == 0) {
+                    // An empty message right after a flush gives nothing at all, send an empty stored block (RFC 7692, 7.2.3.6).
+                    output[0] = 0x00;
+                    produced = 1;
+                } else {
+                    // The flush ends with an empty stored block, 0x00 0x00 0xFF 0xFF, which is not sent.
+                    ASSERT(produced >= sizeof(DeflateTrailer));
+                    ASSERT(::memcmp(&output[produced - sizeof(DeflateTrailer)], DeflateTrailer, sizeof(DeflateTrailer)) == 0);
+
+                    produced -= sizeof(DeflateTrailer);
+                }
+
+                if (_sendTakeover == false) {
+                    deflateReset(&_deflate);
+                }
+            } else {
+                // Hold back the last bytes, if this turns out to be the end, they are the ones to strip.
+                _tailSize = static_cast<uint8_t>(std::min(produced, static_cast<uint32_t>(sizeof(_tail))));
+                produced -= _tailSize;
+                ::memcpy(_tail, &output[produced], _tailSize);
+            }
+
+            return (produced);
+        }
+
+        uint32_t Deflate::Decompress(const uint8_t input[], uint32_t& length, uint8_t output[], const uint32_t room, const bool last, bool& completed)
+        {
+            int result = Z_OK;
+
+            ASSERT(_enabled == true);
+
+            _inflate.next_in = const_cast<uint8_t*>(input);
+            _inflate.avail_in = length;
+            _inflate.next_out = output;
+            _inflate.avail_out = room;
+
+            // If the sender closed the deflate stream in this message (or it is corrupt), skip what follows.
+            if (_ended == false) {
+                result = inflate(&_inflate, Z_SYNC_FLUSH);
+
+                // Once the end of the message is in, put back the trailer the sender left out.
+                if ((last == true) && (_inflate.avail_in == 0) && (_inflate.avail_out != 0) && (result != Z_STREAM_END) && ((result == Z_OK) || (result == Z_BUF_ERROR))) {
+                    _inflate.next_in = const_cast<uint8_t*>(&DeflateTrailer[_trailerSize]);
+                    _inflate.avail_in = sizeof(DeflateTrailer) - _trailerSize;
+
+                    result = inflate(&_inflate, Z_SYNC_FLUSH);
+
+                    _trailerSize = static_cast<uint8_t>(sizeof(DeflateTrailer) - _inflate.avail_in);
+                    _inflate.avail_in = 0;
+                }
+            }
+
+            if ((result != Z_OK) && (result != Z_BUF_ERROR)) {
+                if (result != Z_STREAM_END) {
+                    TRACE_L1("Inflating a WebSocket message failed: %d", result);
+                }
+                _ended = true;
+            }
+            if (_ended == true) {
+                _inflate.avail_in = 0;
+            }
+
+            length -= _inflate.avail_in;
+            completed = ((_inflate.avail_in == 0) && ((_inflate.avail_out != 0) || (_ended == true)) && ((last == false) || (_ended == true) || (_trailerSize == sizeof(DeflateTrailer))));
+
+            if ((completed == true) && (last == true)) {
+                if ((_receiveTakeover == false) || (_ended == true)) {
+                    inflateReset(&_inflate);
+                }
+                _trailerSize = 0;
+                _ended = false;
+            }
+
+            return (room - _inflate.avail_out);
+        }
     }
 }
 }
@@ -37,7 +37,7 @@ namespace Web {
                 PING = 0x09,
                 PONG = 0x0A,
                 VIOLATION = 0x10, // e.g. a control package without a FIN flag
-                TOO_BIG = 0x20, // Protocol max support for 2^16 message per chunk
+                TOO_BIG = 0x20, // Frame exceeds what can be handled
                 INCONSISTENT = 0x30 // e.g. Protocol defined as Text, but received a binary.
             };
 
@@ -119,19 +119,99 @@ namespace Web {
             {
                 return ((_setFlags & 0x80) != 0);
             }
+            // Mark outgoing messages as compressed (RSV1 on their first frame), the payload is compressed by the caller.
+            inline void Compression(const bool compressed)
+            {
+                _setFlags = (compressed ? (_setFlags | 0x40) : (_setFlags & 0xBF));
+            }
+            inline bool Compression() const
+            {
+                return ((_setFlags & 0x40) != 0);
+            }
+            // The message currently received is compressed (RSV1 on its first frame).
+            inline bool IsCompressed() const
+            {
+                return ((_progressInfo & 0x10) != 0);
+            }
+
+            // The payload to frame is expected at dataFrame[4]. Payloads up to 64K fit a header of at most 8 bytes,
+            // beyond that the 64 bits extended length is used and the header grows to at most 14 bytes, so the
+            // buffer must hold usedSize + 14 bytes.
+            uint32_t Encoder(uint8_t* dataFrame, const uint32_t maxSendSize, const uint32_t usedSize);
+
+            // Returns the size of the frame header found, receivedSize returns the (unmasked) payload bytes that
+            // follow it in this buffer. Payloads larger than the buffer are handed over piece by piece, in place, as
+            // they are received, without being gathered first.
+            uint16_t Decoder(uint8_t* dataFrame, uint32_t& receivedSize);
 
-            uint16_t Encoder(uint8_t* dataFrame, const uint16_t maxSendSize, const uint16_t usedSize);
-            uint16_t Decoder(uint8_t* dataFrame, uint16_t& receivedSize);
+            // XOR the payload bytes in source with the masking key, into destination. The first byte of
+            // source is masked with key[offset & 0x3]. Like memmove, source and destination may overlap.
+            // Masking is done 16 bytes at a time with SSE2 or NEON where available, 8 bytes otherwise.
+            static void Mask(uint8_t destination[], const uint8_t source[], const uint32_t length, const uint8_t key[4], const uint8_t offset);
+
+            // The instruction set the masking is done with.
+            static const TCHAR* MaskImplementation();
 
         private:
             uint8_t _setFlags;
             uint8_t _progressInfo;
-            uint32_t _pendingReceiveBytes;
+            uint64_t _pendingReceiveBytes;
             frameType _frameType;
             uint8_t _scrambleKey[4];
             uint8_t _controlStatus;
         };
 
+        // The permessage-deflate extension (RFC 7692): negotiation of its parameters during the upgrade and the
+        // (de)compression of message payloads. The z_streams live as long as the connection, with context takeover
+        // they are not reset between messages, so a message can refer back to the ones before it.
+        class EXTERNAL Deflate {
+        public:
+            Deflate(const Deflate&) = delete;
+            Deflate& operator=(const Deflate&) = delete;
+
+            Deflate();
+            ~Deflate();
+
+        public:
+            inline bool IsEnabled() const
+            {
+                return (_enabled);
+            }
+
+            // Client side, the extension to offer in the upgrade request.
+            static string Offer();
+            // Client side, process the extension the server responded with. Returns true if compression is agreed.
+            bool Agreed(const string& response);
+            // Server side, take the first acceptable offer of the client. Returns true, and the response to send, if
+            // compression is agreed.
+            bool Accept(const string& offers, string& response);
+            void Disable();
+
+            // Compress input of a message into output, length returns the bytes of input consumed. Call with last set
+            // for the final input of the message, until completed is set; only then all output of the message is out.
+            // Output might be held back until there is more of it, so it can return 0 while not completed.
+            uint32_t Compress(const uint8_t input[], uint32_t& length, uint8_t output[], const uint32_t room, const bool last, bool& completed);
+
+            // Decompress the payload of a message into output, length returns the bytes of input consumed. Call until
+            // completed is set, last is set for the final payload of the message.
+            uint32_t Decompress(const uint8_t input[], uint32_t& length, uint8_t output[], const uint32_t room, const bool last, bool& completed);
+
+        private:
+            bool Enable(const bool sendTakeover, const bool receiveTakeover, const uint8_t sendBits);
+
+        private:
+            z_stream _deflate;
+            z_stream _inflate;
+            bool _enabled;
+            bool _sendTakeover;
+            bool _receiveTakeover;
+            uint8_t _sendBits;
+            uint8_t _tail[4];
+            uint8_t _tailSize;
+            uint8_t _trailerSize;
+            bool _ended;
+        };
+
         class EXTERNAL RequestAllocator : public Core::ProxyPoolType<Web::Request> {
         private:
             RequestAllocator(const RequestAllocator&) = delete;
@@ -236,6 +316,10 @@ namespace Web {
                 {
                     return (OUTBOUND::Serializer::Serialize(stream, maxLength));
                 }
+                inline uint16_t Serialize(uint8_t stream[], const uint16_t maxLength, Core::SocketPort::Segment& body)
+                {
+                    return (OUTBOUND::Serializer::Serialize(stream, maxLength, body));
+                }
                 void Flush()
                 {
                     _adminLock.Lock();
@@ -377,6 +461,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2>
@@ -394,6 +486,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3>
@@ -411,6 +511,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3, typename Arg4>
@@ -428,6 +536,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3, typename Arg4, typename Arg5>
@@ -445,6 +561,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3, typename Arg4, typename Arg5, typename Arg6>
@@ -462,6 +586,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3, typename Arg4, typename Arg5, typename Arg6, typename Arg7>
@@ -479,6 +611,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1>
@@ -496,6 +636,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2>
@@ -513,6 +661,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3>
@@ -530,6 +686,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3, typename Arg4>
@@ -547,6 +711,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3, typename Arg4, typename Arg5>
@@ -564,6 +736,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3, typename Arg4, typename Arg5, typename Arg6, typename Arg7>
@@ -581,6 +761,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
             template <typename Arg1, typename Arg2, typename Arg3, typename Arg4, typename Arg5, typename Arg6, typename Arg7>
@@ -598,6 +786,14 @@ PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
                 , _origin()
                 , _webSocketMessage(Core::ProxyType<typename OUTBOUND::BaseElement>::Create())
                 , _pingFireTime(0)
+                , _deflate()
+                , _compression(false)
+                , _plain()
+                , _plainOffset(0)
+                , _plainLength(0)
+                , _plainLast(false)
+                , _plainActive(false)
+                , _inflated()
             {
             }
 POP_WARNING()
@@ -680,6 +876,20 @@ POP_WARNING()
             {
                 return (_handler.Masking());
             }
+            // Offer (client) or accept (server) permessage-deflate on the next upgrade.
+            inline void Compression(const bool enabled)
+            {
+                _compression = enabled;
+            }
+            inline bool Compression() const
+            {
+                return (_compression);
+            }
+            // permessage-deflate was agreed on in the upgrade.
+            inline bool IsCompressed() const
+            {
+                return (_deflate.IsEnabled());
+            }
             inline bool Upgrade(const string& protocol, const string& path)
             {
                 string empty;
@@ -744,10 +954,14 @@ POP_WARNING()
                 _state = static_cast<EnumlinkState>(_state | ACTIVITY);
 
                 if ((_state & WEBSOCKET) != 0) {
-                    if (maxSendSize > 4) {
+                    if (_deflate.IsEnabled() == true) {
+                        if (maxSendSize > 16) {
+                            result = SendCompressed(dataFrame, maxSendSize);
+                        }
+                    } else if (maxSendSize > 4) {
                         result = _parent.SendData(&(dataFrame[4]), (maxSendSize - 4));
 
-                        result = _handler.Encoder(dataFrame, (maxSendSize - 4), result);
+                        result = static_cast<uint16_t>(_handler.Encoder(dataFrame, (maxSendSize - 4), result));
                     }
                 } else {
                     result = _serializerImpl.Serialize(dataFrame, maxSendSize);
@@ -761,6 +975,35 @@ POP_WARNING()
 
                 return (result);
             }
+            virtual uint16_t GatherData(uint8_t* dataFrame, const uint16_t maxSendSize, Core::SocketPort::Segment segments[], uint8_t& count)
+            {
+                uint16_t result;
+
+                _adminLock.Lock();
+
+                if ((_state & WEBSOCKET) != 0) {
+                    // Frames are composed (and masked or compressed) in the send buffer, nothing to gather.
+                    count = 0;
+                    result = SendData(dataFrame, maxSendSize);
+
+                    _adminLock.Unlock();
+                } else {
+                    ASSERT(count >= 1);
+
+                    _state = static_cast<EnumlinkState>(_state | ACTIVITY);
+
+                    result = _serializerImpl.Serialize(dataFrame, maxSendSize, segments[0]);
+                    count = (segments[0].Length != 0 ? 1 : 0);
+
+                    _adminLock.Unlock();
+
+                    if ((result == 0) && (count == 0)) {
+                        CheckForClose(0);
+                    }
+                }
+
+                return (result);
+            }
             virtual uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize)
             {
                 uint16_t result = 0;
@@ -774,9 +1017,8 @@ POP_WARNING()
 
                     // check for multiple messages if available...
                     while ((result < receivedSize) && (tooSmall == false)) {
-                        uint16_t actualDataSize = receivedSize - result;
+                        uint32_t actualDataSize = receivedSize - result;
                         uint16_t headerSize = _handler.Decoder(const_cast<uint8_t*>(&dataFrame[result]), actualDataSize);
-                        uint64_t payloadSizeInControlFrame;
 
                         tooSmall = ((headerSize == 0) && (actualDataSize == 0));
 
@@ -820,34 +1062,18 @@ POP_WARNING()
                                     _commandData.clear();
                                 }
 
-                                payloadSizeInControlFrame = 0;
-                                // skip payload bytes for control frames:
-                                if (headerSize > 1) {
-                                   payloadSizeInControlFrame = dataFrame[result+1] & 0x7F;
-                                   if (payloadSizeInControlFrame == 126) {
-				       if (headerSize > 3) {
-                                         payloadSizeInControlFrame = ((dataFrame[result+2] << 8) + dataFrame[result+3]);
-				       } else {
-                                         TRACE_L1("Header too small for 16-bit extended payload size");
-                                         payloadSizeInControlFrame = 0;
-                                      }
-                                   } else if (payloadSizeInControlFrame == 127) {
-                                      if (headerSize > 9) {
-                                         payloadSizeInControlFrame = dataFrame[result+9];
-                                         for (int i=8; i>=2; i--) payloadSizeInControlFrame = (payloadSizeInControlFrame << 8) + dataFrame[result+i];
-                                      } else {
-                                         TRACE_L1("Header too small for 64-bit jumbo payload size ");
-                                         payloadSizeInControlFrame = 0;
-                                      }
-                                   }
-                                }
+                                // Skip the payload of the control frame, as far as it is in this buffer.
+                                result += static_cast<uint16_t>(headerSize + actualDataSize);
 
-                                result += static_cast<uint16_t>(headerSize + payloadSizeInControlFrame); // actualDataSize
+                            } else if ((_handler.IsCompressed() == true) && (_deflate.IsEnabled() == true)) {
+                                ReceiveCompressed(&(dataFrame[result + headerSize]), actualDataSize, ((_handler.ReceiveInProgress() == false) && (_handler.IsCompleteMessage() == true)));
 
+                                result += static_cast<uint16_t>(headerSize + actualDataSize);
                             } else {
-                                _parent.ReceiveData(&(dataFrame[result + headerSize]), actualDataSize);
+                                // The payload is unmasked in place, hand it over as is, also if it is only part of a frame.
+                                _parent.ReceiveData(&(dataFrame[result + headerSize]), static_cast<uint16_t>(actualDataSize));
 
-                                result += (headerSize + actualDataSize);
+                                result += static_cast<uint16_t>(headerSize + actualDataSize);
                             }
                         }
                     }
@@ -890,6 +1116,74 @@ POP_WARNING()
             }
 
         private:
+            uint16_t SendCompressed(uint8_t* dataFrame, const uint16_t maxSendSize)
+            {
+                // The payload starts at dataFrame[4], keep room for the masking key in front of it as well.
+                const uint32_t room = maxSendSize - 8;
+                uint32_t used = 0;
+                bool completed = false;
+                bool idle = false;
+
+                if (_plain.size() != maxSendSize) {
+                    ASSERT(_plainActive == false);
+                    _plain.resize(maxSendSize);
+                }
+
+                do {
+                    if ((_plainOffset == _plainLength) && (_plainLast == false)) {
+                        _plainLength = _parent.SendData(_plain.data(), maxSendSize);
+                        _plainOffset = 0;
+                        _plainLast = (_plainLength < maxSendSize);
+                        idle = ((_plainLength == 0) && (_plainActive == false));
+                        _plainActive = (idle == false);
+                    }
+                    if (idle == false) {
+                        uint32_t length = (_plainLength - _plainOffset);
+
+                        used = _deflate.Compress(&(_plain[_plainOffset]), length, &(dataFrame[4]), room, _plainLast, completed);
+
+                        _plainOffset += static_cast<uint16_t>(length);
+                    }
+                } while ((idle == false) && (used == 0) && (completed == false));
+
+                if (idle == true) {
+                    // Nothing to send, but there might be control frames to send.
+                    _plainLast = false;
+                    used = _handler.Encoder(dataFrame, room, 0);
+                } else {
+                    if (completed == true) {
+                        _plainOffset = 0;
+                        _plainLength = 0;
+                        _plainLast = false;
+                        _plainActive = false;
+                    }
+
+                    // The encoder finishes the message if not all room is used.
+                    used = _handler.Encoder(dataFrame, (completed == true ? used + 1 : used), used);
+                }
+
+                return (static_cast<uint16_t>(used));
+            }
+            void ReceiveCompressed(const uint8_t payload[], const uint32_t length, const bool last)
+            {
+                uint32_t offset = 0;
+                bool completed = false;
+
+                if (_inflated.empty() == true) {
+                    _inflated.resize(4096);
+                }
+
+                do {
+                    uint32_t size = (length - offset);
+                    const uint32_t produced = _deflate.Decompress(&(payload[offset]), size, _inflated.data(), static_cast<uint32_t>(_inflated.size()), last, completed);
+
+                    offset += size;
+
+                    if (produced != 0) {
+                        _parent.ReceiveData(_inflated.data(), static_cast<uint16_t>(produced));
+                    }
+                } while (completed == false);
+            }
             inline uint32_t CheckForClose(uint32_t waitTime)
             {
                 uint32_t result = 0;
@@ -985,6 +1279,15 @@ POP_WARNING()
                                 ASSERT(_protocol.Size() == 1);
                                 _webSocketMessage->WebSocketProtocol = _protocol.First();
                             }
+
+                            string extension;
+                            if ((_compression == true) && (element->WebSocketExtensions.IsSet() == true) && (_deflate.Accept(element->WebSocketExtensions.Value(), extension) == true)) {
+                                _webSocketMessage->WebSocketExtensions = extension;
+                            } else {
+                                _deflate.Disable();
+                                _webSocketMessage->WebSocketExtensions.Clear();
+                            }
+                            _handler.Compression(_deflate.IsEnabled());
                         }
                     }
 
@@ -1046,6 +1349,9 @@ POP_WARNING()
                     if (protocol.empty() == false) {
                         _webSocketMessage->WebSocketProtocol = Web::ProtocolsArray(protocol);
                     }
+                    if (_compression == true) {
+                        _webSocketMessage->WebSocketExtensions = WebSocket::Deflate::Offer();
+                    }
 
                     _query = query;
                     _path = path;
@@ -1059,6 +1365,20 @@ POP_WARNING()
 
                 return (result);
             }
+            inline bool AgreedExtensions(const Core::ProxyType<INBOUND>& element)
+            {
+                bool result = true;
+
+                if (element->WebSocketExtensions.IsSet() == false) {
+                    _deflate.Disable();
+                } else {
+                    result = ((_compression == true) && (_deflate.Agreed(element->WebSocketExtensions.Value()) == true));
+                }
+
+                _handler.Compression(_deflate.IsEnabled());
+
+                return (result);
+            }
             inline void UpgradeCompleted(const TemplateIntToType<0>& /* For compile time diffrentiation */)
             {
                 // We send out the request to upgrade. So what wait for the answer...
@@ -1069,16 +1389,21 @@ POP_WARNING()
                 if ((_webSocketMessage.IsValid() == true) && (element->ErrorCode == Web::STATUS_SWITCH_PROTOCOL) && (element->WebSocketAccept.Value() == _handler.ResponseKey(_webSocketMessage->WebSocketKey.Value()))) {
                     ASSERT((_state & UPGRADING) != 0);
 
-                    _adminLock.Lock();
+                    if (AgreedExtensions(element) == false) {
+                        // The server responded with an extension we can not handle, we have to fail the connection.
+                        Close(0);
+                    } else {
+                        _adminLock.Lock();
 
-                    // Seems like we succeeded, turn on the link..
-                    _state = static_cast<EnumlinkState>((_state & 0xF0) | WEBSOCKET);
+                        // Seems like we succeeded, turn on the link..
+                        _state = static_cast<EnumlinkState>((_state & 0xF0) | WEBSOCKET);
 
-                    _parent.StateChange();
+                        _parent.StateChange();
 
-                    _adminLock.Unlock();
+                        _adminLock.Unlock();
 
-                    ACTUALLINK::Trigger();
+                        ACTUALLINK::Trigger();
+                    }
                 } else if ((_webSocketMessage.IsValid() == true) && (element->ErrorCode == Web::STATUS_FORBIDDEN)) {
                     ASSERT((_state & UPGRADING) != 0);
 
@@ -1103,6 +1428,17 @@ POP_WARNING()
             string _commandData;
             Core::ProxyType<typename OUTBOUND::BaseElement> _webSocketMessage;
             uint64_t _pingFireTime;
+
+            // permessage-deflate, the plain message is staged before it is compressed into the frames, the
+            // inflated message is handed over in pieces of the inflate buffer.
+            WebSocket::Deflate _deflate;
+            bool _compression;
+            std::vector<uint8_t> _plain;
+            uint16_t _plainOffset;
+            uint16_t _plainLength;
+            bool _plainLast;
+            bool _plainActive;
+            std::vector<uint8_t> _inflated;
         };
 
     public:
@@ -1241,6 +1577,18 @@ POP_WARNING()
         {
             return (_channel.Masking());
         }
+        inline void Compression(const bool enabled)
+        {
+            _channel.Compression(enabled);
+        }
+        inline bool Compression() const
+        {
+            return (_channel.Compression());
+        }
+        inline bool IsCompressed() const
+        {
+            return (_channel.IsCompressed());
+        }
         inline void ResetActivity()
         {
             return (_channel.ResetActivity());
@@ -1558,6 +1906,18 @@ POP_WARNING()
         {
             return (_channel.Masking());
         }
+        inline void Compression(const bool enabled)
+        {
+            _channel.Compression(enabled);
+        }
+        inline bool Compression() const
+        {
+            return (_channel.Compression());
+        }
+        inline bool IsCompressed() const
+        {
+            return (_channel.IsCompressed());
+        }
         inline uint32_t Open(const uint32_t waitTime)
         {
             return (_channel.Open(waitTime));
@@ -1794,6 +2154,18 @@ POP_WARNING()
         {
             return (_channel.Masking());
         }
+        inline void Compression(const bool enabled)
+        {
+            _channel.Compression(enabled);
+        }
+        inline bool Compression() const
+        {
+            return (_channel.Compression());
+        }
+        inline bool IsCompressed() const
+        {
+            return (_channel.IsCompressed());
+        }
         inline uint32_t Open(const uint32_t waitTime)
         {
             return (_channel.Open(waitTime));
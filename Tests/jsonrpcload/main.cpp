@@ -0,0 +1,196 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Module.h"
+
+using namespace WPEFramework;
+
+namespace {
+
+    struct Options {
+        Options()
+            : Address(_T("127.0.0.1:80"))
+            , Callsign(_T("Controller.1"))
+            , Method(_T("subsystems"))
+            , Parameters()
+            , Calls(10000)
+            , Window(64)
+            , Timeout(5000)
+        {
+        }
+
+        string Address;
+        string Callsign;
+        string Method;
+        string Parameters;
+        uint32_t Calls;
+        uint16_t Window;
+        uint32_t Timeout;
+    };
+
+    bool ParseOptions(int argc, char** argv, Options& options)
+    {
+        int index = 1;
+        bool showHelp = false;
+
+        while ((index < argc) && (showHelp == false)) {
+
+            if ((index + 1) >= argc) {
+                showHelp = true;
+            } else if (strcmp(argv[index], "-a") == 0) {
+                options.Address = argv[++index];
+            } else if (strcmp(argv[index], "-c") == 0) {
+                options.Callsign = argv[++index];
+            } else if (strcmp(argv[index], "-m") == 0) {
+                options.Method = argv[++index];
+            } else if (strcmp(argv[index], "-p") == 0) {
+                options.Parameters = argv[++index];
+            } else if (strcmp(argv[index], "-n") == 0) {
+                options.Calls = atoi(argv[++index]);
+            } else if (strcmp(argv[index], "-w") == 0) {
+                options.Window = static_cast<uint16_t>(atoi(argv[++index]));
+            } else if (strcmp(argv[index], "-t") == 0) {
+                options.Timeout = atoi(argv[++index]);
+            } else {
+                showHelp = true;
+            }
+            index++;
+        }
+
+        if ((options.Calls == 0) || (options.Window == 0)) {
+            showHelp = true;
+        }
+
+        if (showHelp == true) {
+            printf("Load generator for the JSON-RPC interface of WPEFramework.\n");
+            printf("jsonrpcload_test [-a address] [-c callsign] [-m method] [-p parameters] [-n calls] [-w window] [-t timeout]\n");
+            printf("  -a:  Address of the framework, default %s.\n", Options().Address.c_str());
+            printf("  -c:  Callsign, including the version, of the plugin to call, default %s.\n", Options().Callsign.c_str());
+            printf("  -m:  Method to call, default %s.\n", Options().Method.c_str());
+            printf("  -p:  Parameters to call the method with, as JSON.\n");
+            printf("  -n:  Number of calls to make, default %u.\n", Options().Calls);
+            printf("  -w:  Number of calls on their way at the same time, default %u.\n", Options().Window);
+            printf("  -t:  Time in ms a call may take, including the time waiting for the window, default %u.\n\n", Options().Timeout);
+        }
+
+        return (showHelp == false);
+    }
+
+    uint64_t Percentile(const std::vector<uint64_t>& sorted, const uint8_t percentage)
+    {
+        return (sorted[((sorted.size() - 1) * percentage) / 100]);
+    }
+}
+
+#ifdef __WIN32__
+int _tmain(int argc, _TCHAR** argv)
+#else
+int main(int argc, char** argv)
+#endif
+{
+    Options options;
+
+    if (ParseOptions(argc, argv, options) == true) {
+        Core::SystemInfo::SetEnvironment(_T("THUNDER_ACCESS"), options.Address);
+
+        {
+            typedef JSONRPC::LinkType<Core::JSON::IElement> Link;
+
+            Link link(options.Callsign);
+            bool connected = false;
+
+            // The connection is set up in the background, so the first call may not make it.
+            for (uint8_t attempt = 0; (attempt < 10) && (connected == false); attempt++) {
+                Link::Future probe(link.Post<string>(500, options.Method, options.Parameters));
+
+                probe.Wait(Core::infinite);
+
+                if (probe.Result() != Core::ERROR_TIMEDOUT) {
+                    connected = true;
+
+                    if (probe.Result() != Core::ERROR_NONE) {
+                        printf("Call to %s.%s failed: %s (%u)\n", options.Callsign.c_str(), options.Method.c_str(), probe.Response().c_str(), probe.Result());
+                    }
+                }
+            }
+
+            if (connected == false) {
+                printf("Could not reach %s on %s\n", options.Callsign.c_str(), options.Address.c_str());
+            } else {
+                std::vector<uint64_t> latencies(options.Calls, 0);
+                std::atomic<uint32_t> issued(0);
+                std::atomic<uint32_t> completed(0);
+                std::atomic<uint32_t> failed(0);
+                Core::Event done(false, true);
+                std::function<void()> next;
+                Core::StopWatch timer;
+
+                // Every call that completes makes room for the next one, so there are always window calls on their
+                // way and the latency is that of the call, not of the time it waited for its turn.
+                next = [&]() {
+                    const uint32_t index = issued++;
+
+                    if (index < options.Calls) {
+                        const uint64_t start = timer.Elapsed();
+
+                        link.Post<string>(options.Timeout, options.Method, options.Parameters, [&, index, start](const Core::JSONRPC::Message& response) {
+                            latencies[index] = timer.Elapsed() - start;
+
+                            if (response.Error.IsSet() == true) {
+                                failed++;
+                            }
+                            if (++completed == options.Calls) {
+                                done.SetEvent();
+                            } else {
+                                next();
+                            }
+                        });
+                    }
+                };
+
+                link.Window(options.Window);
+
+                timer.Reset();
+
+                for (uint16_t index = 0; index < options.Window; index++) {
+                    next();
+                }
+
+                done.Lock(Core::infinite);
+
+                const uint64_t elapsed = timer.Elapsed();
+
+                std::sort(latencies.begin(), latencies.end());
+
+                printf("%u calls to %s.%s, %u at the same time\n", options.Calls, options.Callsign.c_str(), options.Method.c_str(), options.Window);
+                printf("  failed:     %u\n", static_cast<uint32_t>(failed));
+                printf("  throughput: %u calls/s\n", static_cast<uint32_t>((options.Calls * 1000000ull) / (elapsed != 0 ? elapsed : 1)));
+                printf("  latency:    p50 %u us, p90 %u us, p99 %u us, max %u us\n",
+                    static_cast<uint32_t>(Percentile(latencies, 50)),
+                    static_cast<uint32_t>(Percentile(latencies, 90)),
+                    static_cast<uint32_t>(Percentile(latencies, 99)),
+                    static_cast<uint32_t>(latencies.back()));
+            }
+        }
+
+        Core::Singleton::Dispose();
+    }
+
+    return (0);
+}
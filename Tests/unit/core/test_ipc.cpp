@@ -22,6 +22,9 @@
 #include <gtest/gtest.h>
 #include <core/core.h>
 
+#include <atomic>
+#include <thread>
+
 namespace WPEFramework {
 namespace Tests {
 
@@ -199,6 +202,55 @@ namespace Tests {
         }
     };
 
+    class HandleDelayedTriplet : public Core::IIPCServer {
+    public:
+        HandleDelayedTriplet(const HandleDelayedTriplet&) = delete;
+        HandleDelayedTriplet& operator=(const HandleDelayedTriplet&) = delete;
+
+        HandleDelayedTriplet()
+            : _lock()
+            , _responders()
+        {
+        }
+
+        virtual ~HandleDelayedTriplet()
+        {
+            Join();
+        }
+
+    public:
+        // Respond after a millisecond, from another thread, as a plugin that handles
+        // the call on one of its workers would.
+        virtual void Procedure(Core::IPCChannel& source, Core::ProxyType<Core::IIPC>& data)
+        {
+            Core::ProxyType<Core::IIPC> message(data);
+
+            _lock.Lock();
+            _responders.emplace_back([&source, message]() mutable {
+                Core::ProxyType<TripletResponse> call(message);
+
+                SleepMs(1);
+
+                call->Response() = Response(call->Parameters().Display() + call->Parameters().Surface() + static_cast<uint32_t>(call->Parameters().Context()));
+                source.ReportResponse(message);
+            });
+            _lock.Unlock();
+        }
+        void Join()
+        {
+            _lock.Lock();
+            for (std::thread& responder : _responders) {
+                responder.join();
+            }
+            _responders.clear();
+            _lock.Unlock();
+        }
+
+    private:
+        Core::CriticalSection _lock;
+        std::list<std::thread> _responders;
+    };
+
     TEST(DISABLED_Core_IPC, ContinuousChannel)
     {
         std::string connector = _T("/tmp/testserver0");
@@ -816,5 +868,80 @@ namespace Tests {
             Core::Singleton::Dispose();
         }
     }
+
+    TEST(Core_IPC, PipelinedInvokeBenchmark)
+    {
+        constexpr uint8_t Threads = 4;
+        constexpr uint16_t Calls = 50;
+
+        Core::NodeId node(_T("/tmp/testserver6"));
+
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t> > serverFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t> >::Create());
+        Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t> > clientFactory(Core::ProxyType<Core::FactoryType<Core::IIPC, uint32_t> >::Create());
+
+        serverFactory->CreateFactory<TripletResponse>(2);
+        clientFactory->CreateFactory<TripletResponse>(2);
+
+        Core::ProxyType<HandleDelayedTriplet> responder(Core::ProxyType<HandleDelayedTriplet>::Create());
+        Core::ProxyType<Core::IIPCServer> handler(responder);
+        {
+            Core::IPCChannelServerType<Core::Void, false> server(node, 512, serverFactory);
+            server.Register(TripletResponse::Id(), handler);
+            EXPECT_EQ(server.Open(1000), Core::ERROR_NONE);
+
+            Core::IPCChannelClientType<Core::Void, false, false> client(node, 512, clientFactory);
+            EXPECT_EQ(client.Source().Open(1000), Core::ERROR_NONE);
+
+            auto invoke = [&client](const uint8_t thread, const uint16_t calls) -> uint16_t {
+                uint16_t failures = 0;
+
+                for (uint16_t index = 0; index < calls; index++) {
+                    Core::ProxyType<TripletResponse> call(Core::ProxyType<TripletResponse>::Create(Triplet(thread, index, 0)));
+
+                    if ((client.Invoke(call, 2000) != Core::ERROR_NONE) || (call->Response().Result() != static_cast<uint32_t>(thread + index))) {
+                        failures++;
+                    }
+                }
+
+                return (failures);
+            };
+
+            // Let the channel negotiate the sequences.
+            EXPECT_EQ(invoke(0, 2), 0);
+
+            Core::StopWatch stopWatch;
+
+            EXPECT_EQ(invoke(0, Threads * Calls), 0);
+
+            uint64_t serial = stopWatch.Reset();
+
+            std::atomic<uint16_t> failures(0);
+            std::list<std::thread> invokers;
+
+            for (uint8_t thread = 0; thread < Threads; thread++) {
+                invokers.emplace_back([&invoke, &failures, thread]() { failures += invoke(thread, Calls); });
+            }
+            for (std::thread& invoker : invokers) {
+                invoker.join();
+            }
+
+            uint64_t pipelined = stopWatch.Elapsed();
+
+            EXPECT_EQ(failures.load(), 0);
+
+            printf("%d invokes, 1 thread  : %8.2f us/call\n", Threads * Calls, static_cast<float>(serial) / (Threads * Calls));
+            printf("%d invokes, %d threads: %8.2f us/call\n", Threads * Calls, Threads, static_cast<float>(pipelined) / (Threads * Calls));
+
+            EXPECT_EQ(client.Source().Close(1000), Core::ERROR_NONE);
+
+            responder->Join();
+
+            server.Cleanup();
+            EXPECT_EQ(server.Close(1000), Core::ERROR_NONE);
+        }
+
+        serverFactory->DestroyFactories();
+        clientFactory->DestroyFactories();
+    }
 } // Tests
 } // WPEFramework
@@ -17,6 +17,7 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <functional>
 #include <sstream>
 
@@ -26,6 +27,25 @@
 #include <core/core.h>
 #include "JSON.h"
 
+// Count the heap allocations, so the benchmarks can report what the JSON
+// types cost the allocator.
+static std::atomic<uint32_t> g_allocations(0);
+
+void* operator new(std::size_t size)
+{
+    g_allocations++;
+
+    return (::malloc(size == 0 ? 1 : size));
+}
+void operator delete(void* memory) noexcept
+{
+    ::free(memory);
+}
+void operator delete(void* memory, std::size_t) noexcept
+{
+    ::free(memory);
+}
+
 namespace WPEFramework {
     enum class JSONTestEnum {
         ENUM_1,
@@ -2503,5 +2523,507 @@ namespace Tests {
             EXPECT_STREQ(input.c_str(), output.c_str());
         }
     }
+
+    // A container like our bigger config and status objects.
+    class WideContainer : public Core::JSON::Container {
+    public:
+        static constexpr uint8_t Members = 64;
+
+        WideContainer(const WideContainer&) = delete;
+        WideContainer& operator=(const WideContainer&) = delete;
+
+        // Reversed instances have other members than the index of the type, so they search.
+        WideContainer(const bool reversed = false)
+            : Core::JSON::Container()
+        {
+            for (uint8_t index = 0; index < Members; index++) {
+                const uint8_t member = (reversed == false ? index : (Members - 1 - index));
+                Add(Labels()[member].c_str(), &(Values[member]));
+            }
+        }
+        ~WideContainer() override = default;
+
+        static const std::vector<string>& Labels()
+        {
+            static std::vector<string> labels;
+
+            if (labels.empty() == true) {
+                for (uint8_t index = 0; index < Members; index++) {
+                    labels.push_back(_T("member_") + Core::NumberType<uint8_t>(index).Text());
+                }
+            }
+
+            return (labels);
+        }
+        static string Input()
+        {
+            string result(_T("{"));
+
+            for (uint8_t index = 0; index < Members; index++) {
+                result += (index == 0 ? _T("\"") : _T(",\"")) + Labels()[index] + _T("\":") + Core::NumberType<uint8_t>(index).Text();
+            }
+
+            return (result + _T("}"));
+        }
+
+    public:
+        Core::JSON::DecUInt32 Values[Members];
+    };
+
+    TEST(JSONParser, IndexedContainer)
+    {
+        const string input(WideContainer::Input());
+
+        WideContainer indexed;
+        EXPECT_TRUE(indexed.FromString(input));
+        WideContainer searched(true);
+        EXPECT_TRUE(searched.FromString(input));
+
+        for (uint8_t index = 0; index < WideContainer::Members; index++) {
+            EXPECT_EQ(indexed.Values[index].Value(), index);
+            EXPECT_EQ(searched.Values[index].Value(), index);
+        }
+
+        // A member added later on, is not in the index, but must be found.
+        Core::JSON::String extra;
+        indexed.Add(_T("extra"), &extra);
+        EXPECT_TRUE(indexed.FromString(_T("{\"member_3\":33,\"extra\":\"found\"}")));
+        EXPECT_EQ(indexed.Values[3].Value(), 33u);
+        EXPECT_STREQ(extra.Value().c_str(), _T("found"));
+
+        indexed.Remove(_T("extra"));
+    }
+
+    TEST(JSONParser, IndexedContainerBenchmark)
+    {
+        static constexpr uint16_t Rounds = 2000;
+        const string input(WideContainer::Input());
+        const bool modes[] = { true, false };
+
+        // Make sure the index for the type exists, before we start measuring.
+        WideContainer first;
+        EXPECT_TRUE(first.FromString(input));
+
+        for (const bool reversed : modes) {
+            Core::StopWatch stopWatch;
+
+            for (uint16_t round = 0; round < Rounds; round++) {
+                WideContainer container(reversed);
+                container.FromString(input);
+            }
+
+            uint64_t elapsed = stopWatch.Elapsed();
+
+            printf("JSON container of %d members, %-8s: %7.2f us/parse\n", WideContainer::Members, (reversed ? _T("search") : _T("indexed")), static_cast<float>(elapsed) / Rounds);
+        }
+    }
+
+    TEST(JSONParser, ArrayStorage)
+    {
+        Core::JSON::ArrayType<Core::JSON::DecUInt32> array;
+
+        // References handed out stay valid while the array grows.
+        Core::JSON::DecUInt32& first(array.Add());
+        first = 42;
+
+        for (uint32_t index = 1; index < 1000; index++) {
+            array.Add() = index;
+        }
+
+        EXPECT_EQ(&first, &array[0]);
+        EXPECT_EQ(first.Value(), 42u);
+        EXPECT_EQ(array.Length(), 1000u);
+
+        // An unset element in between is skipped by the iterators.
+        array[500].Clear();
+
+        uint32_t count = 0;
+        Core::JSON::ArrayType<Core::JSON::DecUInt32>::Iterator index(array.Elements());
+        while (index.Next() == true) {
+            EXPECT_EQ(index.Current().Value(), (count == 0 ? 42u : (count < 500 ? count : count + 1)));
+            count++;
+        }
+        EXPECT_EQ(count, 999u);
+
+        EXPECT_TRUE(index.Reset(499));
+        EXPECT_EQ(index.Current().Value(), 499u);
+        EXPECT_TRUE(index.Next());
+        EXPECT_EQ(index.Current().Value(), 501u);
+
+        // Copies are deep, and an iterator keeps working on its own array.
+        Core::JSON::ArrayType<Core::JSON::DecUInt32> copy(array);
+        array.Clear();
+        EXPECT_EQ(copy.Length(), 1000u);
+        EXPECT_EQ(copy[999].Value(), 999u);
+        EXPECT_FALSE(index.Reset(0));
+
+        Core::JSON::ArrayType<Core::JSON::DecUInt32>::ConstIterator constIndex(static_cast<const Core::JSON::ArrayType<Core::JSON::DecUInt32>&>(copy).Elements());
+        count = 0;
+        while (constIndex.Next() == true) {
+            count++;
+        }
+        EXPECT_EQ(count, 999u);
+    }
+
+    static constexpr uint16_t ArrayElements = 10000;
+
+    template <typename ELEMENT>
+    void ArrayBenchmark(const TCHAR name[], const string& input)
+    {
+        static constexpr uint16_t Rounds = 20;
+        uint32_t allocations = 0;
+        uint64_t parse = 0;
+        uint64_t serialize = 0;
+        string output;
+
+        for (uint16_t round = 0; round < Rounds; round++) {
+            Core::JSON::ArrayType<ELEMENT> array;
+            uint32_t start = g_allocations;
+            Core::StopWatch stopWatch;
+
+            EXPECT_TRUE(array.FromString(input));
+
+            parse += stopWatch.Reset();
+            allocations += (g_allocations - start);
+
+            array.ToString(output);
+
+            serialize += stopWatch.Elapsed();
+        }
+
+        EXPECT_EQ(output, input);
+
+        printf("JSON array of %d %-7s: %6d allocations, %8.2f us/parse, %8.2f us/serialize\n", ArrayElements, name,
+            allocations / Rounds, static_cast<float>(parse) / Rounds, static_cast<float>(serialize) / Rounds);
+    }
+
+    TEST(JSONParser, ArrayBenchmark)
+    {
+        string numbers(_T("["));
+        string strings(_T("["));
+
+        for (uint16_t index = 0; index < ArrayElements; index++) {
+            if (index != 0) {
+                numbers += ',';
+                strings += ',';
+            }
+            numbers += Core::NumberType<uint16_t>(index).Text();
+            strings += _T("\"element_") + Core::NumberType<uint16_t>(index).Text() + '"';
+        }
+
+        numbers += ']';
+        strings += ']';
+
+        ArrayBenchmark<Core::JSON::DecUInt32>(_T("numbers"), numbers);
+        ArrayBenchmark<Core::JSON::String>(_T("strings"), strings);
+
+        // The elements themselves no longer cost an allocation each.
+        const uint32_t start = g_allocations;
+        Core::JSON::ArrayType<Core::JSON::DecUInt32> array;
+        array.FromString(numbers);
+        EXPECT_LT(g_allocations - start, static_cast<uint32_t>(ArrayElements / 10));
+    }
+
+    class RetainContainer : public Core::JSON::Container {
+    public:
+        RetainContainer(const RetainContainer&) = delete;
+        RetainContainer& operator=(const RetainContainer&) = delete;
+
+        RetainContainer()
+            : Core::JSON::Container()
+            , Name()
+            , Escaped()
+            , Nothing()
+            , List()
+        {
+            Add(_T("name"), &Name);
+            Add(_T("escaped"), &Escaped);
+            Add(_T("nothing"), &Nothing);
+            Add(_T("list"), &List);
+        }
+        ~RetainContainer() override = default;
+
+    public:
+        Core::JSON::String Name;
+        Core::JSON::String Escaped;
+        Core::JSON::String Nothing;
+        Core::JSON::ArrayType<Core::JSON::String> List;
+    };
+
+    static bool IsReference(const Core::JSON::String& element, const string& buffer)
+    {
+        const TCHAR* value = &(element.Fragment()[0]);
+
+        return ((value >= buffer.c_str()) && (value < (buffer.c_str() + buffer.length())));
+    }
+
+    TEST(JSONParser, StringRetain)
+    {
+        const string input(_T("{\"name\":\"retained\",\"escaped\":\"new\\nline\",\"nothing\":\"null\",\"list\":[\"first\",\"second\"]}"));
+
+        {
+            // Without the scope, the values are copied.
+            RetainContainer object;
+            EXPECT_TRUE(object.FromString(input));
+            EXPECT_EQ(object.Name.Value(), _T("retained"));
+            EXPECT_FALSE(IsReference(object.Name, input));
+        }
+        {
+            RetainContainer object;
+            Core::JSON::String::Retain retain(input);
+
+            EXPECT_TRUE(object.FromString(input));
+
+            EXPECT_EQ(object.Name.Value(), _T("retained"));
+            EXPECT_TRUE(IsReference(object.Name, input));
+            EXPECT_EQ(object.Name.Fragment().Length(), 8u);
+
+            // Escapes still need to be decoded, into a copy.
+            EXPECT_EQ(object.Escaped.Value(), _T("new\nline"));
+            EXPECT_FALSE(IsReference(object.Escaped, input));
+
+            // A quoted null is still a null.
+            EXPECT_TRUE(object.Nothing.IsNull());
+
+            EXPECT_EQ(object.List.Length(), 2u);
+            EXPECT_EQ(object.List[1].Value(), _T("second"));
+            EXPECT_TRUE(IsReference(object.List[1], input));
+
+            string output;
+            object.ToString(output);
+            EXPECT_EQ(output, _T("{\"name\":\"retained\",\"escaped\":\"new\\nline\",\"nothing\":null,\"list\":[\"first\",\"second\"]}"));
+
+            // Copies own their value, so they may outlive the buffer.
+            Core::JSON::String copy(object.Name);
+            EXPECT_EQ(copy.Value(), _T("retained"));
+            EXPECT_FALSE(IsReference(copy, input));
+
+            Core::JSON::ArrayType<Core::JSON::String> list(object.List);
+            EXPECT_EQ(list[0].Value(), _T("first"));
+            EXPECT_FALSE(IsReference(list[0], input));
+
+            // And so do Strings that are changed.
+            object.Name = _T("changed");
+            EXPECT_EQ(object.Name.Value(), _T("changed"));
+            EXPECT_FALSE(IsReference(object.Name, input));
+        }
+    }
+
+    class BulkParameters : public Core::JSON::Container {
+    public:
+        BulkParameters(const BulkParameters&) = delete;
+        BulkParameters& operator=(const BulkParameters&) = delete;
+
+        BulkParameters()
+            : Core::JSON::Container()
+            , Name()
+            , Entries()
+        {
+            Add(_T("name"), &Name);
+            Add(_T("entries"), &Entries);
+        }
+        ~BulkParameters() override = default;
+
+    public:
+        Core::JSON::String Name;
+        Core::JSON::ArrayType<Core::JSON::String> Entries;
+    };
+
+    class BulkReceiver {
+    public:
+        BulkReceiver(const BulkReceiver&) = delete;
+        BulkReceiver& operator=(const BulkReceiver&) = delete;
+
+        BulkReceiver()
+            : Count(0)
+        {
+        }
+        ~BulkReceiver() = default;
+
+    public:
+        uint32_t Set(const BulkParameters& parameters)
+        {
+            Count = parameters.Entries.Length();
+            return (Core::ERROR_NONE);
+        }
+
+        uint32_t Count;
+    };
+
+    TEST(JSONParser, StringRetainJSONRPCBenchmark)
+    {
+        static constexpr uint16_t Rounds = 50;
+        static constexpr uint16_t Entries = 1000;
+
+        string parameters(_T("{\"name\":\"bulk\",\"entries\":["));
+        for (uint16_t index = 0; index < Entries; index++) {
+            if (index != 0) {
+                parameters += ',';
+            }
+            parameters += '"' + string(96, 'a' + (index % 26)) + '"';
+        }
+        parameters += _T("]}");
+
+        BulkReceiver receiver;
+        Core::JSONRPC::Handler handler([](const uint32_t, const string&, const string&) {}, { 1 });
+        handler.Register<BulkParameters, void>(_T("set"), &BulkReceiver::Set, &receiver);
+
+        Core::StopWatch stopWatch;
+
+        for (uint16_t round = 0; round < Rounds; round++) {
+            BulkParameters inbound;
+            inbound.FromString(parameters);
+            receiver.Set(inbound);
+        }
+
+        uint64_t copied = stopWatch.Reset();
+        EXPECT_EQ(receiver.Count, Entries);
+        receiver.Count = 0;
+
+        for (uint16_t round = 0; round < Rounds; round++) {
+            string response;
+            EXPECT_EQ(handler.Invoke(Core::JSONRPC::Context(), _T("set"), parameters, response), Core::ERROR_NONE);
+        }
+
+        uint64_t retained = stopWatch.Elapsed();
+        EXPECT_EQ(receiver.Count, Entries);
+
+        printf("JSON-RPC parameters of %d bytes, copied  : %8.2f us/call, %7.2f MB/s\n", static_cast<uint32_t>(parameters.length()),
+            static_cast<float>(copied) / Rounds, static_cast<float>(parameters.length()) * Rounds / copied);
+        printf("JSON-RPC parameters of %d bytes, retained: %8.2f us/call, %7.2f MB/s\n", static_cast<uint32_t>(parameters.length()),
+            static_cast<float>(retained) / Rounds, static_cast<float>(parameters.length()) * Rounds / retained);
+    }
+
+    TEST(JSONParser, Scanner)
+    {
+        char buffer[100];
+
+        for (uint16_t length = 0; length < sizeof(buffer); length++) {
+            for (uint16_t position = 0; position <= length; position += 3) {
+                ::memset(buffer, ' ', sizeof(buffer));
+                buffer[position % 4] = '\t';
+                if (position < length) {
+                    buffer[position] = static_cast<char>(0xE9);
+                }
+                if (position > 0) {
+                    buffer[position - 1] = '\f';
+                }
+                EXPECT_EQ(Core::JSON::Scanner::Whitespace(buffer, length), (position < length ? position : length));
+
+                ::memset(buffer, 'a', sizeof(buffer));
+                buffer[position % 5] = static_cast<char>(0xC3);
+                if (position < length) {
+                    buffer[position] = ((position & 1) == 0 ? '"' : '\\');
+                }
+                EXPECT_EQ(Core::JSON::Scanner::Plain(buffer, length), (position < length ? position : length));
+            }
+        }
+
+        EXPECT_EQ(Core::JSON::Scanner::SkipWhitespace(" \r\n\v x", 6), 5u);
+        EXPECT_EQ(Core::JSON::Scanner::SkipWhitespace("x ", 2), 0u);
+    }
+
+    class Record : public Core::JSON::Container {
+    public:
+        Record& operator=(const Record&) = delete;
+
+        Record()
+            : Core::JSON::Container()
+            , Id()
+            , Name()
+            , Description()
+        {
+            Init();
+        }
+        Record(const Record& copy)
+            : Core::JSON::Container()
+            , Id(copy.Id)
+            , Name(copy.Name)
+            , Description(copy.Description)
+        {
+            Init();
+        }
+        ~Record() override = default;
+
+    private:
+        void Init()
+        {
+            Add(_T("id"), &Id);
+            Add(_T("name"), &Name);
+            Add(_T("description"), &Description);
+        }
+
+    public:
+        Core::JSON::DecUInt32 Id;
+        Core::JSON::String Name;
+        Core::JSON::String Description;
+    };
+
+    static string Records(const uint32_t count, const uint16_t length)
+    {
+        string result(_T("[\n"));
+
+        for (uint32_t index = 0; index < count; index++) {
+            result += _T("    {\n        \"id\": ") + Core::NumberType<uint32_t>(index).Text() + _T(",\n");
+            result += _T("        \"name\": \"record ") + Core::NumberType<uint32_t>(index).Text() + _T("\",\n");
+            result += _T("        \"description\": \"") + string(length, 'a' + (index % 26)) + _T("\\n\\\"quoted\\\" and \\u00e9scaped\"\n    }");
+            result += ((index + 1) < count ? _T(",\n") : _T("\n"));
+        }
+
+        return (result + ']');
+    }
+
+    TEST(JSONParser, ScannerChunked)
+    {
+        const string input(Records(20, 160));
+
+        Core::JSON::ArrayType<Record> reference;
+        EXPECT_TRUE(reference.FromString(input));
+        ASSERT_EQ(reference.Length(), 20u);
+        EXPECT_EQ(reference[19].Description.Value(), string(160, 'a' + 19) + _T("\n\"quoted\" and \xC3\xA9scaped"));
+
+        // Feed it in chunks that end anywhere, runs are picked up where the last chunk stopped.
+        const uint16_t chunks[] = { 1, 2, 7, 16, 31, 33, 100 };
+
+        for (const uint16_t chunk : chunks) {
+            Core::JSON::ArrayType<Record> array;
+            Core::OptionalType<Core::JSON::Error> error;
+            uint32_t offset = 0;
+            uint32_t handled = 0;
+
+            while (handled < input.length()) {
+                const uint16_t size = static_cast<uint16_t>(std::min(static_cast<uint32_t>(chunk), static_cast<uint32_t>(input.length() - handled)));
+                handled += static_cast<Core::JSON::IElement&>(array).Deserialize(&(input[handled]), size, offset, error);
+            }
+
+            EXPECT_FALSE(error.IsSet());
+            ASSERT_EQ(array.Length(), reference.Length());
+
+            for (uint16_t index = 0; index < reference.Length(); index++) {
+                EXPECT_EQ(array[index].Id.Value(), reference[index].Id.Value());
+                EXPECT_EQ(array[index].Name.Value(), reference[index].Name.Value());
+                EXPECT_EQ(array[index].Description.Value(), reference[index].Description.Value());
+            }
+        }
+    }
+
+    TEST(JSONParser, ScannerBenchmark)
+    {
+        static constexpr uint16_t Rounds = 10;
+        const string input(Records(2000, 1000));
+
+        Core::StopWatch stopWatch;
+
+        for (uint16_t round = 0; round < Rounds; round++) {
+            Core::JSON::ArrayType<Record> array;
+            array.FromString(input);
+            EXPECT_EQ(array.Length(), 2000u);
+        }
+
+        uint64_t elapsed = stopWatch.Elapsed();
+
+        printf("JSON document of %d bytes, scanning with %s: %7.2f MB/s\n", static_cast<uint32_t>(input.length()),
+            Core::JSON::Scanner::Implementation(), static_cast<float>(input.length()) * Rounds / elapsed);
+    }
 }
 }
@@ -0,0 +1,308 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    namespace {
+
+        const TCHAR serverAddress[] = _T("127.0.0.1:9771");
+
+        class MessageFactory : public Core::ProxyPoolType<Core::JSONRPC::Message> {
+        public:
+            MessageFactory() = delete;
+            MessageFactory(const MessageFactory&) = delete;
+            MessageFactory& operator=(const MessageFactory&) = delete;
+
+            MessageFactory(const uint32_t number)
+                : Core::ProxyPoolType<Core::JSONRPC::Message>(number)
+            {
+            }
+            ~MessageFactory() = default;
+
+        public:
+            Core::ProxyType<Core::JSON::IElement> Element(const string&)
+            {
+                return (Core::ProxyType<Core::JSON::IElement>(Core::ProxyPoolType<Core::JSONRPC::Message>::Element()));
+            }
+        };
+
+        // Echoes the parameters of every call as its result. Calls to "hold" are kept until released, calls to
+        // "drop" are never answered.
+        class EchoServer : public Core::StreamJSONType<Web::WebSocketServerType<Core::SocketStream>, MessageFactory&, Core::JSON::IElement> {
+        private:
+            typedef Core::StreamJSONType<Web::WebSocketServerType<Core::SocketStream>, MessageFactory&, Core::JSON::IElement> BaseClass;
+
+        public:
+            EchoServer() = delete;
+            EchoServer(const EchoServer&) = delete;
+            EchoServer& operator=(const EchoServer&) = delete;
+
+            EchoServer(const SOCKET& socket, const Core::NodeId& remoteNode, Core::SocketServerType<EchoServer>*)
+                : BaseClass(2, _factory, false, false, false, socket, remoteNode, 1024, 1024)
+                , _factory(4)
+                , _adminLock()
+                , _held()
+            {
+            }
+            ~EchoServer() override = default;
+
+        public:
+            static uint32_t Held()
+            {
+                return (_holding);
+            }
+            void Release()
+            {
+                std::list<Core::ProxyType<Core::JSONRPC::Message>> held;
+
+                // Respond outside the lock, the socket takes its own lock before it hands over what came in.
+                _adminLock.Lock();
+                held.swap(_held);
+                _holding -= static_cast<uint32_t>(held.size());
+                _adminLock.Unlock();
+
+                for (const Core::ProxyType<Core::JSONRPC::Message>& request : held) {
+                    Respond(request);
+                }
+            }
+
+            bool IsIdle() const override
+            {
+                return (true);
+            }
+            void StateChange() override
+            {
+            }
+            void Received(Core::ProxyType<Core::JSON::IElement>& element) override
+            {
+                Core::ProxyType<Core::JSONRPC::Message> request(element);
+
+                if (request->Designator.Value() == _T("hold")) {
+                    _adminLock.Lock();
+                    _held.push_back(request);
+                    _holding++;
+                    _adminLock.Unlock();
+                } else if (request->Designator.Value() != _T("drop")) {
+                    Respond(request);
+                }
+            }
+            void Send(Core::ProxyType<Core::JSON::IElement>& /* element */) override
+            {
+            }
+
+        private:
+            void Respond(const Core::ProxyType<Core::JSONRPC::Message>& request)
+            {
+                Core::ProxyType<Core::JSONRPC::Message> response(Core::ProxyType<Core::JSONRPC::Message>::Create());
+
+                response->Id = request->Id.Value();
+                response->Result = request->Parameters.Value();
+
+                Submit(Core::ProxyType<Core::JSON::IElement>(response));
+            }
+
+        private:
+            MessageFactory _factory;
+            Core::CriticalSection _adminLock;
+            std::list<Core::ProxyType<Core::JSONRPC::Message>> _held;
+            static std::atomic<uint32_t> _holding;
+        };
+
+        std::atomic<uint32_t> EchoServer::_holding(0);
+
+        class Link : public JSONRPC::LinkType<Core::JSON::IElement> {
+        public:
+            Link(const Link&) = delete;
+            Link& operator=(const Link&) = delete;
+
+            Link()
+                : JSONRPC::LinkType<Core::JSON::IElement>(_T(""))
+            {
+            }
+            ~Link() override = default;
+
+        public:
+            // Opened() may come by before this object is complete, so ask the other side until it answers.
+            bool WaitForOpen(const uint32_t waitTime)
+            {
+                bool opened = false;
+
+                for (uint32_t waited = 0; (opened == false) && (waited < waitTime); waited += 100) {
+                    Future probe(Post<string>(100, _T("echo"), _T("{}")));
+                    opened = ((probe.Wait(Core::infinite) == Core::ERROR_NONE) && (probe.Result() == Core::ERROR_NONE));
+                }
+
+                return (opened);
+            }
+        };
+
+        bool WaitFor(const std::function<bool()>& condition, const uint32_t waitTime)
+        {
+            uint32_t waited = 0;
+
+            while ((condition() == false) && (waited < waitTime)) {
+                SleepMs(10);
+                waited += 10;
+            }
+
+            return (condition());
+        }
+    }
+
+    TEST(JSONRPC_Link, Pipelining)
+    {
+        const Core::NodeId address(serverAddress);
+        Core::SocketServerType<EchoServer> server(address);
+        ASSERT_EQ(server.Open(Core::infinite), Core::ERROR_NONE);
+
+        Core::SystemInfo::SetEnvironment(_T("THUNDER_ACCESS"), serverAddress);
+
+        {
+            Link link;
+            ASSERT_TRUE(link.WaitForOpen(2000));
+
+            // Window of 8, the rest waits for those to complete.
+            link.Window(8);
+
+            std::vector<Link::Future> calls;
+            for (uint32_t index = 0; index < 40; index++) {
+                calls.push_back(link.Post<string>(5000, _T("hold"), _T("{\"index\":") + std::to_string(index) + _T("}")));
+            }
+
+            EXPECT_TRUE(WaitFor([]() { return (EchoServer::Held() == 8); }, 2000));
+            SleepMs(100);
+            EXPECT_EQ(EchoServer::Held(), 8u);
+            EXPECT_FALSE(calls[0].IsCompleted());
+
+            // Answer whatever comes in, until all is in.
+            EXPECT_TRUE(WaitFor([&server, &calls]() {
+                Core::SocketServerType<EchoServer>::Iterator index(server.Clients());
+                while (index.Next() == true) {
+                    index.Client()->Release();
+                }
+                return (calls.back().IsCompleted());
+            }, 5000));
+
+            for (uint32_t index = 0; index < calls.size(); index++) {
+                EXPECT_EQ(calls[index].Wait(1000), Core::ERROR_NONE);
+                EXPECT_EQ(calls[index].Result(), Core::ERROR_NONE);
+                EXPECT_EQ(calls[index].Response(), _T("{\"index\":") + std::to_string(index) + _T("}"));
+            }
+
+            // Unanswered calls time out, also those that never made it through the window.
+            link.Window(1);
+
+            Core::StopWatch timer;
+            Link::Future first(link.Post<string>(200, _T("drop"), _T("{}")));
+            Link::Future second(link.Post<string>(300, _T("drop"), _T("{}")));
+            Link::Future answered(link.Post<string>(2000, _T("echo"), _T("{\"after\":true}")));
+
+            EXPECT_EQ(first.Wait(2000), Core::ERROR_NONE);
+            EXPECT_EQ(first.Result(), Core::ERROR_TIMEDOUT);
+            EXPECT_EQ(second.Wait(2000), Core::ERROR_NONE);
+            EXPECT_EQ(second.Result(), Core::ERROR_TIMEDOUT);
+            EXPECT_EQ(answered.Wait(2000), Core::ERROR_NONE);
+            EXPECT_EQ(answered.Result(), Core::ERROR_NONE);
+            EXPECT_EQ(answered.Response(), _T("{\"after\":true}"));
+
+            const uint64_t elapsed = timer.Elapsed();
+            EXPECT_GE(elapsed, 200u * 1000u);
+            EXPECT_LT(elapsed, 1000u * 1000u);
+        }
+
+        server.Close(Core::infinite);
+    }
+
+    TEST(JSONRPC_Link, PipelinedThroughput)
+    {
+        const uint32_t calls = 2000;
+        const Core::NodeId address(serverAddress);
+        Core::SocketServerType<EchoServer> server(address);
+        ASSERT_EQ(server.Open(Core::infinite), Core::ERROR_NONE);
+
+        Core::SystemInfo::SetEnvironment(_T("THUNDER_ACCESS"), serverAddress);
+
+        // The calls are answered every millisecond, like a plugin would that has to wait for something else.
+        std::atomic<bool> running(true);
+        std::thread responder([&server, &running]() {
+            while (running == true) {
+                SleepMs(1);
+
+                Core::SocketServerType<EchoServer>::Iterator index(server.Clients());
+                while (index.Next() == true) {
+                    index.Client()->Release();
+                }
+            }
+        });
+
+        {
+            Link link;
+            ASSERT_TRUE(link.WaitForOpen(2000));
+            uint64_t timings[2];
+
+            // Blocking calls, one waits for the other.
+            const string parameters(_T("{\"value\":42}"));
+            Core::StopWatch timer;
+            for (uint32_t index = 0; index < calls; index++) {
+                Core::ProxyType<Core::JSONRPC::Message> response;
+                EXPECT_EQ(link.Invoke(5000, _T("hold"), parameters, response), Core::ERROR_NONE);
+            }
+            timings[0] = timer.Elapsed();
+
+            // The same calls, pipelined.
+            std::atomic<uint32_t> completed(0);
+            std::atomic<uint32_t> failed(0);
+
+            link.Window(64);
+
+            timer.Reset();
+            for (uint32_t index = 0; index < calls; index++) {
+                link.Post<string>(5000, _T("hold"), parameters, [&completed, &failed](const Core::JSONRPC::Message& response) {
+                    if (response.Error.IsSet() == true) {
+                        failed++;
+                    }
+                    completed++;
+                });
+            }
+
+            EXPECT_TRUE(WaitFor([&completed, calls]() { return (completed == calls); }, 10000));
+            timings[1] = timer.Elapsed();
+            EXPECT_EQ(failed, 0u);
+            EXPECT_LT(timings[1], timings[0]);
+
+            printf("%u JSON-RPC calls over one websocket, answered every millisecond\n", calls);
+            printf("  blocking:      %u calls/s\n", static_cast<uint32_t>((calls * 1000000ull) / timings[0]));
+            printf("  64 in flight:  %u calls/s\n", static_cast<uint32_t>((calls * 1000000ull) / timings[1]));
+        }
+
+        running = false;
+        responder.join();
+
+        server.Close(Core::infinite);
+    }
+
+} // Tests
+} // WPEFramework
@@ -24,6 +24,7 @@
 
 #include <core/FileObserver.h>
 #include <fstream>
+#include <thread>
 
 namespace WPEFramework {
 namespace Tests {
@@ -112,6 +113,169 @@ namespace Tests {
         ASSERT_EQ(readData[0], 13);
     }
 
+    TEST_F(Core_MessageDispatcher, WriteAndReadDataAreEqualWhenTheSizeWrapsAround)
+    {
+        //entries of 5 bytes (size included), so the size in front of them ends up at every position of the buffer, also split over its end
+        uint8_t testData[3];
+        uint8_t readData[8];
+
+        for (uint32_t index = 0; index < (2 * DATA_SIZE); index++) {
+            uint16_t readLength = sizeof(readData);
+            testData[0] = static_cast<uint8_t>(index);
+            testData[1] = static_cast<uint8_t>(index >> 8);
+            testData[2] = 0xA5;
+
+            ASSERT_EQ(_dispatcher->PushData(sizeof(testData), testData), Core::ERROR_NONE);
+            ASSERT_EQ(_dispatcher->PopData(readLength, readData), Core::ERROR_NONE);
+
+            ASSERT_EQ(readLength, sizeof(testData));
+            ASSERT_EQ(::memcmp(readData, testData, sizeof(testData)), 0);
+        }
+    }
+
+    TEST_F(Core_MessageDispatcher, DataOfEveryThreadIsReadInOrderWithThreadBuffers)
+    {
+        //one thread more than there are thread buffers, that one uses the shared buffer
+        constexpr uint8_t threadBuffers = 3;
+        constexpr uint32_t messages = 1000;
+
+        Core::MessageDispatcherType<METADATA_SIZE, DATA_SIZE> writerDispatcher(_T("thread_md"), 0, true, this->_basePath, threadBuffers);
+        Core::MessageDispatcherType<METADATA_SIZE, DATA_SIZE> readerDispatcher(_T("thread_md"), 0, false, this->_basePath);
+
+        std::vector<std::thread> writers;
+        for (uint8_t thread = 0; thread <= threadBuffers; thread++) {
+            writers.emplace_back([&writerDispatcher, thread]() {
+                uint8_t testData[1 + sizeof(uint32_t)];
+                testData[0] = thread;
+
+                for (uint32_t index = 0; index < messages; index++) {
+                    ::memcpy(&testData[1], &index, sizeof(index));
+                    EXPECT_EQ(writerDispatcher.PushData(sizeof(testData), testData), Core::ERROR_NONE);
+                }
+            });
+        }
+        for (std::thread& writer : writers) {
+            writer.join();
+        }
+
+        uint32_t next[threadBuffers + 1] = {};
+        uint8_t readData[8];
+        uint16_t readLength = sizeof(readData);
+
+        while (readerDispatcher.PopData(readLength, readData) == Core::ERROR_NONE) {
+            uint32_t index;
+
+            ASSERT_EQ(readLength, 1 + sizeof(uint32_t));
+            ASSERT_LE(readData[0], threadBuffers);
+            ::memcpy(&index, &readData[1], sizeof(index));
+            ASSERT_EQ(index, next[readData[0]]);
+
+            next[readData[0]]++;
+            readLength = sizeof(readData);
+        }
+
+        for (uint8_t thread = 0; thread <= threadBuffers; thread++) {
+            EXPECT_EQ(next[thread], messages);
+        }
+        EXPECT_EQ(writerDispatcher.Dropped(), 0u);
+    }
+
+    TEST_F(Core_MessageDispatcher, ThreadBuffersDropDataThatDoesNotFit)
+    {
+        Core::MessageDispatcherType<METADATA_SIZE, DATA_SIZE> writerDispatcher(_T("thread_md"), 0, true, this->_basePath, 1);
+
+        uint8_t testData[1024] = { 42 };
+        uint32_t pushed = 0;
+
+        //the buffer of a thread is never overwritten, what does not fit is dropped
+        while (writerDispatcher.PushData(sizeof(testData), testData) == Core::ERROR_NONE) {
+            pushed++;
+        }
+        EXPECT_EQ(writerDispatcher.Dropped(), 1u);
+
+        uint8_t readData[sizeof(testData)];
+        uint16_t readLength = sizeof(readData);
+        uint32_t popped = 0;
+
+        while (writerDispatcher.PopData(readLength, readData) == Core::ERROR_NONE) {
+            EXPECT_EQ(readLength, sizeof(testData));
+            EXPECT_EQ(readData[0], 42);
+            readLength = sizeof(readData);
+            popped++;
+        }
+        EXPECT_EQ(popped, pushed);
+
+        //room again
+        EXPECT_EQ(writerDispatcher.PushData(sizeof(testData), testData), Core::ERROR_NONE);
+    }
+
+    TEST_F(Core_MessageDispatcher, ThreadBuffersReduceContentionOfConcurrentWriters)
+    {
+        constexpr uint8_t writers = 4;
+        constexpr uint32_t messages = 50000;
+
+        //what counts is what reaches the reader: the shared buffer overwrites what the reader could not keep up with,
+        //a writer with a buffer of its own gives the reader a chance when its buffer is full
+        auto measure = [this](const uint8_t threadBuffers, uint32_t& read) -> uint64_t {
+            Core::MessageDispatcherType<METADATA_SIZE, DATA_SIZE> writerDispatcher(_T("bench_md"), threadBuffers, true, this->_basePath, threadBuffers);
+            Core::MessageDispatcherType<METADATA_SIZE, DATA_SIZE> readerDispatcher(_T("bench_md"), threadBuffers, false, this->_basePath);
+            std::atomic<bool> done(false);
+
+            read = 0;
+
+            const uint64_t start = Core::Time::Now().Ticks();
+
+            std::thread reader([&]() {
+                uint8_t readData[128];
+                bool more = true;
+
+                while (more == true) {
+                    const bool last = done;
+                    uint16_t readLength = sizeof(readData);
+
+                    if (readerDispatcher.PopData(readLength, readData) == Core::ERROR_NONE) {
+                        read++;
+                    } else if (last == true) {
+                        more = false;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+
+            std::vector<std::thread> threads;
+            for (uint8_t thread = 0; thread < writers; thread++) {
+                threads.emplace_back([&writerDispatcher]() {
+                    uint8_t testData[64] = {};
+
+                    for (uint32_t index = 0; index < messages; index++) {
+                        while (writerDispatcher.PushData(sizeof(testData), testData) != Core::ERROR_NONE) {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+            for (std::thread& thread : threads) {
+                thread.join();
+            }
+
+            done = true;
+            reader.join();
+
+            return (Core::Time::Now().Ticks() - start);
+        };
+
+        uint32_t sharedRead, threadRead;
+        const uint64_t shared = measure(0, sharedRead);
+        const uint64_t own = measure(writers, threadRead);
+
+        std::cout << static_cast<uint32_t>(writers) << " writers of " << messages << " messages each, read per second: shared buffer "
+                  << ((static_cast<uint64_t>(sharedRead) * Core::Time::MicroSecondsPerSecond) / std::max(shared, static_cast<uint64_t>(1))) << " (" << sharedRead << " read in " << shared << " us), thread buffers "
+                  << ((static_cast<uint64_t>(threadRead) * Core::Time::MicroSecondsPerSecond) / std::max(own, static_cast<uint64_t>(1))) << " (" << threadRead << " read in " << own << " us)" << std::endl;
+
+        EXPECT_EQ(threadRead, static_cast<uint32_t>(writers) * messages);
+    }
+
     TEST_F(Core_MessageDispatcher, CreateAndOpenOperatesOnSameValidFile)
     {
         Core::MessageDispatcherType<METADATA_SIZE, DATA_SIZE> writerDispatcher(_T("test_md"), 0, true, this->_basePath);
@@ -571,3 +571,213 @@ TEST_F(Core_Messaging_MessageUnit, PopMessageShouldReturnLastPushedMessageInOthe
     }
     testAdmin.Sync("done");
 }
+
+TEST_F(Core_Messaging_MessageUnit, BinaryTraceArgumentsAreRenderedWithTheirFormat)
+{
+    std::vector<uint8_t> data;
+    auto add = [&data](const void* value, const size_t size) {
+        data.insert(data.end(), static_cast<const uint8_t*>(value), static_cast<const uint8_t*>(value) + size);
+    };
+
+    const int32_t negative = -2;
+    const uint8_t small = 200;
+    const double fraction = 3.14159;
+    const uint16_t length = 4;
+    const int64_t large = 0x123456789A;
+    const int32_t width = 6;
+    add(&negative, sizeof(negative));
+    add(&small, sizeof(small));
+    add(&fraction, sizeof(fraction));
+    add(&length, sizeof(length));
+    add("text", length);
+    add(&large, sizeof(large));
+    add(&width, sizeof(width));
+    add(&negative, sizeof(negative));
+
+    string text;
+    Messaging::CallSites::Render(_T("%d %u %.2f [%5s] %llx %% [%-*d] %x"), _T("iBdsqii"), data.data(), static_cast<uint16_t>(data.size()), text);
+    ASSERT_STREQ(text.c_str(), _T("-2 200 3.14 [ text] 123456789a % [-2    ] <?>"));
+
+    // An argument that does not match its conversion is left out, the others still end up where they should.
+    const int32_t numbers[] = { 7, 9 };
+    Messaging::CallSites::Render(_T("%s and %d"), _T("ii"), reinterpret_cast<const uint8_t*>(numbers), sizeof(numbers), text);
+    ASSERT_STREQ(text.c_str(), _T("<?> and 9"));
+}
+
+TEST_F(Core_Messaging_MessageUnit, BinaryTraceIsRenderedByTheMessageClient)
+{
+    Messaging::MessageClient client(DispatcherIdentifier(), DispatcherBasePath());
+    client.AddInstance(0); //we are in framework
+
+    Messaging::TraceFactory factory;
+    client.AddFactory(Core::Messaging::MetaData::MessageType::TRACING, &factory);
+
+    //the call site TRACE_FORMAT creates, without the control that switches it on and off
+    const uint16_t line = __LINE__;
+    static Messaging::CallSite site(_T("some_category"), EXPAND_AND_QUOTE(MODULE_NAME), _T("some_file.cpp"), line, _T("%s trace %u of %d, %.1f%% done"));
+
+    const string name(_T("binary"));
+    for (uint8_t index = 0; index < 2; index++) {
+        site.Push(name, index + 1, 2, 50.0 * (index + 1));
+    }
+
+    auto messages = client.PopMessagesAsList();
+    ASSERT_EQ(messages.size(), 2);
+
+    uint8_t index = 1;
+    for (const auto& message : messages) {
+        string result;
+        message.second->ToString(result);
+
+        ASSERT_EQ(message.first.MessageMetaData(), Core::Messaging::MetaData(Core::Messaging::MetaData::MessageType::TRACING, _T("some_category"), EXPAND_AND_QUOTE(MODULE_NAME)));
+        ASSERT_STREQ(message.first.FileName().c_str(), _T("some_file.cpp"));
+        ASSERT_EQ(message.first.LineNumber(), line);
+        ASSERT_NE(message.first.TimeStamp(), 0);
+        ASSERT_EQ(result, _T("binary trace ") + Core::NumberType<uint8_t>(index).Text() + _T(" of 2, ") + (index == 1 ? _T("50.0") : _T("100.0")) + _T("% done"));
+        index++;
+    }
+}
+
+TEST_F(Core_Messaging_MessageUnit, BinaryTraceIsCheaperToProduceThanTextTrace)
+{
+    const uint32_t batch = 100;
+    const uint32_t batches = 200;
+    Messaging::MessageClient client(DispatcherIdentifier(), DispatcherBasePath());
+    client.AddInstance(0); //we are in framework
+
+    Messaging::TraceFactory factory;
+    client.AddFactory(Core::Messaging::MetaData::MessageType::TRACING, &factory);
+
+    static Messaging::CallSite site(_T("Information"), EXPAND_AND_QUOTE(MODULE_NAME), __FILE__, __LINE__, _T("%s changed to %u after %d ms (%.3f)"));
+
+    //only the tracing side is measured, doing what TRACE and TRACE_FORMAT do once their category is enabled.
+    //the buffer is emptied in between, so nothing gets overwritten
+    const string name(_T("subsystem"));
+    uint64_t timings[2] = { 0, 0 };
+    uint32_t received[2] = { 0, 0 };
+    Core::StopWatch timer;
+
+    for (uint32_t round = 0; round < batches; round++) {
+        timer.Reset();
+        for (uint32_t index = 0; index < batch; index++) {
+            Trace::Information data(_T("%s changed to %u after %d ms (%.3f)"), name.c_str(), index, -42, 0.5);
+            Core::Messaging::Information info(Core::Messaging::MetaData::MessageType::TRACING,
+                Core::ClassNameOnly(typeid(Trace::Information).name()).Text(),
+                EXPAND_AND_QUOTE(MODULE_NAME),
+                __FILE__,
+                __LINE__,
+                Core::Time::Now().Ticks());
+            Messaging::TextMessage message(data.Data());
+            Core::Messaging::MessageUnit::Instance().Push(info, &message);
+        }
+        timings[0] += timer.Elapsed();
+        received[0] += static_cast<uint32_t>(client.PopMessagesAsList().size());
+
+        timer.Reset();
+        for (uint32_t index = 0; index < batch; index++) {
+            site.Push(name, index, -42, 0.5);
+        }
+        timings[1] += timer.Elapsed();
+        received[1] += static_cast<uint32_t>(client.PopMessagesAsList().size());
+    }
+
+    EXPECT_EQ(received[0], batch * batches);
+    EXPECT_EQ(received[1], batch * batches);
+    EXPECT_LT(timings[1], timings[0]);
+
+    printf("%u traces, time spent by the tracing side\n", batch * batches);
+    printf("  TRACE:         %u ns/trace\n", static_cast<uint32_t>((timings[0] * 1000) / (batch * batches)));
+    printf("  TRACE_FORMAT:  %u ns/trace\n", static_cast<uint32_t>((timings[1] * 1000) / (batch * batches)));
+}
+
+TEST_F(Core_Messaging_MessageUnit, InternedInformationIsResolvedPerCallSite)
+{
+    Messaging::MessageClient client(DispatcherIdentifier(), DispatcherBasePath());
+    client.AddInstance(0); //we are in framework
+
+    Messaging::TraceFactory factory;
+    client.AddFactory(Core::Messaging::MetaData::MessageType::TRACING, &factory);
+
+    const Core::Messaging::Information first(Core::Messaging::MetaData::MessageType::TRACING, _T("first_category"), EXPAND_AND_QUOTE(MODULE_NAME), _T("first_file.cpp"), 10, 1000);
+    const Core::Messaging::Information second(Core::Messaging::MetaData::MessageType::TRACING, _T("second_category"), EXPAND_AND_QUOTE(MODULE_NAME), _T("second_file.cpp"), 20, 2000);
+    const Core::Messaging::Information again(Core::Messaging::MetaData::MessageType::TRACING, _T("first_category"), EXPAND_AND_QUOTE(MODULE_NAME), _T("first_file.cpp"), 10, 3000);
+
+    Messaging::TextMessage firstMessage(_T("first"));
+    Messaging::TextMessage secondMessage(_T("second"));
+    Messaging::TextMessage againMessage(_T("again"));
+
+    Core::Messaging::MessageUnit::Instance().Push(first, &firstMessage);
+    Core::Messaging::MessageUnit::Instance().Push(second, &secondMessage);
+    Core::Messaging::MessageUnit::Instance().Push(again, &againMessage);
+
+    auto messages = client.PopMessagesAsList();
+    ASSERT_EQ(messages.size(), 3);
+
+    const Core::Messaging::Information* expected[] = { &first, &second, &again };
+    const TCHAR* texts[] = { _T("first"), _T("second"), _T("again") };
+    uint8_t index = 0;
+
+    for (const auto& message : messages) {
+        string text;
+        message.second->ToString(text);
+
+        EXPECT_EQ(message.first.MessageMetaData(), expected[index]->MessageMetaData());
+        EXPECT_EQ(message.first.FileName(), expected[index]->FileName());
+        EXPECT_EQ(message.first.LineNumber(), expected[index]->LineNumber());
+        EXPECT_EQ(message.first.TimeStamp(), expected[index]->TimeStamp());
+        EXPECT_STREQ(text.c_str(), texts[index]);
+        index++;
+    }
+}
+
+TEST_F(Core_Messaging_MessageUnit, InternedInformationTakesLessRoomInTheDataBuffer)
+{
+    const uint32_t batch = 100;
+    const uint32_t batches = 200;
+    Messaging::MessageClient client(DispatcherIdentifier(), DispatcherBasePath());
+    client.AddInstance(0); //we are in framework
+
+    Messaging::TraceFactory factory;
+    client.AddFactory(Core::Messaging::MetaData::MessageType::TRACING, &factory);
+
+    //a typical trace, where the strings of the information are as long as the text itself
+    Messaging::TextMessage message(_T("Subsystem NETWORK changed to active after 42 ms"));
+    uint8_t buffer[Core::Messaging::MessageUnit::DataSize];
+    uint16_t sizes[2];
+    uint64_t timings[2] = { 0, 0 };
+    uint32_t received[2] = { 0, 0 };
+    Core::StopWatch timer;
+
+    for (uint32_t round = 0; round < batches; round++) {
+        //before: the information in full, in every record
+        timer.Reset();
+        for (uint32_t index = 0; index < batch; index++) {
+            Core::Messaging::Information info(Core::Messaging::MetaData::MessageType::TRACING, _T("Information"), EXPAND_AND_QUOTE(MODULE_NAME), __FILE__, __LINE__, Core::Time::Now().Ticks());
+            sizes[0] = info.Serialize(buffer, sizeof(buffer));
+            sizes[0] += message.Serialize(&buffer[sizes[0]], sizeof(buffer) - sizes[0]);
+            Core::Messaging::MessageUnit::Instance().Push(sizes[0], buffer);
+        }
+        received[0] += static_cast<uint32_t>(client.PopMessagesAsList().size());
+        timings[0] += timer.Elapsed();
+
+        //after: only the number of the information
+        timer.Reset();
+        for (uint32_t index = 0; index < batch; index++) {
+            Core::Messaging::Information info(Core::Messaging::MetaData::MessageType::TRACING, _T("Information"), EXPAND_AND_QUOTE(MODULE_NAME), __FILE__, __LINE__, Core::Time::Now().Ticks());
+            Core::Messaging::MessageUnit::Instance().Push(info, &message);
+        }
+        received[1] += static_cast<uint32_t>(client.PopMessagesAsList().size());
+        timings[1] += timer.Elapsed();
+    }
+
+    sizes[1] = Core::Messaging::MessageUnit::InternedHeaderSize + message.Serialize(buffer, sizeof(buffer));
+
+    EXPECT_EQ(received[0], batch * batches);
+    EXPECT_EQ(received[1], batch * batches);
+    EXPECT_LT(sizes[1], sizes[0]);
+
+    //every record also takes the 2 bytes of its size in the buffer
+    printf("%u messages, pushed and popped through the %u byte data buffer\n", batch * batches, Core::Messaging::MessageUnit::DataSize);
+    printf("  full information:     %u bytes/record, %u records fit, %u msgs/s\n", sizes[0] + 2, Core::Messaging::MessageUnit::DataSize / (sizes[0] + 2), static_cast<uint32_t>((static_cast<uint64_t>(batch) * batches * 1000000) / std::max(timings[0], static_cast<uint64_t>(1))));
+    printf("  interned information: %u bytes/record, %u records fit, %u msgs/s\n", sizes[1] + 2, Core::Messaging::MessageUnit::DataSize / (sizes[1] + 2), static_cast<uint32_t>((static_cast<uint64_t>(batch) * batches * 1000000) / std::max(timings[1], static_cast<uint64_t>(1))));
+}
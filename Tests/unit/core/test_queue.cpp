@@ -39,3 +39,99 @@ TEST(test_queue, simple_queue)
     obj1.Disable();
     obj1.Flush();
 }
+
+TEST(test_queue, fair_queue_classes)
+{
+    FairQueueType<int> queue(20);
+    int result = 0;
+
+    EXPECT_TRUE(queue.Post(1, 2, 0));
+    EXPECT_TRUE(queue.Post(2));
+    EXPECT_TRUE(queue.Insert(3, 300, 0, 0));
+    EXPECT_EQ(queue.Length(), 3u);
+    EXPECT_TRUE(queue.HasEntry(2));
+
+    // Class 0 goes first, class 2 last, no matter the order of posting.
+    EXPECT_TRUE(queue.Extract(result, 0));
+    EXPECT_EQ(result, 3);
+    EXPECT_TRUE(queue.Extract(result, 0));
+    EXPECT_EQ(result, 2);
+    EXPECT_TRUE(queue.Extract(result, 0));
+    EXPECT_EQ(result, 1);
+    EXPECT_FALSE(queue.Extract(result, 0));
+
+    queue.Disable();
+    queue.Flush();
+}
+
+TEST(test_queue, fair_queue_flows)
+{
+    FairQueueType<int> queue(20);
+    int result = 0;
+
+    // Flow 1 floods the queue before flow 2 and 3 post anything.
+    for (int index = 10; index < 16; index++) {
+        EXPECT_TRUE(queue.Post(index, 1, 1));
+    }
+    EXPECT_TRUE(queue.Post(20, 1, 2));
+    EXPECT_TRUE(queue.Post(21, 1, 2));
+    EXPECT_TRUE(queue.Post(30, 1, 3));
+    EXPECT_TRUE(queue.Remove(21));
+
+    const int expected[] = { 10, 20, 30, 11, 12, 13, 14, 15 };
+    for (const int entry : expected) {
+        EXPECT_TRUE(queue.Extract(result, 0));
+        EXPECT_EQ(result, entry);
+    }
+    EXPECT_TRUE(queue.IsEmpty());
+
+    // A quantum of 2, lets flow 1 take two entries per turn.
+    queue.Quantum(1, 2);
+    for (int index = 10; index < 14; index++) {
+        EXPECT_TRUE(queue.Post(index, 1, 1));
+    }
+    EXPECT_TRUE(queue.Post(20, 1, 2));
+    EXPECT_TRUE(queue.Post(21, 1, 2));
+
+    const int weighted[] = { 10, 11, 20, 12, 13, 21 };
+    for (const int entry : weighted) {
+        EXPECT_TRUE(queue.Extract(result, 0));
+        EXPECT_EQ(result, entry);
+    }
+
+    queue.Disable();
+    queue.Flush();
+}
+
+// How many entries go before the single entry of a quiet flow, if a
+// chatty flow has flooded the queue in front of it.
+TEST(test_queue, fair_queue_starvation)
+{
+    static constexpr int Flood = 1000;
+    QueueType<int> fifo(Flood + 1);
+    FairQueueType<int> fair(Flood + 1);
+    uint32_t fifoWait = 0, fairWait = 0;
+    int result = 0;
+
+    for (int index = 0; index < Flood; index++) {
+        fifo.Post(index);
+        fair.Post(index, 1, 1);
+    }
+    fifo.Post(-1);
+    fair.Post(-1, 1, 2);
+
+    while ((fifo.Extract(result, 0) == true) && (result != -1)) {
+        fifoWait++;
+    }
+    while ((fair.Extract(result, 0) == true) && (result != -1)) {
+        fairWait++;
+    }
+
+    EXPECT_EQ(fifoWait, static_cast<uint32_t>(Flood));
+    EXPECT_EQ(fairWait, 1u);
+
+    printf("Quiet flow behind %d entries of a chatty flow, waits for: fifo %u, fair %u\n", Flood, fifoWait, fairWait);
+
+    fifo.Disable();
+    fair.Disable();
+}
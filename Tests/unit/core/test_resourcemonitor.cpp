@@ -0,0 +1,398 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <sys/eventfd.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    typedef Core::ResourceMonitorType<Core::IResource, Core::Void> Monitor;
+
+    class EventResource : public Core::IResource {
+    public:
+        EventResource(const EventResource&) = delete;
+        EventResource& operator=(const EventResource&) = delete;
+
+        EventResource(Core::Event& signal)
+            : _descriptor(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC))
+            , _signal(signal)
+            , _handled(0)
+        {
+        }
+        ~EventResource() override
+        {
+            ::close(_descriptor);
+        }
+
+    public:
+        void Fire()
+        {
+            uint64_t value = 1;
+            ssize_t VARIABLE_IS_NOT_USED size = ::write(_descriptor, &value, sizeof(value));
+        }
+        uint32_t Handled() const
+        {
+            return (_handled);
+        }
+
+        handle Descriptor() const override
+        {
+            return (_descriptor);
+        }
+        uint16_t Events() override
+        {
+            return (POLLIN);
+        }
+        void Handle(const uint16_t events) override
+        {
+            if ((events & POLLIN) != 0) {
+                uint64_t value;
+
+                // Drain it, as required for the edge triggered backend.
+                while (::read(_descriptor, &value, sizeof(value)) > 0) {
+                    _handled++;
+                }
+
+                _signal.SetEvent();
+            }
+        }
+
+    private:
+        int _descriptor;
+        Core::Event& _signal;
+        std::atomic<uint32_t> _handled;
+    };
+
+    static void Unregister(Monitor& monitor, std::list<EventResource*>& resources)
+    {
+        for (EventResource* resource : resources) {
+            monitor.Unregister(*resource);
+        }
+
+        // The monitor thread drops the entries on its next run.
+        uint8_t retries = 100;
+        while ((monitor.Count() != 0) && (--retries != 0)) {
+            ::SleepMs(10);
+        }
+        EXPECT_EQ(monitor.Count(), 0u);
+
+        for (EventResource* resource : resources) {
+            delete resource;
+        }
+        resources.clear();
+    }
+
+    static void CheckDispatch(const Monitor::backend mode)
+    {
+        Core::Event signal(false, true);
+        Monitor monitor(mode);
+        std::list<EventResource*> resources;
+
+        EXPECT_EQ(monitor.Backend(), mode);
+
+        for (uint8_t index = 0; index < 8; index++) {
+            resources.push_back(new EventResource(signal));
+            monitor.Register(*resources.back());
+        }
+
+        EventResource* target = *std::next(resources.begin(), 5);
+
+        for (uint8_t round = 1; round <= 4; round++) {
+            signal.ResetEvent();
+            target->Fire();
+            EXPECT_EQ(signal.Lock(1000), Core::ERROR_NONE);
+            EXPECT_EQ(target->Handled(), round);
+        }
+
+        for (const EventResource* resource : resources) {
+            if (resource != target) {
+                EXPECT_EQ(resource->Handled(), 0u);
+            }
+        }
+
+        // A resource that is unregistered must not be triggered anymore
+        monitor.Unregister(*target);
+        signal.ResetEvent();
+        target->Fire();
+        EXPECT_EQ(signal.Lock(100), Core::ERROR_TIMEDOUT);
+
+        Unregister(monitor, resources);
+    }
+
+    TEST(Core_ResourceMonitor, PollDispatch)
+    {
+        CheckDispatch(Monitor::POLL);
+    }
+
+    TEST(Core_ResourceMonitor, EpollDispatch)
+    {
+        CheckDispatch(Monitor::EPOLL);
+    }
+
+    TEST(Core_ResourceMonitor, EpollEdgeDispatch)
+    {
+        CheckDispatch(Monitor::EPOLL_EDGE);
+    }
+
+    TEST(Core_ResourceMonitor, EpollBreak)
+    {
+        Core::Event signal(false, true);
+        Monitor monitor(Monitor::EPOLL);
+        std::list<EventResource*> resources;
+
+        resources.push_back(new EventResource(signal));
+        monitor.Register(*resources.back());
+
+        // A break revisits all resources, the runs counter should move.
+        uint32_t runs = monitor.Runs();
+        monitor.Break();
+
+        uint8_t retries = 100;
+        while ((monitor.Runs() == runs) && (--retries != 0)) {
+            ::SleepMs(10);
+        }
+        EXPECT_NE(monitor.Runs(), runs);
+
+        Unregister(monitor, resources);
+    }
+
+    // Measures the cost of a single wakeup, one descriptor firing, as a function
+    // of the number of registered descriptors.
+    TEST(Core_ResourceMonitor, WakeupCost)
+    {
+        static constexpr uint16_t Wakeups = 2000;
+        const uint16_t counts[] = { 16, 256, 1024 };
+        const Monitor::backend modes[] = { Monitor::POLL, Monitor::EPOLL, Monitor::EPOLL_EDGE };
+        const TCHAR* names[] = { _T("poll"), _T("epoll"), _T("epoll-edge") };
+
+        for (const uint16_t count : counts) {
+            for (uint8_t mode = 0; mode < (sizeof(modes) / sizeof(modes[0])); mode++) {
+                Core::Event signal(false, true);
+                Monitor monitor(modes[mode]);
+                std::list<EventResource*> resources;
+
+                for (uint16_t index = 0; index < count; index++) {
+                    resources.push_back(new EventResource(signal));
+                    monitor.Register(*resources.back());
+                }
+
+                EventResource* target = resources.back();
+
+                // Let the monitor settle all registrations before measuring.
+                signal.ResetEvent();
+                target->Fire();
+                EXPECT_EQ(signal.Lock(1000), Core::ERROR_NONE);
+
+                Core::StopWatch stopWatch;
+
+                for (uint16_t wakeup = 0; wakeup < Wakeups; wakeup++) {
+                    signal.ResetEvent();
+                    target->Fire();
+                    signal.Lock(1000);
+                }
+
+                uint64_t elapsed = stopWatch.Elapsed();
+
+                EXPECT_EQ(target->Handled(), static_cast<uint32_t>(Wakeups + 1));
+
+                printf("ResourceMonitor %-10s %5d descriptors: %7.2f us/wakeup\n", names[mode], count, static_cast<float>(elapsed) / Wakeups);
+
+                Unregister(monitor, resources);
+            }
+        }
+    }
+
+    class EchoConnection : public Core::SocketStream {
+    public:
+        EchoConnection() = delete;
+        EchoConnection(const EchoConnection&) = delete;
+        EchoConnection& operator=(const EchoConnection&) = delete;
+
+        EchoConnection(const SOCKET& connector, const Core::NodeId& remoteId, Core::SocketServerType<EchoConnection>*)
+            : Core::SocketStream(false, connector, remoteId, 1024, 1024)
+            , _length(0)
+        {
+        }
+        ~EchoConnection() override
+        {
+            Close(Core::infinite);
+        }
+
+    public:
+        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+        {
+            uint16_t result = std::min(_length, maxSendSize);
+
+            ::memcpy(dataFrame, _buffer, result);
+            _length -= result;
+            ::memmove(_buffer, &(_buffer[result]), _length);
+
+            return (result);
+        }
+        uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+        {
+            uint16_t result = std::min(receivedSize, static_cast<uint16_t>(sizeof(_buffer) - _length));
+
+            ::memcpy(&(_buffer[_length]), dataFrame, result);
+            _length += result;
+
+            Trigger();
+
+            return (result);
+        }
+        void StateChange() override
+        {
+        }
+
+    private:
+        uint8_t _buffer[1024];
+        uint16_t _length;
+    };
+
+    class EchoClient : public Core::SocketStream {
+    public:
+        static constexpr uint16_t MessageSize = 64;
+
+        EchoClient() = delete;
+        EchoClient(const EchoClient&) = delete;
+        EchoClient& operator=(const EchoClient&) = delete;
+
+        EchoClient(const Core::NodeId& remoteNode, const uint32_t roundTrips, std::atomic<uint32_t>& pending, Core::Event& done)
+            : Core::SocketStream(false, remoteNode.AnyInterface(), remoteNode, 1024, 1024)
+            , _roundTrips(roundTrips)
+            , _completed(0)
+            , _received(0)
+            , _send(false)
+            , _pending(pending)
+            , _done(done)
+        {
+        }
+        ~EchoClient() override
+        {
+            Close(Core::infinite);
+        }
+
+    public:
+        void Start()
+        {
+            _send = true;
+            Trigger();
+        }
+        uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+        {
+            uint16_t result = 0;
+
+            if ((_send == true) && (maxSendSize >= MessageSize)) {
+                ::memset(dataFrame, 'E', MessageSize);
+                result = MessageSize;
+                _send = false;
+            }
+
+            return (result);
+        }
+        uint16_t ReceiveData(uint8_t* /* dataFrame */, const uint16_t receivedSize) override
+        {
+            _received += receivedSize;
+
+            if (_received >= MessageSize) {
+                _received -= MessageSize;
+
+                if (++_completed < _roundTrips) {
+                    Start();
+                } else if (--_pending == 0) {
+                    _done.SetEvent();
+                }
+            }
+
+            return (receivedSize);
+        }
+        void StateChange() override
+        {
+        }
+
+    private:
+        const uint32_t _roundTrips;
+        uint32_t _completed;
+        uint32_t _received;
+        bool _send;
+        std::atomic<uint32_t>& _pending;
+        Core::Event& _done;
+    };
+
+    // Ping-pong throughput of many concurrent socket streams, both sides of each
+    // connection are served by the ResourceMonitor reactors of this process.
+    TEST(Core_ResourceMonitor, ReactorEchoThroughput)
+    {
+        static constexpr uint16_t Clients = 32;
+        static constexpr uint32_t RoundTrips = 500;
+        const uint8_t reactors[] = { 1, 2, 4, 8 };
+        const Core::NodeId server(_T("/tmp/reactorecho"));
+
+        for (const uint8_t count : reactors) {
+            Core::ResourceMonitor::Configure(count, false);
+
+            EXPECT_EQ(Core::ResourceMonitor::Instance().Reactors(), count);
+            {
+                Core::SocketServerType<EchoConnection> echoServer(server);
+                EXPECT_EQ(echoServer.Open(Core::infinite), Core::ERROR_NONE);
+
+                std::atomic<uint32_t> pending(Clients);
+                Core::Event done(false, true);
+                std::list<EchoClient*> clients;
+
+                for (uint16_t index = 0; index < Clients; index++) {
+                    clients.push_back(new EchoClient(server, RoundTrips, pending, done));
+                    EXPECT_EQ(clients.back()->Open(Core::infinite), Core::ERROR_NONE);
+                }
+
+                Core::StopWatch stopWatch;
+
+                for (EchoClient* client : clients) {
+                    client->Start();
+                }
+
+                EXPECT_EQ(done.Lock(30000), Core::ERROR_NONE);
+
+                uint64_t elapsed = stopWatch.Elapsed();
+
+                printf("ResourceMonitor %d reactor(s), %d clients: %8.0f round trips/s\n", count, Clients,
+                    (static_cast<float>(Clients) * RoundTrips * Core::Time::MicroSecondsPerSecond) / static_cast<float>(elapsed));
+
+                // Initiate all closures first, so we do not wait for them one by one.
+                for (EchoClient* client : clients) {
+                    client->Close(0);
+                }
+                for (EchoClient* client : clients) {
+                    delete client;
+                }
+
+                echoServer.Close(Core::infinite);
+            }
+            Core::Singleton::Dispose();
+        }
+
+        Core::ResourceMonitor::Configure(1, false);
+    }
+
+} // Tests
+} // WPEFramework
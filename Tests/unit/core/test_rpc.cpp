@@ -33,6 +33,22 @@ namespace Exchange {
         virtual void Add(uint32_t value) = 0;
         virtual uint32_t GetPid() = 0;
     };
+
+    struct IBlob : virtual public Core::IUnknown {
+        enum { ID = 0x80000002 };
+        virtual uint32_t Checksum(const uint32_t length, const uint8_t buffer[] /* @in @length:length */) const = 0;
+        virtual uint32_t Fill(const uint8_t seed, const uint32_t length, uint8_t buffer[] /* @out @length:length */) const = 0;
+        virtual uint32_t Invert(const uint32_t length, uint8_t buffer[] /* @inout @length:length */) const = 0;
+    };
+
+    struct IListener : virtual public Core::IUnknown {
+        enum { ID = 0x80000003 };
+        virtual void Changed(const uint32_t sequence) = 0;
+        // @oneway
+        virtual void Signaled(const uint32_t sequence) = 0;
+        virtual uint32_t Received() const = 0;
+        virtual void Reset() = 0;
+    };
 } // Exchange
 
 namespace Tests {
@@ -68,6 +84,81 @@ namespace Tests {
         uint32_t m_value;
     };
 
+    class Blob : public Exchange::IBlob
+    {
+    public:
+        Blob() = default;
+
+        static uint32_t Sum(const uint32_t length, const uint8_t buffer[])
+        {
+            uint32_t result = 0;
+            for (uint32_t index = 0; index < length; index++) {
+                result = (result * 31) + buffer[index];
+            }
+            return (result);
+        }
+        uint32_t Checksum(const uint32_t length, const uint8_t buffer[]) const override
+        {
+            return (Sum(length, buffer));
+        }
+        uint32_t Fill(const uint8_t seed, const uint32_t length, uint8_t buffer[]) const override
+        {
+            for (uint32_t index = 0; index < length; index++) {
+                buffer[index] = static_cast<uint8_t>(seed + index);
+            }
+            return (Core::ERROR_NONE);
+        }
+        uint32_t Invert(const uint32_t length, uint8_t buffer[]) const override
+        {
+            for (uint32_t index = 0; index < length; index++) {
+                buffer[index] = ~buffer[index];
+            }
+            return (Core::ERROR_NONE);
+        }
+
+        BEGIN_INTERFACE_MAP(Blob)
+            INTERFACE_ENTRY(Exchange::IBlob)
+        END_INTERFACE_MAP
+    };
+
+    class Listener : public Exchange::IListener
+    {
+    public:
+        Listener()
+            : _received(0)
+        {
+        }
+
+        // Only notifications that arrive in the order they were sent, are counted.
+        void Changed(const uint32_t sequence) override
+        {
+            if (sequence == _received) {
+                _received++;
+            }
+        }
+        void Signaled(const uint32_t sequence) override
+        {
+            if (sequence == _received) {
+                _received++;
+            }
+        }
+        uint32_t Received() const override
+        {
+            return (_received);
+        }
+        void Reset() override
+        {
+            _received = 0;
+        }
+
+        BEGIN_INTERFACE_MAP(Listener)
+            INTERFACE_ENTRY(Exchange::IListener)
+        END_INTERFACE_MAP
+
+    private:
+        std::atomic<uint32_t> _received;
+    };
+
     // Proxystubs.
     using namespace Exchange;
 
@@ -133,6 +224,164 @@ namespace Tests {
         nullptr
     }; // AdderStubMethods[]
 
+    //
+    // IBlob interface stub definitions
+    //
+    // Methods:
+    //  (0) virtual uint32_t Checksum(const uint32_t, const uint8_t*) const = 0
+    //  (1) virtual uint32_t Fill(const uint8_t, const uint32_t, uint8_t*) const = 0
+    //  (2) virtual uint32_t Invert(const uint32_t, uint8_t*) const = 0
+    //
+
+    ProxyStub::MethodHandler BlobStubMethods[] = {
+        // virtual uint32_t Checksum(const uint32_t, const uint8_t*) const = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint8_t* param1 = nullptr;
+            uint32_t param1_length = input.Buffer(reader, param1);
+
+            // call implementation
+            const IBlob* implementation = reinterpret_cast<const IBlob*>(input.Implementation());
+            EXPECT_TRUE((implementation != nullptr) && "Null IBlob implementation pointer");
+            const uint32_t output = implementation->Checksum(param1_length, param1);
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+        },
+
+        // virtual uint32_t Fill(const uint8_t, const uint32_t, uint8_t*) const = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint8_t param0 = reader.Number<uint8_t>();
+            const uint32_t param2_length = reader.Number<uint32_t>();
+            uint8_t* param2_reserved = input.Reserved(reader);
+
+            // allocate receive buffer
+            uint8_t* param2{};
+            param2 = param2_reserved;
+            if ((param2 == nullptr) && (param2_length != 0)) {
+                ASSERT((param2_length < 0x10000) && "Buffer length too big");
+                param2 = static_cast<uint8_t*>(ALLOCA(param2_length));
+                ASSERT(param2 != nullptr);
+            }
+
+            // call implementation
+            const IBlob* implementation = reinterpret_cast<const IBlob*>(input.Implementation());
+            EXPECT_TRUE((implementation != nullptr) && "Null IBlob implementation pointer");
+            const uint32_t output = implementation->Fill(param0, param2_length, param2);
+
+            // write return values
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+            input.Buffer(writer, (param2 != nullptr ? param2_length : 0), param2);
+        },
+
+        // virtual uint32_t Invert(const uint32_t, uint8_t*) const = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint8_t* param1 = nullptr;
+            uint32_t param1_length = input.Buffer(reader, param1);
+
+            uint8_t* param1_buffer{};
+            param1_buffer = const_cast<uint8_t*>(param1); // reuse the input buffer
+
+            // call implementation
+            const IBlob* implementation = reinterpret_cast<const IBlob*>(input.Implementation());
+            EXPECT_TRUE((implementation != nullptr) && "Null IBlob implementation pointer");
+            const uint32_t output = implementation->Invert(param1_length, param1_buffer);
+
+            // write return values
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+            input.Buffer(writer, (param1_buffer != nullptr ? param1_length : 0), param1_buffer);
+        },
+
+        nullptr
+    }; // BlobStubMethods[]
+
+    //
+    // IListener interface stub definitions
+    //
+    // Methods:
+    //  (0) virtual void Changed(const uint32_t) = 0
+    //  (1) virtual void Signaled(const uint32_t) = 0
+    //  (2) virtual uint32_t Received() const = 0
+    //  (3) virtual void Reset() = 0
+    //
+
+    ProxyStub::MethodHandler ListenerStubMethods[] = {
+        // virtual void Changed(const uint32_t) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint32_t param0 = reader.Number<uint32_t>();
+
+            // call implementation
+            IListener* implementation = reinterpret_cast<IListener*>(input.Implementation());
+            ASSERT((implementation != nullptr) && "Null IListener implementation pointer");
+            implementation->Changed(param0);
+        },
+
+        // virtual void Signaled(const uint32_t) = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // read parameters
+            RPC::Data::Frame::Reader reader(input.Reader());
+            const uint32_t param0 = reader.Number<uint32_t>();
+
+            // call implementation
+            IListener* implementation = reinterpret_cast<IListener*>(input.Implementation());
+            ASSERT((implementation != nullptr) && "Null IListener implementation pointer");
+            implementation->Signaled(param0);
+        },
+
+        // virtual uint32_t Received() const = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // call implementation
+            const IListener* implementation = reinterpret_cast<const IListener*>(input.Implementation());
+            ASSERT((implementation != nullptr) && "Null IListener implementation pointer");
+            const uint32_t output = implementation->Received();
+
+            // write return value
+            RPC::Data::Frame::Writer writer(message->Response().Writer());
+            writer.Number<const uint32_t>(output);
+        },
+
+        // virtual void Reset() = 0
+        //
+        [](Core::ProxyType<Core::IPCChannel>& channel VARIABLE_IS_NOT_USED, Core::ProxyType<RPC::InvokeMessage>& message) {
+            RPC::Data::Input& input(message->Parameters());
+
+            // call implementation
+            IListener* implementation = reinterpret_cast<IListener*>(input.Implementation());
+            ASSERT((implementation != nullptr) && "Null IListener implementation pointer");
+            implementation->Reset();
+        },
+
+        nullptr
+    }; // ListenerStubMethods[]
+
     // -----------------------------------------------------------------
     // PROXY
     // -----------------------------------------------------------------
@@ -196,6 +445,149 @@ namespace Tests {
         }
     }; // class AdderProxy
 
+    //
+    // IBlob interface proxy definitions
+    //
+    // Methods:
+    //  (0) virtual uint32_t Checksum(const uint32_t, const uint8_t*) const = 0
+    //  (1) virtual uint32_t Fill(const uint8_t, const uint32_t, uint8_t*) const = 0
+    //  (2) virtual uint32_t Invert(const uint32_t, uint8_t*) const = 0
+    //
+
+    class BlobProxy final : public ProxyStub::UnknownProxyType<IBlob> {
+    public:
+        BlobProxy(const Core::ProxyType<Core::IPCChannel>& channel, RPC::instance_id implementation, const bool otherSideInformed)
+            : BaseClass(channel, implementation, otherSideInformed)
+        {
+        }
+
+        uint32_t Checksum(const uint32_t param0, const uint8_t* param1) const override
+        {
+            IPCMessage newMessage(BaseClass::Message(0));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            newMessage->Parameters().Buffer(writer, param0, param1);
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+            }
+
+            return output;
+        }
+
+        uint32_t Fill(const uint8_t param0, const uint32_t param1, uint8_t* /* out */ param2) const override
+        {
+            IPCMessage newMessage(BaseClass::Message(1));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<const uint8_t>(param0);
+            writer.Number<const uint32_t>(param1);
+            newMessage->Parameters().Reserve(writer, param1);
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return values
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+                newMessage->Parameters().Buffer(reader, ((param2 != 0) ? param1 : 0), param2);
+            }
+
+            return output;
+        }
+
+        uint32_t Invert(const uint32_t param0, uint8_t* /* inout */ param1) const override
+        {
+            IPCMessage newMessage(BaseClass::Message(2));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            newMessage->Parameters().Buffer(writer, param0, param1);
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return values
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+                newMessage->Parameters().Buffer(reader, ((param1 != 0) ? param0 : 0), param1);
+            }
+
+            return output;
+        }
+    }; // class BlobProxy
+
+    //
+    // IListener interface proxy definitions
+    //
+    // Methods:
+    //  (0) virtual void Changed(const uint32_t) = 0
+    //  (1) virtual void Signaled(const uint32_t) = 0
+    //  (2) virtual uint32_t Received() const = 0
+    //  (3) virtual void Reset() = 0
+    //
+
+    class ListenerProxy final : public ProxyStub::UnknownProxyType<IListener> {
+    public:
+        ListenerProxy(const Core::ProxyType<Core::IPCChannel>& channel, RPC::instance_id implementation, const bool otherSideInformed)
+            : BaseClass(channel, implementation, otherSideInformed)
+        {
+        }
+
+        void Changed(const uint32_t param0) override
+        {
+            IPCMessage newMessage(BaseClass::Message(0));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<const uint32_t>(param0);
+
+            // invoke the method handler
+            Invoke(newMessage);
+        }
+
+        void Signaled(const uint32_t param0) override
+        {
+            IPCMessage newMessage(BaseClass::Message(1));
+
+            // write parameters
+            RPC::Data::Frame::Writer writer(newMessage->Parameters().Writer());
+            writer.Number<const uint32_t>(param0);
+
+            // post the method call, no response is expected
+            BaseClass::Post(newMessage);
+        }
+
+        uint32_t Received() const override
+        {
+            IPCMessage newMessage(BaseClass::Message(2));
+
+            // invoke the method handler
+            uint32_t output{};
+            if ((output = Invoke(newMessage)) == Core::ERROR_NONE) {
+                // read return value
+                RPC::Data::Frame::Reader reader(newMessage->Response().Reader());
+                output = reader.Number<uint32_t>();
+            }
+
+            return output;
+        }
+
+        void Reset() override
+        {
+            IPCMessage newMessage(BaseClass::Message(3));
+
+            // invoke the method handler
+            Invoke(newMessage);
+        }
+    }; // class ListenerProxy
+
     // -----------------------------------------------------------------
     // REGISTRATION
     // -----------------------------------------------------------------
@@ -203,12 +595,16 @@ namespace Tests {
     namespace {
 
         typedef ProxyStub::UnknownStubType<IAdder, AdderStubMethods> AdderStub;
+        typedef ProxyStub::UnknownStubType<IBlob, BlobStubMethods> BlobStub;
+        typedef ProxyStub::UnknownStubType<IListener, ListenerStubMethods> ListenerStub;
 
         static class Instantiation {
         public:
             Instantiation()
             {
                 RPC::Administrator::Instance().Announce<IAdder, AdderProxy, AdderStub>();
+                RPC::Administrator::Instance().Announce<IBlob, BlobProxy, BlobStub>();
+                RPC::Administrator::Instance().Announce<IListener, ListenerProxy, ListenerStub>();
             }
         } ProxyStubRegistration;
 
@@ -241,6 +637,10 @@ namespace Tests {
                 if (interfaceId == Exchange::IAdder::ID) {
                     Exchange::IAdder * newAdder = Core::Service<Adder>::Create<Exchange::IAdder>();
                     result = newAdder;
+                } else if (interfaceId == Exchange::IBlob::ID) {
+                    result = Core::Service<Blob>::Create<Exchange::IBlob>();
+                } else if (interfaceId == Exchange::IListener::ID) {
+                    result = Core::Service<Listener>::Create<Exchange::IListener>();
                 }
 
                 return result;
@@ -301,5 +701,178 @@ namespace Tests {
        testAdmin.Sync("done testing");
        Core::Singleton::Dispose();
     }
+
+    TEST(Core_RPC, largeBuffer)
+    {
+       std::string connector{"/tmp/wperpc02"};
+       auto lambdaFunc = [connector](IPTestAdministrator & testAdmin) {
+          Core::NodeId remoteNode(connector.c_str());
+
+          ExternalAccess communicator(remoteNode);
+
+          testAdmin.Sync("setup server");
+
+          testAdmin.Sync("done testing");
+
+          communicator.Close(Core::infinite);
+       };
+
+       static std::function<void (IPTestAdministrator&)> lambdaVar = lambdaFunc;
+
+       IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator& testAdmin ) { lambdaVar(testAdmin); };
+
+       IPTestAdministrator testAdmin(otherSide);
+
+       testAdmin.Sync("setup server");
+
+       {
+          Core::NodeId remoteNode(connector.c_str());
+
+          Core::ProxyType<RPC::InvokeServerType<4, 0, 1>> engine = Core::ProxyType<RPC::InvokeServerType<4, 0, 1>>::Create();
+          EXPECT_TRUE(engine.IsValid());
+          Core::ProxyType<RPC::CommunicatorClient> client = Core::ProxyType<RPC::CommunicatorClient>::Create(remoteNode, Core::ProxyType<Core::IIPCServer>(engine));
+          EXPECT_TRUE(client.IsValid());
+          engine->Announcements(client->Announcement());
+
+          Exchange::IBlob* blob = client->Open<Exchange::IBlob>(_T("Blob"));
+          ASSERT_TRUE(blob != nullptr);
+
+          // Below and above the threshold: in the frame and through the shared region.
+          for (const uint32_t size : { static_cast<uint32_t>(1024), static_cast<uint32_t>(512 * 1024) }) {
+             std::vector<uint8_t> buffer(size);
+             for (uint32_t index = 0; index < size; index++) {
+                buffer[index] = static_cast<uint8_t>(index * 7);
+             }
+
+             EXPECT_EQ(blob->Checksum(size, buffer.data()), Blob::Sum(size, buffer.data()));
+
+             std::vector<uint8_t> filled(size, 0);
+             EXPECT_EQ(blob->Fill(3, size, filled.data()), Core::ERROR_NONE);
+             EXPECT_EQ(filled[0], 3);
+             EXPECT_EQ(filled[size - 1], static_cast<uint8_t>(3 + (size - 1)));
+
+             EXPECT_EQ(blob->Invert(size, buffer.data()), Core::ERROR_NONE);
+             EXPECT_EQ(buffer[1], static_cast<uint8_t>(~7));
+             EXPECT_EQ(buffer[size - 1], static_cast<uint8_t>(~((size - 1) * 7)));
+          }
+
+          uint32_t iterations = 100;
+          std::vector<uint8_t> payload(512 * 1024, 0x5A);
+          Core::StopWatch timer;
+          for (uint32_t index = 0; index < iterations; index++) {
+             blob->Checksum(static_cast<uint32_t>(payload.size()), payload.data());
+          }
+          printf("Checksum of %u Kb through the shared region: %u us/call\n", static_cast<uint32_t>(payload.size() / 1024), static_cast<uint32_t>(timer.Elapsed() / iterations));
+
+          blob->Release();
+
+          client->Close(Core::infinite);
+       }
+
+       testAdmin.Sync("done testing");
+       Core::Singleton::Dispose();
+    }
+
+    static bool WaitForReceived(Exchange::IListener* listener, const uint32_t expected)
+    {
+       // One-way notifications are not waited for, so poll until the last one got handled.
+       uint32_t waited = 0;
+       while ((listener->Received() != expected) && (waited < 10000)) {
+          SleepMs(1);
+          waited++;
+       }
+       return (listener->Received() == expected);
+    }
+
+    TEST(Core_RPC, oneWayNotifications)
+    {
+       std::string connector{"/tmp/wperpc03"};
+       auto lambdaFunc = [connector](IPTestAdministrator & testAdmin) {
+          Core::NodeId remoteNode(connector.c_str());
+
+          ExternalAccess communicator(remoteNode);
+
+          testAdmin.Sync("setup server");
+
+          testAdmin.Sync("done testing");
+
+          communicator.Close(Core::infinite);
+       };
+
+       static std::function<void (IPTestAdministrator&)> lambdaVar = lambdaFunc;
+
+       IPTestAdministrator::OtherSideMain otherSide = [](IPTestAdministrator& testAdmin ) { lambdaVar(testAdmin); };
+
+       IPTestAdministrator testAdmin(otherSide);
+
+       testAdmin.Sync("setup server");
+
+       {
+          Core::NodeId remoteNode(connector.c_str());
+
+          Core::ProxyType<RPC::InvokeServerType<4, 0, 1>> engine = Core::ProxyType<RPC::InvokeServerType<4, 0, 1>>::Create();
+          EXPECT_TRUE(engine.IsValid());
+          Core::ProxyType<RPC::CommunicatorClient> client = Core::ProxyType<RPC::CommunicatorClient>::Create(remoteNode, Core::ProxyType<Core::IIPCServer>(engine));
+          EXPECT_TRUE(client.IsValid());
+          engine->Announcements(client->Announcement());
+
+          Exchange::IListener* listener = client->Open<Exchange::IListener>(_T("Listener"));
+          ASSERT_TRUE(listener != nullptr);
+
+          const uint32_t notifications = 2000;
+          Core::StopWatch timer;
+
+          // Every notification is a round trip.
+          for (uint32_t index = 0; index < notifications; index++) {
+             listener->Changed(index);
+          }
+          EXPECT_EQ(listener->Received(), notifications);
+          const uint64_t twoWay = timer.Elapsed();
+
+          // Every notification is a message, but nobody waits for it.
+          listener->Reset();
+          timer.Reset();
+          for (uint32_t index = 0; index < notifications; index++) {
+             listener->Signaled(index);
+          }
+          EXPECT_TRUE(WaitForReceived(listener, notifications));
+          const uint64_t oneWay = timer.Elapsed();
+
+          // The notifications are collected in as few messages as possible.
+          listener->Reset();
+          timer.Reset();
+          {
+             RPC::BatchScope batch;
+
+             for (uint32_t index = 0; index < notifications; index++) {
+                listener->Signaled(index);
+             }
+          }
+          EXPECT_TRUE(WaitForReceived(listener, notifications));
+          const uint64_t batched = timer.Elapsed();
+
+          // A two-way call sends out what is collected for its channel first.
+          listener->Reset();
+          {
+             RPC::BatchScope batch;
+
+             listener->Signaled(0);
+             listener->Signaled(1);
+             listener->Changed(2);
+             listener->Signaled(3);
+          }
+          EXPECT_TRUE(WaitForReceived(listener, 4));
+
+          printf("%u notifications, two-way: %u us, one-way: %u us, batched: %u us\n", notifications,
+             static_cast<uint32_t>(twoWay), static_cast<uint32_t>(oneWay), static_cast<uint32_t>(batched));
+
+          listener->Release();
+
+          client->Close(Core::infinite);
+       }
+
+       testAdmin.Sync("done testing");
+       Core::Singleton::Dispose();
+    }
 } // Tests
 } // WPEFramework
@@ -0,0 +1,247 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    namespace {
+
+        const TCHAR localhost[] = _T("127.0.0.1");
+        const uint16_t portNumber = 9761;
+        const uint16_t datagramSize = 256;
+
+        class DatagramReceiver : public Core::SocketDatagram {
+        public:
+            DatagramReceiver() = delete;
+            DatagramReceiver(const DatagramReceiver&) = delete;
+            DatagramReceiver& operator=(const DatagramReceiver&) = delete;
+
+            DatagramReceiver(const uint16_t port, const uint8_t batch)
+                : Core::SocketDatagram(false, Core::NodeId(localhost, port, Core::NodeId::TYPE_IPV4), Core::NodeId(), 1024, 1024, 1024 * 1024, 1024 * 1024)
+                , _done(false, true)
+                , _expected(0)
+                , _received(0)
+                , _outOfOrder(0)
+                , _listener(nullptr)
+            {
+                Batch(batch);
+            }
+            ~DatagramReceiver() override
+            {
+                Close(Core::infinite);
+            }
+
+        public:
+            void Expect(const uint32_t count, Core::SocketDatagram* listener)
+            {
+                _expected = count;
+                _listener = listener;
+            }
+            bool Wait(const uint32_t time)
+            {
+                return (_done.Lock(time) == Core::ERROR_NONE);
+            }
+            uint32_t Received() const
+            {
+                return (_received);
+            }
+            uint32_t OutOfOrder() const
+            {
+                return (_outOfOrder);
+            }
+
+            uint16_t SendData(uint8_t* /* dataFrame */, const uint16_t /* maxSendSize */) override
+            {
+                return (0);
+            }
+            uint16_t ReceiveData(uint8_t* dataFrame, const uint16_t receivedSize) override
+            {
+                uint32_t sequence;
+
+                ::memcpy(&sequence, dataFrame, sizeof(sequence));
+
+                if ((receivedSize != datagramSize) || (sequence != _received)) {
+                    _outOfOrder++;
+                }
+
+                _received++;
+
+                if (_received == _expected) {
+                    _done.SetEvent();
+                } else if ((_listener != nullptr) && ((_received % 64) == 0)) {
+                    // Room for more.
+                    _listener->Trigger();
+                }
+
+                return (receivedSize);
+            }
+            void StateChange() override
+            {
+            }
+
+        private:
+            Core::Event _done;
+            uint32_t _expected;
+            std::atomic<uint32_t> _received;
+            uint32_t _outOfOrder;
+            Core::SocketDatagram* _listener;
+        };
+
+        // Sends numbered datagrams, round robin to the receivers, with no more than a window of them in flight.
+        class DatagramSender : public Core::SocketDatagram {
+        public:
+            static constexpr uint32_t Window = 512;
+
+        public:
+            DatagramSender() = delete;
+            DatagramSender(const DatagramSender&) = delete;
+            DatagramSender& operator=(const DatagramSender&) = delete;
+
+            DatagramSender(const std::vector<DatagramReceiver*>& receivers, const uint8_t batch)
+                : Core::SocketDatagram(false, Core::NodeId(localhost, 0, Core::NodeId::TYPE_IPV4), receivers[0]->LocalNode(), 1024, 1024, 1024 * 1024, 1024 * 1024)
+                , _receivers(receivers)
+                , _total(0)
+                , _sent(0)
+            {
+                Batch(batch);
+            }
+            ~DatagramSender() override
+            {
+                Close(Core::infinite);
+            }
+
+        public:
+            void Send(const uint32_t count)
+            {
+                _total = count;
+                Trigger();
+            }
+
+            uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+            {
+                uint16_t result = 0;
+                uint32_t received = 0;
+
+                for (const DatagramReceiver* receiver : _receivers) {
+                    received += receiver->Received();
+                }
+
+                if ((_sent < _total) && ((_sent - received) < Window)) {
+                    const uint32_t sequence = _sent / static_cast<uint32_t>(_receivers.size());
+
+                    EXPECT_GE(maxSendSize, datagramSize);
+
+                    RemoteNode(_receivers[_sent % _receivers.size()]->LocalNode());
+
+                    ::memset(dataFrame, static_cast<uint8_t>(_sent), datagramSize);
+                    ::memcpy(dataFrame, &sequence, sizeof(sequence));
+
+                    result = datagramSize;
+                    _sent++;
+                }
+
+                return (result);
+            }
+            uint16_t ReceiveData(uint8_t* /* dataFrame */, const uint16_t receivedSize) override
+            {
+                return (receivedSize);
+            }
+            void StateChange() override
+            {
+            }
+
+        private:
+            const std::vector<DatagramReceiver*>& _receivers;
+            uint32_t _total;
+            uint32_t _sent;
+        };
+
+        // Time it takes to get count datagrams across, in us, 0 if they did not all make it.
+        uint64_t Transfer(const uint8_t receiverCount, const uint32_t count, const uint8_t batch)
+        {
+            std::vector<DatagramReceiver*> receivers;
+            uint64_t result = 0;
+            bool completed = true;
+
+            for (uint8_t index = 0; index < receiverCount; index++) {
+                receivers.push_back(new DatagramReceiver(portNumber + index, batch));
+                EXPECT_EQ(receivers.back()->Open(0), Core::ERROR_NONE);
+            }
+
+            {
+                DatagramSender sender(receivers, batch);
+                EXPECT_EQ(sender.Open(0), Core::ERROR_NONE);
+
+                for (DatagramReceiver* receiver : receivers) {
+                    receiver->Expect(count / receiverCount, &sender);
+                }
+
+                Core::StopWatch timer;
+                sender.Send(count);
+
+                for (DatagramReceiver* receiver : receivers) {
+                    completed = (receiver->Wait(10000) == true) && (completed == true);
+                }
+                result = timer.Elapsed();
+
+                for (DatagramReceiver* receiver : receivers) {
+                    EXPECT_EQ(receiver->Received(), count / receiverCount);
+                    EXPECT_EQ(receiver->OutOfOrder(), 0u);
+                    receiver->Expect(0, nullptr);
+                }
+            }
+
+            for (DatagramReceiver* receiver : receivers) {
+                delete receiver;
+            }
+
+            return (completed == true ? result : 0);
+        }
+    }
+
+    TEST(Core_SocketPort, BatchedDatagrams)
+    {
+        // Every datagram goes to where the RemoteNode pointed at when it was produced.
+        EXPECT_NE(Transfer(2, 200, 8), 0u);
+        EXPECT_NE(Transfer(3, 300, 32), 0u);
+    }
+
+    TEST(Core_SocketPort, BatchedDatagramThroughput)
+    {
+        const uint32_t count = 50000;
+        const uint64_t single = Transfer(1, count, 1);
+        const uint64_t batched = Transfer(1, count, 32);
+
+        EXPECT_NE(single, 0u);
+        EXPECT_NE(batched, 0u);
+
+        if ((single != 0) && (batched != 0)) {
+            printf("%u datagrams of %u bytes over loopback, at most %u in flight\n", count, datagramSize, DatagramSender::Window);
+            printf("  one per system call: %u datagrams/s\n", static_cast<uint32_t>((count * 1000000ull) / single));
+            printf("  batches of 32:       %u datagrams/s\n", static_cast<uint32_t>((count * 1000000ull) / batched));
+        }
+    }
+
+} // Tests
+} // WPEFramework
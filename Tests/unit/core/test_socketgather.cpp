@@ -0,0 +1,273 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    namespace {
+
+        typedef Web::JSONBodyType<Core::JSONRPC::Message> ResponseBody;
+
+        // Sends the same response a number of times, through the send buffer or with the body gathered.
+        class ResponseStream : public Core::SocketStream {
+        private:
+            class Serializer : public Web::Response::Serializer {
+            public:
+                Serializer() = delete;
+                Serializer(const Serializer&) = delete;
+                Serializer& operator=(const Serializer&) = delete;
+
+                Serializer(ResponseStream& parent)
+                    : Web::Response::Serializer()
+                    , _parent(parent)
+                {
+                }
+                ~Serializer() override = default;
+
+            private:
+                void Serialized(const Web::Response& /* element */) override
+                {
+                    _parent.Serialized();
+                }
+
+            private:
+                ResponseStream& _parent;
+            };
+
+        public:
+            ResponseStream() = delete;
+            ResponseStream(const ResponseStream&) = delete;
+            ResponseStream& operator=(const ResponseStream&) = delete;
+
+            PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
+            ResponseStream(const SOCKET connector, const bool gather)
+                : Core::SocketStream(false, connector, Core::NodeId(), 8 * 1024, 1024)
+                , _serializer(*this)
+                , _response()
+                , _gather(gather)
+                , _pending(0)
+                , _writes(0)
+            {
+            }
+            POP_WARNING()
+            ~ResponseStream() override
+            {
+                Close(Core::infinite);
+            }
+
+        public:
+            void Send(const Web::Response& response, const uint32_t count)
+            {
+                _response = &response;
+                _pending = count;
+                _serializer.Submit(response);
+                Trigger();
+            }
+
+            uint16_t SendData(uint8_t* dataFrame, const uint16_t maxSendSize) override
+            {
+                return (_serializer.Serialize(dataFrame, maxSendSize));
+            }
+            uint16_t GatherData(uint8_t* dataFrame, const uint16_t maxSendSize, Segment segments[], uint8_t& count) override
+            {
+                uint16_t result;
+
+                if (_gather == false) {
+                    result = Core::SocketStream::GatherData(dataFrame, maxSendSize, segments, count);
+                } else {
+                    result = _serializer.Serialize(dataFrame, maxSendSize, segments[0]);
+                    count = (segments[0].Length != 0 ? 1 : 0);
+                }
+
+                return (result);
+            }
+            uint16_t ReceiveData(uint8_t* /* dataFrame */, const uint16_t receivedSize) override
+            {
+                return (receivedSize);
+            }
+            void StateChange() override
+            {
+            }
+            uint32_t Writes() const
+            {
+                return (_writes);
+            }
+
+        protected:
+            int32_t Write(const uint8_t buffer[], const uint16_t length) override
+            {
+                _writes++;
+                return (Core::SocketStream::Write(buffer, length));
+            }
+            int32_t Write(const Segment segments[], const uint8_t count) override
+            {
+                _writes++;
+                return (Core::SocketStream::Write(segments, count));
+            }
+
+        private:
+            void Serialized()
+            {
+                if (--_pending != 0) {
+                    _serializer.Submit(*_response);
+                }
+            }
+
+        private:
+            Serializer _serializer;
+            const Web::Response* _response;
+            bool _gather;
+            uint32_t _pending;
+            uint32_t _writes;
+        };
+
+        // Read what comes in on the other end of the socket, until there is nothing more for a while.
+        string Receive(const SOCKET socket, const uint32_t expected)
+        {
+            string result;
+            char buffer[16 * 1024];
+            bool timedOut = false;
+
+            while ((result.length() < expected) && (timedOut == false)) {
+                struct pollfd descriptor = { socket, POLLIN, 0 };
+
+                if (::poll(&descriptor, 1, 2000) <= 0) {
+                    timedOut = true;
+                } else {
+                    const ssize_t size = ::recv(socket, buffer, sizeof(buffer), 0);
+
+                    if (size > 0) {
+                        result.append(buffer, size);
+                    } else {
+                        timedOut = true;
+                    }
+                }
+            }
+
+            return (result);
+        }
+
+        // What the response looks like on the wire.
+        string Flatten(const Web::Response& response)
+        {
+            class Flat : public Web::Response::Serializer {
+            public:
+                Flat(const Flat&) = delete;
+                Flat& operator=(const Flat&) = delete;
+
+                Flat() = default;
+                ~Flat() override = default;
+
+            private:
+                void Serialized(const Web::Response& /* element */) override
+                {
+                }
+            } serializer;
+
+            string result;
+            uint8_t buffer[1024];
+            uint16_t size;
+
+            serializer.Submit(response);
+
+            while ((size = serializer.Serialize(buffer, sizeof(buffer))) != 0) {
+                result.append(reinterpret_cast<const char*>(buffer), size);
+            }
+
+            return (result);
+        }
+
+        string Result(const uint32_t size)
+        {
+            string result(_T("["));
+
+            for (uint32_t index = 0; result.length() < size; index++) {
+                result += (index == 0 ? _T("") : _T(","));
+                result += _T("{\"index\":") + std::to_string(index) + _T(",\"name\":\"element ") + std::to_string(index) + _T("\"}");
+            }
+
+            return (result + _T("]"));
+        }
+    }
+
+    TEST(Core_SocketPort, GatherJsonResponse)
+    {
+        const uint32_t iterations = 500;
+
+        Core::ProxyType<ResponseBody> json(Core::ProxyType<ResponseBody>::Create());
+        json->Id = 1;
+        json->Result = Result(64 * 1024);
+
+        // The same, serialized up front.
+        Core::ProxyType<Web::TextBody> text(Core::ProxyType<Web::TextBody>::Create());
+        json->ToString(static_cast<string&>(*text));
+
+        for (uint8_t type = 0; type < 2; type++) {
+            Web::Response response;
+            response.ErrorCode = Web::STATUS_OK;
+            response.ContentType = Web::MIMETypes::MIME_JSON;
+            if (type == 0) {
+                response.Body(json);
+            } else {
+                response.Body(text);
+            }
+
+            const string expected(Flatten(response));
+            uint64_t timings[2];
+            uint32_t writes[2];
+
+            EXPECT_GT(expected.length(), 64u * 1024u);
+
+            for (uint8_t run = 0; run < 2; run++) {
+                int sockets[2];
+                ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets), 0);
+
+                {
+                    ResponseStream stream(sockets[0], (run == 1));
+                    EXPECT_EQ(stream.Open(0), Core::ERROR_NONE);
+
+                    Core::StopWatch timer;
+                    stream.Send(response, iterations);
+                    const string received(Receive(sockets[1], static_cast<uint32_t>(expected.length() * iterations)));
+                    timings[run] = timer.Elapsed();
+                    writes[run] = stream.Writes();
+
+                    // All there, in the right order.
+                    EXPECT_EQ(received.length(), expected.length() * iterations);
+                    EXPECT_EQ(received.compare(0, expected.length(), expected), 0);
+                    EXPECT_EQ(received.compare(received.length() - expected.length(), expected.length(), expected), 0);
+                }
+
+                ::close(sockets[1]);
+            }
+
+            printf("%u 64 Kb JSON responses of %u bytes, %s\n", iterations, static_cast<uint32_t>(expected.length()), (type == 0 ? "JSON body" : "text body"));
+            printf("  through the send buffer: %u us/response, %u writes/response\n", static_cast<uint32_t>(timings[0] / iterations), writes[0] / iterations);
+            printf("  body gathered:           %u us/response, %u writes/response\n", static_cast<uint32_t>(timings[1] / iterations), writes[1] / iterations);
+        }
+    }
+
+} // Tests
+} // WPEFramework
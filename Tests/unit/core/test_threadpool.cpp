@@ -1388,3 +1388,165 @@ TEST(Core_ThreadPool, CheckThreadPool_JobType_Reschedule_AfterIdle)
     jobs.clear();
 }
 
+
+TEST(Core_ThreadPool, RingQueue_RemoveAndOverflow)
+{
+    RingQueueType<uint32_t> queue(4);
+    uint32_t value;
+
+    EXPECT_EQ(queue.Insert(1, 0), true);
+    EXPECT_EQ(queue.Insert(2, 0), true);
+    EXPECT_EQ(queue.Insert(3, 0), true);
+    EXPECT_EQ(queue.Insert(4, 0), true);
+    EXPECT_EQ(queue.IsFull(), true);
+
+    // Beyond the high water mark, an insert times out, a post always succeeds.
+    EXPECT_EQ(queue.Insert(5, 10), false);
+    for (uint32_t index = 5; index <= 10; index++) {
+        EXPECT_EQ(queue.Post(index), true);
+    }
+    EXPECT_EQ(queue.Length(), 10u);
+
+    // Revoke from the ring and from what spilled over.
+    EXPECT_EQ(queue.HasEntry(2), true);
+    EXPECT_EQ(queue.Remove(2), true);
+    EXPECT_EQ(queue.Remove(2), false);
+    EXPECT_EQ(queue.HasEntry(2), false);
+    EXPECT_EQ(queue.Remove(9), true);
+    EXPECT_EQ(queue.Length(), 8u);
+
+    const uint32_t expected[] = { 1, 3, 4, 5, 6, 7, 8, 10 };
+    for (const uint32_t entry : expected) {
+        EXPECT_EQ(queue.Extract(value, 0), true);
+        EXPECT_EQ(value, entry);
+    }
+    EXPECT_EQ(queue.Extract(value, 10), false);
+    EXPECT_EQ(queue.IsEmpty(), true);
+
+    // A parked consumer is released by a disable.
+    std::thread consumer([&]() { EXPECT_EQ(queue.Extract(value, Core::infinite), false); });
+    usleep(10000);
+    queue.Disable();
+    consumer.join();
+}
+
+// Jobs per second through the queue with several producers and consumers hammering it.
+template <typename QUEUE>
+static float MeasureQueueContention(const uint8_t producers, const uint8_t consumers, const uint32_t perProducer)
+{
+    QUEUE queue(64);
+    std::atomic<uint32_t> consumed(0);
+    const uint32_t total = producers * perProducer;
+    std::list<std::thread> threads;
+
+    for (uint8_t index = 0; index < consumers; index++) {
+        threads.emplace_back([&]() {
+            uint32_t value;
+            while (queue.Extract(value, Core::infinite) == true) {
+                consumed++;
+            }
+        });
+    }
+
+    Core::StopWatch stopWatch;
+
+    for (uint8_t index = 0; index < producers; index++) {
+        threads.emplace_back([&]() {
+            for (uint32_t count = 1; count <= perProducer; count++) {
+                queue.Insert(count, Core::infinite);
+            }
+        });
+    }
+
+    while (consumed != total) {
+        std::this_thread::yield();
+    }
+
+    uint64_t elapsed = stopWatch.Elapsed();
+
+    queue.Disable();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    return ((static_cast<float>(total) * Core::Time::MicroSecondsPerSecond) / static_cast<float>(elapsed));
+}
+
+TEST(Core_ThreadPool, QueueContentionBenchmark)
+{
+    static constexpr uint32_t PerProducer = 50000;
+    const uint8_t threads[] = { 1, 2, 4, 8 };
+
+    for (const uint8_t count : threads) {
+        float locked = MeasureQueueContention<QueueType<uint32_t>>(count, count, PerProducer);
+        float lockfree = MeasureQueueContention<RingQueueType<uint32_t>>(count, count, PerProducer);
+
+        printf("Queue %d producers/%d consumers: QueueType %10.0f jobs/s, RingQueueType %10.0f jobs/s\n", count, count, locked, lockfree);
+    }
+}
+
+TEST(Core_ThreadPool, SubmitContentionBenchmark)
+{
+    class CountJob : public Core::IDispatch {
+    public:
+        CountJob(std::atomic<uint32_t>& count)
+            : _count(count)
+        {
+        }
+        ~CountJob() override = default;
+
+        void Dispatch() override
+        {
+            _count++;
+        }
+
+    private:
+        std::atomic<uint32_t>& _count;
+    };
+
+    static constexpr uint8_t Workers = 8;
+    static constexpr uint8_t Producers = 4;
+    static constexpr uint32_t JobsPerProducer = 256;
+    static constexpr uint32_t Rounds = 50;
+
+    ThreadPoolTester threadPool(Workers, 0, Producers * JobsPerProducer);
+    std::atomic<uint32_t> count(0);
+    std::vector<Core::ProxyType<Core::IDispatch>> jobs;
+
+    for (uint32_t index = 0; index < (Producers * JobsPerProducer); index++) {
+        jobs.push_back(Core::ProxyType<Core::IDispatch>(Core::ProxyType<CountJob>::Create(count)));
+    }
+
+    threadPool.Run();
+
+    Core::StopWatch stopWatch;
+
+    for (uint32_t round = 1; round <= Rounds; round++) {
+        std::list<std::thread> producers;
+
+        for (uint8_t producer = 0; producer < Producers; producer++) {
+            producers.emplace_back([&, producer]() {
+                for (uint32_t index = 0; index < JobsPerProducer; index++) {
+                    threadPool.Submit(jobs[(producer * JobsPerProducer) + index], Core::infinite);
+                }
+            });
+        }
+        for (std::thread& thread : producers) {
+            thread.join();
+        }
+        while (count != (round * Producers * JobsPerProducer)) {
+            std::this_thread::yield();
+        }
+    }
+
+    uint64_t elapsed = stopWatch.Elapsed();
+
+    printf("ThreadPool %d workers, %d producers: %10.0f jobs/s\n", Workers, Producers,
+        (static_cast<float>(Rounds) * Producers * JobsPerProducer * Core::Time::MicroSecondsPerSecond) / static_cast<float>(elapsed));
+
+    threadPool.Stop();
+
+    for (auto& job : jobs) {
+        job.Release();
+    }
+}
@@ -0,0 +1,238 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    namespace {
+
+        // Compress a message the way the link does it, input and output in pieces of at most chunk bytes.
+        std::vector<uint8_t> Compress(Web::WebSocket::Deflate& deflate, const string& message, const uint32_t chunk)
+        {
+            std::vector<uint8_t> result;
+            std::vector<uint8_t> output(chunk);
+            const uint8_t* input = reinterpret_cast<const uint8_t*>(message.c_str());
+            uint32_t position = 0;
+            bool completed = false;
+
+            while (completed == false) {
+                uint32_t length = std::min(chunk, static_cast<uint32_t>(message.length()) - position);
+                const bool last = ((position + length) == message.length());
+                const uint32_t produced = deflate.Compress(&input[position], length, output.data(), chunk, last, completed);
+
+                position += length;
+                result.insert(result.end(), output.begin(), output.begin() + produced);
+            }
+
+            return (result);
+        }
+
+        string Decompress(Web::WebSocket::Deflate& inflate, const std::vector<uint8_t>& payload, const uint32_t chunk)
+        {
+            string result;
+            std::vector<uint8_t> output(chunk);
+            uint32_t position = 0;
+            bool completed = false;
+
+            while (completed == false) {
+                uint32_t length = std::min(chunk, static_cast<uint32_t>(payload.size()) - position);
+                const bool last = ((position + length) == payload.size());
+                const uint32_t produced = inflate.Decompress(&payload.data()[position], length, output.data(), chunk, last, completed);
+
+                position += length;
+                result.append(reinterpret_cast<const char*>(output.data()), produced);
+                completed = completed && last;
+            }
+
+            return (result);
+        }
+
+        // Something that looks like what the Controller reports on its status method.
+        string Status(const uint32_t round)
+        {
+            static const TCHAR* const states[] = { _T("activated"), _T("deactivated"), _T("suspended"), _T("resumed") };
+            string result(_T("["));
+
+            for (uint32_t index = 0; index < 30; index++) {
+                const string callsign(_T("Plugin") + std::to_string(index));
+
+                result += (index == 0 ? _T("") : _T(","));
+                result += _T("{\"callsign\":\"") + callsign + _T("\",\"locator\":\"libWPEFramework") + callsign + _T(".so\",\"classname\":\"") + callsign
+                    + _T("\",\"autostart\":") + ((index & 1) != 0 ? _T("true") : _T("false"))
+                    + _T(",\"precondition\":[\"Platform\",\"Network\"],\"configuration\":{\"root\":{\"mode\":\"Off\"}},\"startmode\":\"Activated\"")
+                    + _T(",\"state\":\"") + states[(index + round) % 4]
+                    + _T("\",\"processedrequests\":") + std::to_string(index * round * 7)
+                    + _T(",\"processedobjects\":") + std::to_string(index * round * 3)
+                    + _T(",\"observers\":") + std::to_string((index + round) % 3)
+                    + _T(",\"module\":\"Plugin_") + callsign + _T("\",\"hash\":\"") + std::to_string(0x1A2B3C4D + index) + _T("\"}");
+            }
+
+            return (result + _T("]"));
+        }
+    }
+
+    TEST(WebSocket_Deflate, Negotiation)
+    {
+        Web::WebSocket::Deflate server;
+        Web::WebSocket::Deflate client;
+        string response;
+
+        // What we offer as a client, we should accept as a server.
+        EXPECT_TRUE(server.Accept(Web::WebSocket::Deflate::Offer(), response));
+        EXPECT_TRUE(server.IsEnabled());
+        EXPECT_EQ(response, _T("permessage-deflate"));
+        EXPECT_TRUE(client.Agreed(response));
+        EXPECT_TRUE(client.IsEnabled());
+
+        // The parameters are echoed back, an offer with 8 window bits is skipped for the next one.
+        EXPECT_TRUE(server.Accept(_T("permessage-deflate; server_max_window_bits=8, permessage-deflate; server_no_context_takeover ; client_no_context_takeover; server_max_window_bits=\"10\""), response));
+        EXPECT_EQ(response, _T("permessage-deflate; server_no_context_takeover; client_no_context_takeover; server_max_window_bits=10"));
+        EXPECT_TRUE(client.Agreed(response));
+
+        // Unknown extensions and parameters are not accepted.
+        EXPECT_FALSE(server.Accept(_T("x-webkit-deflate-frame"), response));
+        EXPECT_FALSE(server.Accept(_T("permessage-deflate; unknown_parameter"), response));
+        EXPECT_FALSE(server.Accept(_T("permessage-deflate; server_max_window_bits=16"), response));
+        EXPECT_FALSE(server.IsEnabled());
+        EXPECT_TRUE(server.Accept(_T("x-webkit-deflate-frame, permessage-deflate; client_max_window_bits=12"), response));
+        EXPECT_EQ(response, _T("permessage-deflate"));
+
+        // A client can not go with what it did not offer, or what zlib can not do.
+        EXPECT_FALSE(client.Agreed(_T("permessage-deflate; client_max_window_bits=8")));
+        EXPECT_FALSE(client.Agreed(_T("permessage-deflate, permessage-deflate")));
+        EXPECT_FALSE(client.Agreed(_T("permessage-deflate; client_max_window_bits=99")));
+        EXPECT_FALSE(client.IsEnabled());
+        EXPECT_TRUE(client.Agreed(_T("permessage-deflate; client_max_window_bits=9")));
+    }
+
+    TEST(WebSocket_Deflate, RoundTrip)
+    {
+        for (const bool takeover : { true, false }) {
+            Web::WebSocket::Deflate server;
+            Web::WebSocket::Deflate client;
+            string response;
+
+            EXPECT_TRUE(server.Accept(takeover ? _T("permessage-deflate") : _T("permessage-deflate; server_no_context_takeover; client_no_context_takeover"), response));
+            EXPECT_TRUE(client.Agreed(response));
+
+            for (const uint32_t chunk : { 16u, 100u, 1024u, 65536u }) {
+                for (uint32_t round = 0; round < 4; round++) {
+                    const string message(Status(round));
+
+                    const std::vector<uint8_t> compressed(Compress(server, message, chunk));
+                    EXPECT_LT(compressed.size(), message.length());
+                    EXPECT_EQ(Decompress(client, compressed, chunk), message) << "chunk " << chunk << ", round " << round;
+
+                    const std::vector<uint8_t> back(Compress(client, message, chunk));
+                    EXPECT_EQ(Decompress(server, back, chunk), message) << "chunk " << chunk << ", round " << round;
+                }
+
+                // An empty message is still a message.
+                EXPECT_EQ(Decompress(client, Compress(server, string(), chunk), chunk), string());
+            }
+        }
+
+        // The compressed message is flagged with RSV1 on the first frame only.
+        Web::WebSocket::Protocol sender(true, true);
+        Web::WebSocket::Protocol receiver(true, false);
+        uint8_t frame[64];
+
+        sender.Compression(true);
+        ::memset(&frame[4], 'a', 10);
+        uint32_t sent = sender.Encoder(frame, 10, 10);
+        EXPECT_EQ(frame[0], 0x42);
+        uint32_t received = sent;
+        EXPECT_NE(receiver.Decoder(frame, received), 0);
+        EXPECT_TRUE(receiver.IsCompressed());
+        EXPECT_TRUE(receiver.ReceiveInProgress());
+
+        sent = sender.Encoder(frame, 11, 10);
+        EXPECT_EQ(frame[0], 0x80);
+        received = sent;
+        EXPECT_NE(receiver.Decoder(frame, received), 0);
+        EXPECT_TRUE(receiver.IsCompressed());
+        EXPECT_FALSE(receiver.ReceiveInProgress());
+
+        sender.Compression(false);
+        sent = sender.Encoder(frame, 11, 10);
+        EXPECT_EQ(frame[0], 0x82);
+        received = sent;
+        EXPECT_NE(receiver.Decoder(frame, received), 0);
+        EXPECT_FALSE(receiver.IsCompressed());
+    }
+
+    TEST(WebSocket_Deflate, ControllerStatus)
+    {
+        const uint32_t messages = 200;
+        const uint32_t chunk = 8 * 1024;
+        uint64_t plain = 0;
+        uint64_t bytes[2] = { 0, 0 };
+        uint64_t deflating[2] = { 0, 0 };
+        uint64_t inflating[2] = { 0, 0 };
+
+        for (uint32_t round = 0; round < messages; round++) {
+            plain += Status(round).length();
+        }
+
+        for (uint8_t run = 0; run < 2; run++) {
+            Web::WebSocket::Deflate server;
+            Web::WebSocket::Deflate client;
+            string response;
+            std::vector<std::vector<uint8_t>> compressed;
+
+            EXPECT_TRUE(server.Accept(run == 0 ? _T("permessage-deflate") : _T("permessage-deflate; server_no_context_takeover"), response));
+            EXPECT_TRUE(client.Agreed(response));
+
+            Core::StopWatch timer;
+            for (uint32_t round = 0; round < messages; round++) {
+                compressed.push_back(Compress(server, Status(round), chunk));
+                bytes[run] += compressed.back().size();
+            }
+            deflating[run] = timer.Elapsed();
+
+            timer.Reset();
+            for (uint32_t round = 0; round < messages; round++) {
+                EXPECT_FALSE(Decompress(client, compressed[round], chunk).empty());
+            }
+            inflating[run] = timer.Elapsed();
+        }
+
+        // With the context taken over, the next status is mostly a reference to the previous one.
+        EXPECT_LT(bytes[0], bytes[1]);
+        EXPECT_LT(bytes[1], plain);
+
+        printf("Controller status, %u messages\n", messages);
+        printf("  uncompressed: %u bytes/message\n", static_cast<uint32_t>(plain / messages));
+        for (uint8_t run = 0; run < 2; run++) {
+            printf("  deflate, %s: %u bytes/message, deflate %u us/message, inflate %u us/message\n",
+                (run == 0 ? "context takeover" : "no context takeover"),
+                static_cast<uint32_t>(bytes[run] / messages),
+                static_cast<uint32_t>(deflating[run] / messages),
+                static_cast<uint32_t>(inflating[run] / messages));
+        }
+    }
+
+} // Tests
+} // WPEFramework
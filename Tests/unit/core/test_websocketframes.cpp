@@ -0,0 +1,244 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    namespace {
+
+        // Frame a JSON element the way the WebSocket link does it: every send buffer becomes a frame.
+        void Send(std::vector<uint8_t>& wire, const Core::JSON::IElement& element, const uint32_t bufferSize)
+        {
+            Web::WebSocket::Protocol encoder(false, false);
+            std::vector<uint8_t> buffer(bufferSize + 14);
+            const uint32_t maxSize = bufferSize - 4;
+            uint32_t offset = 0;
+            bool done = false;
+
+            do {
+                uint32_t used = 0;
+
+                while ((done == false) && (used < maxSize)) {
+                    used += element.Serialize(reinterpret_cast<char*>(&buffer[4 + used]), static_cast<uint16_t>(std::min(maxSize - used, static_cast<uint32_t>(0xFFFF))), offset);
+                    done = (offset == 0);
+                }
+
+                const uint32_t sent = encoder.Encoder(buffer.data(), maxSize, used);
+                wire.insert(wire.end(), buffer.begin(), buffer.begin() + sent);
+            } while (encoder.SendInProgress() == true);
+        }
+
+        // Read the wire through a receive buffer, the way the socket and the WebSocket link do it, and hand
+        // every (partial) payload straight to the JSON deserializer.
+        void Receive(const std::vector<uint8_t>& wire, Core::JSON::IElement& element, const uint16_t bufferSize)
+        {
+            Web::WebSocket::Protocol decoder(false, false);
+            std::vector<uint8_t> buffer(bufferSize);
+            uint32_t offset = 0;
+            uint32_t position = 0;
+            uint16_t filled = 0;
+
+            while ((position < wire.size()) || (filled != 0)) {
+                const uint16_t size = static_cast<uint16_t>(std::min(static_cast<uint32_t>(bufferSize - filled), static_cast<uint32_t>(wire.size() - position)));
+                uint16_t handled = 0;
+                bool tooSmall = false;
+
+                ::memcpy(&buffer[filled], &wire[position], size);
+                position += size;
+                filled += size;
+
+                while ((handled < filled) && (tooSmall == false)) {
+                    uint32_t payload = filled - handled;
+                    const uint16_t header = decoder.Decoder(&buffer[handled], payload);
+
+                    tooSmall = ((header == 0) && (payload == 0));
+
+                    if (tooSmall == false) {
+                        uint16_t loaded = 0;
+                        uint16_t step = 1;
+                        while ((loaded < payload) && (step != 0)) {
+                            step = element.Deserialize(reinterpret_cast<const char*>(&buffer[handled + header + loaded]), static_cast<uint16_t>(payload - loaded), offset);
+                            loaded += step;
+                        }
+                        handled += static_cast<uint16_t>(header + payload);
+                    }
+                }
+
+                filled -= handled;
+                ::memmove(buffer.data(), &buffer[handled], filled);
+
+                if ((size == 0) && (handled == 0)) {
+                    break;
+                }
+            }
+        }
+
+        // Read the wire, but gather the payload of the complete message first and parse it in one go.
+        void Gather(const std::vector<uint8_t>& wire, Core::JSON::IElement& element)
+        {
+            Web::WebSocket::Protocol decoder(false, false);
+            std::vector<uint8_t> buffer(wire);
+            string message;
+            uint32_t handled = 0;
+
+            while (handled < buffer.size()) {
+                uint32_t payload = static_cast<uint32_t>(buffer.size() - handled);
+                const uint16_t header = decoder.Decoder(&buffer[handled], payload);
+
+                message.append(reinterpret_cast<const char*>(&buffer[handled + header]), payload);
+                handled += header + payload;
+            }
+
+            element.FromString(message);
+        }
+
+        string Result(const uint32_t size)
+        {
+            string result(_T("["));
+
+            for (uint32_t index = 0; result.length() < size; index++) {
+                result += (index == 0 ? _T("") : _T(","));
+                result += _T("{\"index\":") + std::to_string(index) + _T(",\"name\":\"element ") + std::to_string(index) + _T("\"}");
+            }
+
+            return (result + _T("]"));
+        }
+    }
+
+    TEST(WebSocket_Frames, ExtendedLength)
+    {
+        const uint32_t length = 70000;
+        std::vector<uint8_t> payload(length);
+
+        for (uint32_t index = 0; index < length; index++) {
+            payload[index] = static_cast<uint8_t>(index * 11 + 3);
+        }
+
+        for (const bool masking : { false, true }) {
+            std::vector<uint8_t> frame(length + 14);
+            Web::WebSocket::Protocol sender(true, masking);
+
+            ::memcpy(&frame[4], payload.data(), length);
+            const uint32_t sent = sender.Encoder(frame.data(), length + 1, length);
+            EXPECT_EQ(sent, length + 10 + (masking ? 4 : 0));
+            EXPECT_EQ(frame[0], 0x82);
+            EXPECT_EQ(frame[1], (masking ? 0x80 : 0x00) | 127);
+
+            uint64_t size = 0;
+            for (uint8_t index = 2; index < 10; index++) {
+                size = (size << 8) | frame[index];
+            }
+            EXPECT_EQ(size, length);
+
+            // At once.
+            {
+                std::vector<uint8_t> copy(frame);
+                Web::WebSocket::Protocol receiver(true, false);
+                uint32_t received = sent;
+                const uint16_t header = receiver.Decoder(copy.data(), received);
+                EXPECT_EQ(static_cast<uint32_t>(header), sent - length);
+                EXPECT_EQ(received, length);
+                EXPECT_TRUE(receiver.IsCompleteMessage());
+                EXPECT_EQ(::memcmp(&copy[header], payload.data(), length), 0);
+            }
+
+            // In pieces of 1000 bytes, every piece should come out in place.
+            {
+                std::vector<uint8_t> copy(frame);
+                Web::WebSocket::Protocol receiver(true, false);
+                uint32_t position = 0;
+                uint32_t received = 0;
+                uint16_t header = 0;
+
+                while (position < sent) {
+                    uint32_t size = std::min(static_cast<uint32_t>(1000), sent - position);
+                    const uint16_t found = receiver.Decoder(&copy[position], size);
+
+                    if (position == 0) {
+                        header = found;
+                    } else {
+                        EXPECT_EQ(found, 0);
+                    }
+                    received += size;
+                    position += found + size;
+                }
+
+                EXPECT_EQ(received, length);
+                EXPECT_TRUE(receiver.IsCompleteMessage());
+                EXPECT_EQ(::memcmp(&copy[header], payload.data(), length), 0);
+            }
+        }
+    }
+
+    TEST(WebSocket_Frames, JsonRpcResponseBenchmark)
+    {
+        const uint32_t iterations = 10;
+
+        Core::JSONRPC::Message response;
+        response.Id = 1;
+        response.Result = Result(1024 * 1024);
+
+        string expected;
+        response.ToString(expected);
+
+        // As the link sends it, fragmented over socket buffers, and as a single frame with a 64 bits length.
+        std::vector<uint8_t> fragmented;
+        std::vector<uint8_t> single;
+        Send(fragmented, response, 8 * 1024);
+        Send(single, response, static_cast<uint32_t>(expected.length() + 8));
+
+        EXPECT_GT(single.size(), expected.length());
+        EXPECT_EQ(single[1], 127);
+
+        uint64_t timings[3];
+        const std::vector<uint8_t>* wires[3] = { &fragmented, &single, &single };
+
+        for (uint8_t run = 0; run < 3; run++) {
+            Core::StopWatch timer;
+
+            for (uint32_t index = 0; index < iterations; index++) {
+                Core::JSONRPC::Message message;
+
+                if (run < 2) {
+                    Receive(*wires[run], message, 0xFFFF);
+                } else {
+                    Gather(*wires[run], message);
+                }
+
+                EXPECT_EQ(message.Id.Value(), 1u);
+                EXPECT_EQ(message.Result.Value().length(), response.Result.Value().length());
+            }
+
+            timings[run] = timer.Elapsed() / iterations;
+        }
+
+        printf("1 MB JSON-RPC response, %u bytes\n", static_cast<uint32_t>(expected.length()));
+        printf("  8 Kb frames, %u bytes on the wire, streamed: %u us\n", static_cast<uint32_t>(fragmented.size()), static_cast<uint32_t>(timings[0]));
+        printf("  single frame, %u bytes on the wire, streamed: %u us\n", static_cast<uint32_t>(single.size()), static_cast<uint32_t>(timings[1]));
+        printf("  single frame, gathered before parsing: %u us\n", static_cast<uint32_t>(timings[2]));
+    }
+
+} // Tests
+} // WPEFramework
@@ -0,0 +1,155 @@
+/*
+ * If not stated otherwise in this file or this component's LICENSE file the
+ * following copyright and licenses apply:
+ *
+ * Copyright 2020 Metrological
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "../IPTestAdministrator.h"
+
+#include <gtest/gtest.h>
+#include <core/core.h>
+#include <websocket/websocket.h>
+
+namespace WPEFramework {
+namespace Tests {
+
+    // The byte by byte masking, as it used to be done.
+    static void ScalarMask(uint8_t destination[], const uint8_t source[], const uint32_t length, const uint8_t key[4], const uint8_t offset)
+    {
+        uint32_t bytesToMove = length;
+
+        if (destination > source) {
+            while (bytesToMove != 0) {
+                bytesToMove--;
+                destination[bytesToMove] = (source[bytesToMove] ^ key[(bytesToMove + offset) & 0x3]);
+            }
+        } else {
+            for (uint32_t index = 0; index < length; index++) {
+                destination[index] = (source[index] ^ key[(index + offset) & 0x3]);
+            }
+        }
+    }
+
+    TEST(WebSocket_Mask, AgainstScalar)
+    {
+        const uint8_t key[4] = { 0x12, 0x34, 0x56, 0x78 };
+        uint8_t original[256];
+
+        for (uint16_t index = 0; index < sizeof(original); index++) {
+            original[index] = static_cast<uint8_t>(index * 13);
+        }
+
+        for (uint32_t length = 0; length < 100; length++) {
+            for (uint8_t offset = 0; offset < 4; offset++) {
+                for (uint8_t shift = 0; shift <= 10; shift += 2) {
+                    uint8_t expected[sizeof(original)];
+                    uint8_t actual[sizeof(original)];
+
+                    // Destination beyond the source, as the encoder does it.
+                    ::memcpy(expected, original, sizeof(original));
+                    ::memcpy(actual, original, sizeof(original));
+                    ScalarMask(&expected[3 + shift], &expected[3], length, key, offset);
+                    Web::WebSocket::Protocol::Mask(&actual[3 + shift], &actual[3], length, key, offset);
+                    EXPECT_EQ(::memcmp(expected, actual, sizeof(original)), 0) << "length " << length << ", offset " << static_cast<int>(offset) << ", shift +" << static_cast<int>(shift);
+
+                    // Destination before the source.
+                    ::memcpy(expected, original, sizeof(original));
+                    ::memcpy(actual, original, sizeof(original));
+                    ScalarMask(&expected[3], &expected[3 + shift], length, key, offset);
+                    Web::WebSocket::Protocol::Mask(&actual[3], &actual[3 + shift], length, key, offset);
+                    EXPECT_EQ(::memcmp(expected, actual, sizeof(original)), 0) << "length " << length << ", offset " << static_cast<int>(offset) << ", shift -" << static_cast<int>(shift);
+                }
+            }
+        }
+    }
+
+    TEST(WebSocket_Mask, RoundTrip)
+    {
+        for (const uint16_t length : { static_cast<uint16_t>(5), static_cast<uint16_t>(125), static_cast<uint16_t>(126), static_cast<uint16_t>(1021) }) {
+            uint8_t payload[1024];
+            uint8_t frame[1024 + 16];
+
+            for (uint16_t index = 0; index < length; index++) {
+                payload[index] = static_cast<uint8_t>(index * 7 + 1);
+            }
+
+            // The sender puts the payload after the room for the largest header.
+            Web::WebSocket::Protocol sender(true, true);
+            ::memcpy(&frame[4], payload, length);
+            const uint32_t sent = sender.Encoder(frame, sizeof(frame) - 8, length);
+            EXPECT_EQ(sent, static_cast<uint32_t>(length + (length <= 125 ? 2 : 4) + 4));
+
+            // Receive it at once.
+            {
+                uint8_t copy[sizeof(frame)];
+                ::memcpy(copy, frame, sent);
+
+                Web::WebSocket::Protocol receiver(true, false);
+                uint32_t received = sent;
+                const uint16_t header = receiver.Decoder(copy, received);
+                EXPECT_EQ(received, static_cast<uint32_t>(length));
+                EXPECT_EQ(::memcmp(&copy[header], payload, length), 0);
+            }
+
+            // Receive it in two parts, with the second one starting at an odd position in the key.
+            {
+                uint8_t copy[sizeof(frame)];
+                ::memcpy(copy, frame, sent);
+
+                Web::WebSocket::Protocol receiver(true, false);
+                const uint32_t first = (sent - length) + (length / 2) + 1;
+                uint32_t received = first;
+                const uint16_t header = receiver.Decoder(copy, received);
+                EXPECT_EQ(received, first - header);
+                EXPECT_FALSE(receiver.IsCompleteMessage());
+
+                uint32_t rest = sent - first;
+                EXPECT_EQ(receiver.Decoder(&copy[first], rest), 0);
+                EXPECT_EQ(rest, sent - first);
+                EXPECT_TRUE(receiver.IsCompleteMessage());
+                EXPECT_EQ(::memcmp(&copy[header], payload, length), 0);
+            }
+        }
+    }
+
+    TEST(WebSocket_Mask, Benchmark)
+    {
+        const uint8_t key[4] = { 0xDE, 0xAD, 0xBE, 0xEF };
+        const uint32_t length = 60 * 1024;
+        const uint32_t iterations = 1000;
+        std::vector<uint8_t> buffer(length + 8, 0x5A);
+        uint64_t scalar, masked;
+
+        Core::StopWatch timer;
+        for (uint32_t index = 0; index < iterations; index++) {
+            ScalarMask(&buffer[4], &buffer[0], length, key, 0);
+        }
+        scalar = timer.Elapsed();
+
+        timer.Reset();
+        for (uint32_t index = 0; index < iterations; index++) {
+            Web::WebSocket::Protocol::Mask(&buffer[4], &buffer[0], length, key, 0);
+        }
+        masked = timer.Elapsed();
+
+        printf("Masking %u Kb frames, byte by byte: %u MB/s, %s: %u MB/s\n", length / 1024,
+            static_cast<uint32_t>((static_cast<uint64_t>(length) * iterations) / (scalar != 0 ? scalar : 1)),
+            Web::WebSocket::Protocol::MaskImplementation(),
+            static_cast<uint32_t>((static_cast<uint64_t>(length) * iterations) / (masked != 0 ? masked : 1)));
+    }
+
+} // Tests
+} // WPEFramework
@@ -1433,3 +1433,238 @@ TEST(Core_WorkerPool, Check_ReschduledTimedJob_MultiplePool)
     CheckWorkerPool_ReschduledTimedJob(3, 5, 5, 10, 5);
 }
 
+
+class StealingPool : public Core::WorkerPool {
+private:
+    class Dispatcher : public Core::ThreadPool::IDispatcher {
+    public:
+        Dispatcher(const Dispatcher&) = delete;
+        Dispatcher& operator=(const Dispatcher&) = delete;
+
+        Dispatcher() = default;
+        ~Dispatcher() override = default;
+
+    private:
+        void Initialize() override {}
+        void Deinitialize() override {}
+        void Dispatch(Core::IDispatch* job) override { job->Dispatch(); }
+    };
+
+public:
+    StealingPool(const StealingPool&) = delete;
+    StealingPool& operator=(const StealingPool&) = delete;
+
+PUSH_WARNING(DISABLE_WARNING_THIS_IN_MEMBER_INITIALIZER_LIST)
+    StealingPool(const uint8_t threads, const Core::ThreadPool::scheduling mode)
+        : Core::WorkerPool(threads, 0, 64, &_dispatcher, mode)
+        , _dispatcher()
+    {
+        Run();
+    }
+POP_WARNING()
+    ~StealingPool()
+    {
+        Stop();
+    }
+
+private:
+    Dispatcher _dispatcher;
+};
+
+class CountingJob : public Core::IDispatch {
+public:
+    CountingJob(std::atomic<uint32_t>& count)
+        : _count(count)
+    {
+    }
+    ~CountingJob() override = default;
+
+    void Dispatch() override
+    {
+        _count++;
+    }
+
+private:
+    std::atomic<uint32_t>& _count;
+};
+
+// Submits its children from the worker thread it runs on, so they land on the local deque.
+class FanOutJob : public Core::IDispatch {
+public:
+    FanOutJob(Core::IWorkerPool& pool, std::vector<Core::ProxyType<Core::IDispatch>>& children, const int8_t revoke = -1)
+        : _pool(pool)
+        , _children(children)
+        , _revoke(revoke)
+    {
+    }
+    ~FanOutJob() override = default;
+
+    void Dispatch() override
+    {
+        for (auto& child : _children) {
+            _pool.Submit(child);
+        }
+        if (_revoke >= 0) {
+            _pool.Revoke(_children[_revoke], 0);
+        }
+    }
+
+private:
+    Core::IWorkerPool& _pool;
+    std::vector<Core::ProxyType<Core::IDispatch>>& _children;
+    const int8_t _revoke;
+};
+
+static uint32_t WaitForCount(const std::atomic<uint32_t>& count, const uint32_t expected)
+{
+    const uint64_t deadline = Core::Time::Now().Add(5000).Ticks();
+    while ((count < expected) && (Core::Time::Now().Ticks() < deadline)) {
+        std::this_thread::yield();
+    }
+    return (count);
+}
+
+TEST(Core_WorkerPool, Check_WorkStealing_LocalSubmit)
+{
+    static constexpr uint8_t Children = 32;
+    StealingPool pool(4, Core::ThreadPool::STEALING);
+    std::atomic<uint32_t> count(0);
+    std::vector<Core::ProxyType<Core::IDispatch>> children;
+
+    for (uint8_t index = 0; index < Children; index++) {
+        children.push_back(Core::ProxyType<Core::IDispatch>(Core::ProxyType<CountingJob>::Create(count)));
+    }
+
+    // The last child is revoked right after it is pushed, thieves take from the other end.
+    Core::ProxyType<FanOutJob> parent(Core::ProxyType<FanOutJob>::Create(pool, children, Children - 1));
+    pool.Submit(Core::ProxyType<Core::IDispatch>(parent));
+
+    // The revoked child should never run.
+    EXPECT_EQ(WaitForCount(count, Children - 1), static_cast<uint32_t>(Children - 1));
+    usleep(10000);
+    EXPECT_EQ(count, static_cast<uint32_t>(Children - 1));
+
+    const Core::IWorkerPool::Metadata& metaData = pool.Snapshot();
+    uint32_t runs = 0, local = 0, global = 0, stolen = 0;
+    for (uint8_t index = 0; index < metaData.Slots; index++) {
+        runs += metaData.Slot[index];
+        local += metaData.Local[index];
+        global += metaData.Global[index];
+        stolen += metaData.Stolen[index];
+    }
+
+    // The parent came through the shared queue, the children from the local deque or a sibling.
+    EXPECT_EQ(runs, static_cast<uint32_t>(Children));
+    EXPECT_EQ(global, 1u);
+    EXPECT_EQ(local + stolen, static_cast<uint32_t>(Children - 1));
+    EXPECT_EQ(metaData.Pending, 0u);
+
+    parent.Release();
+    for (auto& child : children) {
+        child.Release();
+    }
+}
+
+TEST(Core_WorkerPool, Check_WorkStealing_FanOutBenchmark)
+{
+    static constexpr uint8_t Children = 64;
+    static constexpr uint16_t Rounds = 200;
+    const Core::ThreadPool::scheduling modes[] = { Core::ThreadPool::SHARED, Core::ThreadPool::STEALING };
+    const TCHAR* names[] = { _T("shared"), _T("stealing") };
+
+    for (uint8_t mode = 0; mode < (sizeof(modes) / sizeof(modes[0])); mode++) {
+        StealingPool pool(4, modes[mode]);
+        std::atomic<uint32_t> count(0);
+        std::vector<Core::ProxyType<Core::IDispatch>> children;
+
+        for (uint8_t index = 0; index < Children; index++) {
+            children.push_back(Core::ProxyType<Core::IDispatch>(Core::ProxyType<CountingJob>::Create(count)));
+        }
+
+        Core::ProxyType<Core::IDispatch> parent(Core::ProxyType<FanOutJob>::Create(pool, children));
+
+        Core::StopWatch stopWatch;
+
+        for (uint16_t round = 1; round <= Rounds; round++) {
+            pool.Submit(parent);
+            EXPECT_EQ(WaitForCount(count, round * Children), static_cast<uint32_t>(round * Children));
+        }
+
+        uint64_t elapsed = stopWatch.Elapsed();
+
+        printf("WorkerPool %-8s fan out: %8.0f jobs/s\n", names[mode],
+            (static_cast<float>(Rounds) * (Children + 1) * Core::Time::MicroSecondsPerSecond) / static_cast<float>(elapsed));
+
+        parent.Release();
+        for (auto& child : children) {
+            child.Release();
+        }
+    }
+}
+
+class OrderedJob : public Core::IDispatch {
+public:
+    OrderedJob(std::vector<uint8_t>& order, const uint8_t id, Core::Event* gate = nullptr)
+        : _order(order)
+        , _id(id)
+        , _gate(gate)
+    {
+    }
+    ~OrderedJob() override = default;
+
+    void Dispatch() override
+    {
+        if (_gate != nullptr) {
+            _gate->Lock(5000);
+        }
+        _order.push_back(_id);
+    }
+
+private:
+    std::vector<uint8_t>& _order;
+    const uint8_t _id;
+    Core::Event* _gate;
+};
+
+TEST(Core_WorkerPool, Check_PriorityAndFairness)
+{
+    StealingPool pool(1, Core::ThreadPool::SHARED);
+    Core::Event gate(false, true);
+    std::vector<uint8_t> order;
+
+    // Keep the only worker busy, while the queue fills up.
+    Core::ProxyType<Core::IDispatch> blocker(Core::ProxyType<OrderedJob>::Create(order, 0, &gate));
+    pool.Submit(blocker);
+    while (pool.Snapshot().Pending != 0) {
+        std::this_thread::yield();
+    }
+
+    std::vector<Core::ProxyType<Core::IDispatch>> jobs;
+    auto submit = [&](const uint8_t id, const Core::ThreadPool::priority level, const uint32_t key) {
+        jobs.push_back(Core::ProxyType<Core::IDispatch>(Core::ProxyType<OrderedJob>::Create(order, id)));
+        pool.Submit(jobs.back(), level, key);
+    };
+
+    submit(1, Core::ThreadPool::LOW, 0);
+    submit(2, Core::ThreadPool::MEDIUM, 1);
+    submit(3, Core::ThreadPool::MEDIUM, 1);
+    submit(4, Core::ThreadPool::MEDIUM, 1);
+    submit(5, Core::ThreadPool::MEDIUM, 2);
+    submit(6, Core::ThreadPool::HIGH, 3);
+
+    gate.SetEvent();
+
+    const std::vector<uint8_t> expected = { 0, 6, 2, 5, 3, 4, 1 };
+    const uint64_t deadline = Core::Time::Now().Add(5000).Ticks();
+    while ((pool.Snapshot().Pending != 0) && (Core::Time::Now().Ticks() < deadline)) {
+        std::this_thread::yield();
+    }
+    pool.Revoke(jobs.front(), 5000);
+
+    EXPECT_EQ(order, expected);
+
+    blocker.Release();
+    for (auto& job : jobs) {
+        job.Release();
+    }
+}
@@ -913,6 +913,7 @@ class Function(Block, Name):
         self.retval = Identifier(self, self, ret_type, valid_specifiers, False)
         self.omit = False
         self.stub = False
+        self.oneway = False
         self.is_excluded = False
         self.parent.methods.append(self)
         for method in self.parent.methods:
@@ -1372,6 +1373,8 @@ def __Tokenize(contents,log = None):
                     tagtokens.append("@OMIT")
                 if _find("@stub", token):
                     tagtokens.append("@STUB")
+                if _find("@oneway", token):
+                    tagtokens.append("@ONEWAY")
                 if _find("@in", token):
                     tagtokens.append("@IN")
                 if _find("@out", token):
@@ -1531,6 +1534,7 @@ def Parse(contents,log = None):
     min_index = 0
     omit_next = False
     stub_next = False
+    oneway_next = False
     json_next = False
     exclude_next = False
     event_next = False
@@ -1555,6 +1559,10 @@ def Parse(contents,log = None):
             stub_next = True
             tokens[i] = ";"
             i += 1
+        elif tokens[i] == "@ONEWAY":
+            oneway_next = True
+            tokens[i] = ";"
+            i += 1
         elif tokens[i] == "@JSON":
             json_next = True
             tokens[i] = ";"
@@ -1585,6 +1593,7 @@ def Parse(contents,log = None):
             min_index = 0
             omit_next = False
             stub_next = False
+            oneway_next = False
             json_next = False
             event_next = False
             extended_next = False
@@ -1822,6 +1831,10 @@ def Parse(contents,log = None):
             elif method.parent.stub:
                 method.stub = True
 
+            if oneway_next:
+                method.oneway = True
+                oneway_next = False
+
             if exclude_next:
                 method.is_excluded = True
                 exclude_next = False
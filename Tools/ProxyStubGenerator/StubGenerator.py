@@ -383,6 +383,11 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                             "unable to serialise '%s %s': an input non-const reference to pointer parameter is not supported"
                             % (self.CppType(), self.origname))
 
+                # Buffers with a 32-bit length can be larger than a frame, these go through
+                # the shared memory region of the invoke (see RPC::Data::Input::Buffer)
+                def IsShared(self):
+                    return self.is_ptr and not self.obj and not self.is_interface and self.length_type in ["uint32_t", "unsigned int"]
+
                 def CheckRpcType(self):
                     if self.str_rpctype == None:
                         try:
@@ -613,6 +618,9 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                             if not p.ptr_length and not p.ptr_interface:
                                 raise TypenameError(
                                     p.oclass, "unable to serialise '%s': length variable not defined" % (p.origname))
+                            if p.IsShared() and p.is_input and p.is_output and p.maxlength_var:
+                                raise TypenameError(
+                                    p.oclass, "unable to serialise '%s': a 32-bit length input/output buffer can not have a maxlength" % (p.origname))
 
             for m in emit_methods:
                 proxy_count = 0
@@ -703,11 +711,16 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                                 if p.is_ptr and not p.obj and not p.is_ref and p.length_type == "void":
                                     emit.Line("%s %s{}; // storage" % (p.str_typename, p.name))
                                 elif p.is_ptr and not p.obj and not p.is_ref:
-                                    if p.is_input:
+                                    if p.is_input and p.IsShared():
+                                        emit.Line("const %s %s = %s;" % (p.str_nocvref, p.name, NULLPTR))
+                                        emit.Line("%s %s_length = input.Buffer(reader, %s);" % (p.length_type, p.name, p.name))
+                                    elif p.is_input:
                                         emit.Line("const %s %s = %s;" % (p.str_nocvref, p.name, NULLPTR))
                                         emit.Line("%s %s_length = reader.Lock%s(%s);" %
                                                   (p.length_type, p.name, p.RpcTypeNoCV(), p.name))
                                         emit.Line("reader.UnlockBuffer(%s_length);" % p.name)
+                                    elif p.is_output and p.IsShared():
+                                        emit.Line("%s %s_reserved = input.Reserved(reader);" % (p.str_nocvref, p.name))
                                 elif p.is_ref and not p.is_input and not p.is_ptr_ptr:
                                     emit.Line("%s %s{}; // storage" % (p.str_nocvref, p.name))
                                     if p.is_length or p.is_maxlength:
@@ -770,6 +783,16 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                                                 # is input/output but maxlength not defined
                                                 emit.Line("%s = const_cast<%s>(%s); // reuse the input buffer" %
                                                           (p.name, p.str_nocvref, oldname))
+                                        elif p.IsShared():
+                                            # is output-only, the caller reserved room for it if it is large
+                                            emit.Line("%s = %s_reserved;" % (p.name, p.name))
+                                            emit.Line("if ((%s == %s) && (%s != 0)) {" % (p.name, NULLPTR, length_var))
+                                            emit.IndentInc()
+                                            emit.Line("ASSERT((%s < 0x10000) && \"Buffer length too big\");" % length_var)
+                                            emit.Line("%s = static_cast<%s>(ALLOCA(%s));" % (p.name, p.str_nocvref, length_var))
+                                            emit.Line("ASSERT(%s != %s);" % (p.name, NULLPTR))
+                                            emit.IndentDec()
+                                            emit.Line("}")
                                         else:
                                             # is output-only
                                             if not p.length_constant:
@@ -888,12 +911,16 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                                 else:
                                     if p.length_var and p.length_ref and p.length_ref.is_output:
                                         emit.Line("writer.%s(%s);" % (p.length_ref.RpcType(), p.length_var))
-                                    emit.Line("if ((%s != %s) && (%s != 0)) {" % (p.name, NULLPTR, p.length_var))
-                                    emit.IndentInc()
-                                    emit.Line("writer.%s(%s, %s);" %
-                                              (p.RpcType(), p.length_var if p.length_var else p.maxlength_var, p.name))
-                                    emit.IndentDec()
-                                    emit.Line("}")
+                                    if p.IsShared():
+                                        emit.Line("input.Buffer(writer, (%s != %s ? %s : 0), %s);" %
+                                                  (p.name, NULLPTR, p.length_var if p.length_var else p.maxlength_var, p.name))
+                                    else:
+                                        emit.Line("if ((%s != %s) && (%s != 0)) {" % (p.name, NULLPTR, p.length_var))
+                                        emit.IndentInc()
+                                        emit.Line("writer.%s(%s, %s);" %
+                                                  (p.RpcType(), p.length_var if p.length_var else p.maxlength_var, p.name))
+                                        emit.IndentDec()
+                                        emit.Line("}")
                             elif p.is_nonconstref or p.is_ptr_ptr:
                                 if p.obj and not p.is_interface:
                                     emit.Line("// (decompose %s)" % p.str_typename)
@@ -1026,6 +1053,14 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                     emit.Line("")
                     continue
 
+                if m.oneway:
+                    # nothing comes back from a one-way call, so it can not carry anything back either
+                    if retval.has_output:
+                        raise TypenameError(m, "method '%s': one-way method must return void" % m.name)
+                    for p in params:
+                        if p.is_output or p.is_interface or (p.is_ptr and p.obj) or p.IsShared():
+                            raise TypenameError(m, "method '%s': one-way method can not take parameter '%s'" % (m.name, p.origname))
+
                 emit.Line(method_line)
                 emit.Line("{")
                 emit.IndentInc()
@@ -1064,8 +1099,12 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                                 if p.is_ptr and p.obj and p.is_input:
                                     proxy_params += 1
                                 if not p.obj and p.is_ptr:
-                                    if p.is_input:
+                                    if p.is_input and p.IsShared():
+                                        emit.Line("newMessage->Parameters().Buffer(writer, %s, param%i);" % (p.length_expr, c))
+                                    elif p.is_input:
                                         emit.Line("writer.%s(%s, param%i);" % (p.RpcType(), p.length_expr, c))
+                                    elif p.is_output and p.IsShared():
+                                        emit.Line("newMessage->Parameters().Reserve(writer, %s);" % (p.maxlength_expr if p.maxlength_var else p.length_expr))
                                 elif not p.is_input and ((p.is_nonconstref and p.is_nonconstptr) or p.is_ptr_ptr):
                                     pass
                                 elif (not p.is_length or not params[p.length_target].is_input
@@ -1087,7 +1126,7 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
 
                     retval_has_proxy = retval.has_output and retval.is_interface
 
-                    emit.Line("// invoke the method handler")
+                    emit.Line("// post the method call, no response is expected" if m.oneway else "// invoke the method handler")
                     if retval.has_output:
                         default = "{}"
                         if isinstance(retval.typename, (CppParser.Typedef, CppParser.Enum)):
@@ -1103,6 +1142,8 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                     elif proxy_params + output_params > 0:
                         emit.Line("if (Invoke(newMessage) == Core::ERROR_NONE) {")
                         emit.IndentInc()
+                    elif m.oneway:
+                        emit.Line("BaseClass::Post(newMessage);")
                     else:
                         emit.Line("Invoke(newMessage);")
 
@@ -1150,11 +1191,14 @@ def GenerateStubs(output_file, source_file, includePaths = [], defaults="", scan
                             if p.length_type != "void":
                                 if p.length_var and p.length_ref and p.length_ref.is_output:
                                     emit.Line("%s = reader.%s();" % (p.length_ref.name, p.length_ref.RpcType()))
-                                emit.Line("if ((%s != 0) && (%s != 0)) {" % (p.name, p.length_expr))
-                                emit.IndentInc()
-                                emit.Line("reader.%s(%s, %s);" % (p.RpcType(), p.length_expr, p.name))
-                                emit.IndentDec()
-                                emit.Line("}")
+                                if p.IsShared():
+                                    emit.Line("newMessage->Parameters().Buffer(reader, ((%s != 0) ? %s : 0), %s);" % (p.name, p.length_expr, p.name))
+                                else:
+                                    emit.Line("if ((%s != 0) && (%s != 0)) {" % (p.name, p.length_expr))
+                                    emit.IndentInc()
+                                    emit.Line("reader.%s(%s, %s);" % (p.RpcType(), p.length_expr, p.name))
+                                    emit.IndentDec()
+                                    emit.Line("}")
                             else:
                                 emit.Line("ASSERT(%s != %s);" % (p.name, NULLPTR));
                                 emit.Line("*%s = reader.%s();" % (p.name, p.RpcTypeBare()))